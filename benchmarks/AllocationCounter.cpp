@@ -0,0 +1,104 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace opal;
+
+namespace {
+
+std::atomic<uint64_t> allocationCount{0};
+
+void* allocate(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    std::size_t align   = static_cast<std::size_t>(alignment);
+    std::size_t rounded = (size + align - 1) / align * align;
+    if (void* memory = std::aligned_alloc(align, rounded == 0 ? align : rounded)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+}  // namespace
+
+uint64_t AllocationCounter::allocations() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
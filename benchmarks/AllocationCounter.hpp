@@ -0,0 +1,63 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace opal {
+
+/**
+ * @class AllocationCounter
+ * @brief Counts the heap allocations made by the benchmark binary
+ *
+ * The global operator new of opal_bench is replaced so that every allocation
+ * increments a counter, which benchmarks read to report allocations per token.
+ * This class cannot be instantiated.
+ */
+class AllocationCounter {
+private:
+    AllocationCounter()                                    = delete;
+    ~AllocationCounter()                                   = delete;
+    AllocationCounter(const AllocationCounter&)            = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+public:
+    /**
+     * @brief Gets the number of allocations made since the program started
+     * @return uint64_t The allocation count
+     */
+    static uint64_t allocations();
+
+    /**
+     * @brief Counts the allocations made by a call
+     * @param fn The callable to run
+     * @return uint64_t The number of allocations made while it ran
+     */
+    template <typename Fn>
+    static uint64_t measure(Fn&& fn) {
+        uint64_t before = allocations();
+        fn();
+        return allocations() - before;
+    }
+};
+
+}  // namespace opal
@@ -0,0 +1,356 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef OPAL_EXAMPLES_DIR
+#define OPAL_EXAMPLES_DIR "docs/examples"
+#endif
+
+namespace opal {
+
+/**
+ * @class BenchmarkCorpus
+ * @brief Generates synthetic Opal sources for benchmarking
+ *
+ * Produces the same programs as scripts/benchmark.sh so that micro benchmarks
+ * and the end-to-end benchmark script measure comparable inputs, along with
+ * sources made of a single kind of construct for the per-tokenizer and
+ * per-atomizer benchmarks.
+ * This class cannot be instantiated.
+ */
+class BenchmarkCorpus {
+private:
+    BenchmarkCorpus()                                  = delete;
+    ~BenchmarkCorpus()                                 = delete;
+    BenchmarkCorpus(const BenchmarkCorpus&)            = delete;
+    BenchmarkCorpus& operator=(const BenchmarkCorpus&) = delete;
+
+public:
+    /**
+     * @brief Generates the benchmark program for a given number of test cases
+     * @param size The number of generated test cases
+     * @return std::string The program source
+     */
+    static std::string generate(int size) {
+        std::string source;
+        source.reserve(static_cast<size_t>(size) * 256);
+
+        source += "/* Benchmark test for size " + std::to_string(size) + " */\n";
+        source += "fn main() {\n";
+        source += "    test_size = " + std::to_string(size) + "\n";
+        source += "    start_time = time()\n";
+
+        for (int i = 0; i < size; i++) {
+            std::string n = std::to_string(i);
+
+            source += "    str_" + n + " = \"Value at " + n + ": ${fibonacci(" + n + " % 10)}\"\n";
+            source += "    complex_" + n + " = (" + n + " * 3.14159) ^ 2 + fibonacci(" + n + " % 5)\n";
+
+            if (i % 5 == 0) {
+                source += "    array_" + n + " = [1, 2, 3, \"test\", fibonacci(" + n + " % 3)]\n";
+                source += "    foreach item in array_" + n + " {\n";
+                source += "        complex_" + n + " = complex_" + n + " + 1\n";
+                source += "    }\n";
+            }
+
+            if (i % 7 == 0) {
+                source += "    if complex_" + n + " > 100 {\n";
+                source += "        try {\n";
+                source += "            process_range(0, complex_" + n + ")\n";
+                source += "        } catch (error) {\n";
+                source += "            complex_" + n + " = complex_" + n + " - 1\n";
+                source += "        } finally {\n";
+                source += "            complex_" + n + " = complex_" + n + " - 1\n";
+                source += "        }\n";
+                source += "    } elif complex_" + n + " > 50 {\n";
+                source += "        while complex_" + n + " > 0 {\n";
+                source += "            complex_" + n + " = complex_" + n + " - 1\n";
+                source += "        }\n";
+                source += "    } else {\n";
+                source += "        for x in 0..10 {\n";
+                source += "            complex_" + n + " = complex_" + n + " + x\n";
+                source += "        }\n";
+                source += "    }\n";
+            }
+        }
+
+        source += "\n";
+        source += "    end_time = time()\n";
+        source += "    execution_time = end_time - start_time\n";
+        source += "    output_file = open(\"${OUTPUT_DIR}/benchmark_${test_size}.txt\", \"w\")\n";
+        source += "    output_file.write(\"Benchmark completed:\\n\")\n";
+        source += "    output_file.write(\"- Size: ${test_size}\\n\")\n";
+        source += "    output_file.write(\"- Execution time: ${execution_time}s\\n\")\n";
+        source += "    output_file.write(\"- Memory usage: ${get_memory_usage()}MB\\n\")\n";
+        source += "    output_file.close()\n";
+        source += "}\n";
+
+        return source;
+    }
+
+    /**
+     * @brief Generates lines of identifiers and keywords only
+     * @param lines The number of generated lines
+     * @return std::string The source
+     */
+    static std::string identifiers(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += "alpha_" + n + " beta" + n + " if else while camelCase" + n + " fn return\n";
+        });
+    }
+
+    /**
+     * @brief Generates lines of integer and float literals only
+     * @param lines The number of generated lines
+     * @return std::string The source
+     */
+    static std::string numbers(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += n + " " + n + ".25 3.14159 1000000 0.5 42\n";
+        });
+    }
+
+    /**
+     * @brief Generates lines of string literals, with and without interpolations
+     * @param lines The number of generated lines
+     * @return std::string The source
+     */
+    static std::string strings(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += "\"Value at " + n + ": ${value_" + n + "} of ${total}\" \"plain text " + n + "\"\n";
+        });
+    }
+
+    /**
+     * @brief Generates lines of single and multi-character operators only
+     * @param lines The number of generated lines
+     * @return std::string The source
+     */
+    static std::string operators(int lines) {
+        return repeat(lines, [](std::string& source, const std::string&) {
+            source += "+ - * / % ^ = == != < <= > >= ( ) [ ] { } , . ..\n";
+        });
+    }
+
+    /**
+     * @brief Generates single-line and multi-line comments only
+     * @param lines The number of generated comment pairs
+     * @return std::string The source
+     */
+    static std::string comments(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += "// Comment number " + n + " describing the next block\n";
+            source += "/* Block comment " + n + "\n   spanning /* nested */ lines */\n";
+        });
+    }
+
+    /**
+     * @brief Generates plain variable assignments
+     * @param lines The number of generated assignments
+     * @return std::string The source
+     */
+    static std::string assignments(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += "value_" + n + " = " + n + "\n";
+            source += "alias_" + n + " = value_" + n + "\n";
+        });
+    }
+
+    /**
+     * @brief Generates assignments of parenthesized arithmetic expressions
+     * @param lines The number of generated assignments
+     * @return std::string The source
+     */
+    static std::string operations(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += "result_" + n + " = (" + n + " + value_" + n + ") * 3 - total / 2 % 7\n";
+        });
+    }
+
+    /**
+     * @brief Generates the arithmetic assignments of scripts/benchmark.sh, mixing groups, power and calls
+     * @param lines The number of generated assignments
+     * @return std::string The source
+     */
+    static std::string complexExpressions(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += "complex_" + n + " = (" + n + " * 3.14159) ^ 2 + fibonacci(" + n + " % 5)\n";
+        });
+    }
+
+    /**
+     * @brief Generates assignments of expressions nesting parenthesized groups
+     * @param lines The number of generated assignments
+     * @param depth The number of nested groups in each expression
+     * @return std::string The source
+     */
+    static std::string nestedExpressions(int lines, int depth) {
+        return repeat(lines, [depth](std::string& source, const std::string& n) {
+            source += "nested_" + n + " = " + std::string(static_cast<size_t>(depth), '(') + n;
+            for (int level = 0; level < depth; level++) {
+                source += level % 2 == 0 ? " + x_" : " * y_";
+                source += std::to_string(level) + ")";
+            }
+            source += "\n";
+        });
+    }
+
+    /**
+     * @brief Generates assignments of long operator chains alternating precedence levels
+     * @param lines The number of generated assignments
+     * @param length The number of binary operators in each expression
+     * @return std::string The source
+     */
+    static std::string chainedExpressions(int lines, int length) {
+        static constexpr const char* OPERATORS[] = {" + ", " * ", " - ", " / ", " ^ ", " % ", " < ", " and "};
+
+        return repeat(lines, [length](std::string& source, const std::string& n) {
+            source += "chain_" + n + " = " + n;
+            for (int i = 0; i < length; i++) {
+                source += OPERATORS[i % 8];
+                source += "v_" + std::to_string(i);
+            }
+            source += "\n";
+        });
+    }
+
+    /**
+     * @brief Generates interpolated strings
+     * @param lines The number of generated strings
+     * @return std::string The source
+     */
+    static std::string interpolations(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += "\"Item " + n + " is ${item_" + n + "} out of ${count} (${ratio}%)\"\n";
+        });
+    }
+
+    /**
+     * @brief Generates long template strings mixing text runs with many interpolations
+     * @param lines The number of generated strings
+     * @param fields The number of interpolations in each string
+     * @return std::string The source
+     */
+    static std::string templates(int lines, int fields) {
+        return repeat(lines, [fields](std::string& source, const std::string& n) {
+            source += "\"<div class=row-" + n + ">";
+            for (int i = 0; i < fields; i++) {
+                std::string field = std::to_string(i);
+                source += "<span class=field>label " + field + ": ${field_" + field + "}</span>";
+            }
+            source += "</div>\"\n";
+        });
+    }
+
+    /**
+     * @brief Generates load statements
+     * @param lines The number of generated statements
+     * @return std::string The source
+     */
+    static std::string loads(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += "load \"modules/module_" + n + ".op\"\n";
+        });
+    }
+
+    /**
+     * @brief Generates function declarations whose bodies are assignments
+     * @param lines The number of generated functions
+     * @param bodyLines The number of statements in each body
+     * @return std::string The source
+     */
+    static std::string functions(int lines, int bodyLines) {
+        return repeat(lines, [bodyLines](std::string& source, const std::string& n) {
+            source += "fn handler_" + n + "(event, context) {\n";
+            for (int i = 0; i < bodyLines; i++) {
+                std::string line = std::to_string(i);
+                source += "    value_" + line + " = (event + " + n + ") * context - " + line + " / 4\n";
+            }
+            source += "}\n";
+        });
+    }
+
+    /**
+     * @brief Generates a program mixing every construct the parser currently accepts
+     * @param lines The number of generated blocks
+     * @return std::string The source
+     */
+    static std::string parseable(int lines) {
+        return repeat(lines, [](std::string& source, const std::string& n) {
+            source += "// Block " + n + "\n";
+            source += "count_" + n + " = " + n + "\n";
+            source += "ratio_" + n + " = (count_" + n + " + 3.5) * 2 - total / 4 % 7\n";
+            source += "label_" + n + " = \"Item " + n + " is ${count_" + n + "} of ${total}\"\n";
+            source += "alias_" + n + " = count_" + n + "\n";
+            source += "load \"modules/module_" + n + ".op\"\n";
+        });
+    }
+
+    /**
+     * @brief Reads the example programs shipped in docs/examples
+     * @return std::vector<std::pair<std::string, std::string>> The file stems and sources, sorted by stem
+     */
+    static std::vector<std::pair<std::string, std::string>> examples() {
+        std::vector<std::pair<std::string, std::string>> programs;
+        std::error_code                                  error;
+
+        for (const auto& entry : std::filesystem::directory_iterator(OPAL_EXAMPLES_DIR, error)) {
+            if (entry.path().extension() != ".op") {
+                continue;
+            }
+            std::ifstream     file(entry.path(), std::ios::binary);
+            std::stringstream content;
+            content << file.rdbuf();
+            programs.emplace_back(entry.path().stem().string(), content.str());
+        }
+
+        std::sort(programs.begin(), programs.end());
+        return programs;
+    }
+
+private:
+    /**
+     * @brief Builds a source by appending generated lines
+     * @param lines The number of times to call the generator
+     * @param line Appends one line to the source, given the line number as text
+     * @return std::string The source
+     */
+    template <typename LineFn>
+    static std::string repeat(int lines, LineFn line) {
+        std::string source;
+        source.reserve(static_cast<size_t>(lines) * 64);
+        for (int i = 0; i < lines; i++) {
+            line(source, std::to_string(i));
+        }
+        return source;
+    }
+};
+
+}  // namespace opal
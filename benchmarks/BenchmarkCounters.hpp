@@ -0,0 +1,90 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace opal {
+
+/**
+ * @class BenchmarkCounters
+ * @brief Reports throughput counters shared by the lexer and parser benchmarks
+ *
+ * Every benchmark reports the same counters so that their JSON output can be
+ * compared against a baseline by scripts/run_benchmarks.sh.
+ * This class cannot be instantiated.
+ */
+class BenchmarkCounters {
+private:
+    BenchmarkCounters()                                    = delete;
+    ~BenchmarkCounters()                                   = delete;
+    BenchmarkCounters(const BenchmarkCounters&)            = delete;
+    BenchmarkCounters& operator=(const BenchmarkCounters&) = delete;
+
+public:
+    /**
+     * @brief Reports the work done by each iteration of a benchmark
+     *
+     * Sets bytes/sec, tokens/sec and nodes/sec as rates over all iterations,
+     * and allocs_per_token from an allocation count measured on one run.
+     *
+     * @param state The benchmark state
+     * @param bytes The number of source bytes processed per iteration
+     * @param tokens The number of tokens produced or consumed per iteration
+     * @param nodes The number of AST nodes produced per iteration, 0 for lexer benchmarks
+     * @param allocations The number of heap allocations made by one iteration
+     */
+    static void report(benchmark::State& state, size_t bytes, size_t tokens, size_t nodes, uint64_t allocations) {
+        double iterations = static_cast<double>(state.iterations());
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+        state.counters["tokens"] = benchmark::Counter(iterations * static_cast<double>(tokens),
+                                                      benchmark::Counter::kIsRate);
+        if (nodes > 0) {
+            state.counters["nodes"] = benchmark::Counter(iterations * static_cast<double>(nodes),
+                                                         benchmark::Counter::kIsRate);
+        }
+        if (tokens > 0) {
+            state.counters["allocs_per_token"] = static_cast<double>(allocations) / static_cast<double>(tokens);
+        }
+    }
+
+    /**
+     * @brief Reports the work done by each iteration of a tree traversal benchmark
+     * @param state The benchmark state
+     * @param nodes The number of nodes visited per iteration
+     * @param footprint The number of bytes taken by the traversed representation
+     */
+    static void reportTraversal(benchmark::State& state, size_t nodes, size_t footprint) {
+        double iterations = static_cast<double>(state.iterations());
+
+        state.counters["nodes"] = benchmark::Counter(iterations * static_cast<double>(nodes),
+                                                     benchmark::Counter::kIsRate);
+        state.counters["footprint_bytes"] = static_cast<double>(footprint);
+        state.counters["bytes_per_node"]  = static_cast<double>(footprint) / static_cast<double>(nodes);
+    }
+};
+
+}  // namespace opal
@@ -0,0 +1,119 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "BenchmarkCorpus.hpp"
+#include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/SimdScanner.hpp"
+#include "opal/lexer/TokenBuffer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+void lexCorpus(benchmark::State& state, Lexer::DispatchMode mode) {
+    const std::string source     = BenchmarkCorpus::generate(static_cast<int>(state.range(0)));
+    size_t            tokenCount = 0;
+
+    for (auto _ : state) {
+        Lexer                     lexer(source, mode);
+        const std::vector<Token>& tokens = lexer.scanTokens();
+        tokenCount                       = tokens.size();
+        benchmark::DoNotOptimize(tokens.data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+    state.counters["tokens"] = static_cast<double>(tokenCount);
+}
+
+void BM_LexerLinearDispatch(benchmark::State& state) {
+    lexCorpus(state, Lexer::DispatchMode::LINEAR);
+}
+
+void BM_LexerTableDispatch(benchmark::State& state) {
+    lexCorpus(state, Lexer::DispatchMode::TABLE);
+}
+
+void BM_LexerScalarKernels(benchmark::State& state) {
+    SimdScanner::setLevel(SimdLevel::SCALAR);
+    lexCorpus(state, Lexer::DispatchMode::TABLE);
+    SimdScanner::setLevel(SimdScanner::detectLevel());
+}
+
+void BM_LexerTokenBuffer(benchmark::State& state) {
+    const std::string source      = BenchmarkCorpus::generate(static_cast<int>(state.range(0)));
+    size_t            memoryUsage = 0;
+
+    for (auto _ : state) {
+        Lexer       lexer(source);
+        TokenBuffer buffer = lexer.scanTokenBuffer();
+        memoryUsage        = buffer.memoryUsage();
+        benchmark::DoNotOptimize(buffer.size());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+    state.counters["token_bytes"] = static_cast<double>(memoryUsage);
+}
+
+void BM_TypeScanTokenVector(benchmark::State& state) {
+    const std::string  source = BenchmarkCorpus::generate(static_cast<int>(state.range(0)));
+    Lexer              lexer(source);
+    std::vector<Token> tokens = lexer.scanTokens();
+
+    for (auto _ : state) {
+        size_t identifiers = 0;
+        for (const Token& token : tokens) {
+            identifiers += token.type == TokenType::IDENTIFIER;
+        }
+        benchmark::DoNotOptimize(identifiers);
+    }
+
+    state.counters["token_bytes"] = static_cast<double>(tokens.size() * sizeof(Token));
+}
+
+void BM_TypeScanTokenBuffer(benchmark::State& state) {
+    const std::string source = BenchmarkCorpus::generate(static_cast<int>(state.range(0)));
+    Lexer             lexer(source);
+    TokenBuffer       buffer = lexer.scanTokenBuffer();
+
+    for (auto _ : state) {
+        size_t identifiers = 0;
+        for (size_t i = 0; i < buffer.size(); i++) {
+            identifiers += buffer.type(i) == TokenType::IDENTIFIER;
+        }
+        benchmark::DoNotOptimize(identifiers);
+    }
+
+    state.counters["token_bytes"] = static_cast<double>(buffer.memoryUsage());
+}
+
+}  // namespace
+
+BENCHMARK(BM_LexerLinearDispatch)->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LexerTableDispatch)->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LexerScalarKernels)->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LexerTokenBuffer)->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TypeScanTokenVector)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TypeScanTokenBuffer)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMicrosecond);
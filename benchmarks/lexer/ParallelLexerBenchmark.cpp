@@ -0,0 +1,57 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "BenchmarkCorpus.hpp"
+#include "opal/lexer/ParallelLexer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+void BM_ParallelLexer(benchmark::State& state) {
+    const std::string source      = BenchmarkCorpus::generate(static_cast<int>(state.range(0)));
+    const size_t      threadCount = static_cast<size_t>(state.range(1));
+    size_t            tokenCount  = 0;
+
+    for (auto _ : state) {
+        ParallelLexer      lexer(source, threadCount);
+        std::vector<Token> tokens = lexer.scanTokens();
+        tokenCount                = tokens.size();
+        benchmark::DoNotOptimize(tokens.data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+    state.counters["tokens"]  = static_cast<double>(tokenCount);
+    state.counters["threads"] = static_cast<double>(threadCount);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ParallelLexer)
+    ->ArgsProduct({{10000, 50000}, {1, 2, 4, 8}})
+    ->ArgNames({"size", "threads"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
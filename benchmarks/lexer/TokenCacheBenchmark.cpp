@@ -0,0 +1,73 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "BenchmarkCorpus.hpp"
+#include "opal/lexer/LineIndex.hpp"
+#include "opal/lexer/TokenCache.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+
+using namespace opal;
+
+namespace {
+
+const std::string CACHE_DIRECTORY = "token_cache_benchmark";
+
+void BM_TokenCacheCold(benchmark::State& state) {
+    const std::string source = BenchmarkCorpus::generate(static_cast<int>(state.range(0)));
+    LineIndex         lines(source);
+    TokenCache        cache(CACHE_DIRECTORY);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::filesystem::remove_all(CACHE_DIRECTORY);
+        state.ResumeTiming();
+
+        auto entry = cache.scan(source, lines);
+        benchmark::DoNotOptimize(entry->tokens.size());
+    }
+
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+}
+
+void BM_TokenCacheWarm(benchmark::State& state) {
+    const std::string source = BenchmarkCorpus::generate(static_cast<int>(state.range(0)));
+    LineIndex         lines(source);
+    TokenCache        cache(CACHE_DIRECTORY);
+    cache.scan(source, lines);
+
+    for (auto _ : state) {
+        auto entry = cache.scan(source, lines);
+        benchmark::DoNotOptimize(entry->tokens.size());
+    }
+
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_TokenCacheCold)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TokenCacheWarm)->Arg(50000)->Unit(benchmark::kMillisecond);
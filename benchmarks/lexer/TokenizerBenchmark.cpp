@@ -0,0 +1,78 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "AllocationCounter.hpp"
+#include "BenchmarkCorpus.hpp"
+#include "BenchmarkCounters.hpp"
+#include "opal/lexer/Lexer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+// Lexes a source made of one kind of lexeme, so that a single tokenizer does the work
+void lexConstruct(benchmark::State& state, const std::string& source) {
+    size_t   tokenCount  = 0;
+    uint64_t allocations = AllocationCounter::measure([&] {
+        Lexer lexer(source);
+        tokenCount = lexer.scanTokens().size();
+    });
+
+    for (auto _ : state) {
+        Lexer lexer(source);
+        benchmark::DoNotOptimize(lexer.scanTokens().data());
+    }
+
+    BenchmarkCounters::report(state, source.size(), tokenCount, 0, allocations);
+}
+
+void BM_IdentifierTokenizer(benchmark::State& state) {
+    lexConstruct(state, BenchmarkCorpus::identifiers(static_cast<int>(state.range(0))));
+}
+
+void BM_NumberTokenizer(benchmark::State& state) {
+    lexConstruct(state, BenchmarkCorpus::numbers(static_cast<int>(state.range(0))));
+}
+
+void BM_StringTokenizer(benchmark::State& state) {
+    lexConstruct(state, BenchmarkCorpus::strings(static_cast<int>(state.range(0))));
+}
+
+void BM_OperatorTokenizer(benchmark::State& state) {
+    lexConstruct(state, BenchmarkCorpus::operators(static_cast<int>(state.range(0))));
+}
+
+void BM_CommentTokenizer(benchmark::State& state) {
+    lexConstruct(state, BenchmarkCorpus::comments(static_cast<int>(state.range(0))));
+}
+
+}  // namespace
+
+BENCHMARK(BM_IdentifierTokenizer)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_NumberTokenizer)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StringTokenizer)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_OperatorTokenizer)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CommentTokenizer)->Arg(10000)->Unit(benchmark::kMicrosecond);
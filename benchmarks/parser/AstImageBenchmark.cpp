@@ -0,0 +1,97 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "BenchmarkCorpus.hpp"
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/flat/AstImage.hpp"
+#include "opal/parser/flat/FlatAstConverter.hpp"
+#include "opal/util/FileUtil.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+
+using namespace opal;
+
+namespace {
+
+const std::string SOURCE_PATH = "ast_image_benchmark.op";
+const std::string IMAGE_PATH  = "ast_image_benchmark" + std::string(AstImage::EXTENSION);
+
+// Writes a module and the image of its tree, returning the size of the source
+size_t writeModule(int lines) {
+    const std::string source = BenchmarkCorpus::parseable(lines);
+    FileUtil::writeFile(SOURCE_PATH, source);
+
+    Lexer   lexer(source);
+    Parser  parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    FlatAst ast = FlatAstConverter::convert(parser.getNodes());
+    AstImage::write(IMAGE_PATH, ast, &lexer.getLiterals(), &lexer.getSymbols());
+    return source.size();
+}
+
+void removeModule() {
+    std::error_code error;
+    std::filesystem::remove(SOURCE_PATH, error);
+    std::filesystem::remove(IMAGE_PATH, error);
+}
+
+// Reads, lexes and parses the module, what loading it costs without an image
+void BM_AstImageParseSource(benchmark::State& state) {
+    const size_t bytes = writeModule(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        std::string source = FileUtil::readFile(SOURCE_PATH);
+        Lexer       lexer(source);
+        Parser      parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+        benchmark::DoNotOptimize(parser.getNodes().data());
+    }
+
+    removeModule();
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+}
+
+// Maps and validates the image, then reads every top-level node in place
+void BM_AstImageMap(benchmark::State& state) {
+    const size_t bytes = writeModule(static_cast<int>(state.range(0)));
+    size_t       size  = 0;
+
+    for (auto _ : state) {
+        AstImage image = AstImage::open(IMAGE_PATH);
+        uint32_t kinds = 0;
+        for (uint32_t root : image.roots()) {
+            kinds += image.node(root).kind;
+        }
+        benchmark::DoNotOptimize(kinds);
+        size = image.bytesUsed();
+    }
+
+    removeModule();
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+    state.counters["image_bytes"] = static_cast<double>(size);
+}
+
+}  // namespace
+
+BENCHMARK(BM_AstImageParseSource)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AstImageMap)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,125 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "AllocationCounter.hpp"
+#include "BenchmarkCorpus.hpp"
+#include "BenchmarkCounters.hpp"
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/AstArena.hpp"
+#include "opal/parser/atomizer/atomizers/ExpressionAtomizer.hpp"
+#include "opal/parser/atomizer/atomizers/LoadAtomizer.hpp"
+#include "opal/parser/atomizer/atomizers/OperationAtomizer.hpp"
+#include "opal/parser/atomizer/atomizers/StringAtomizer.hpp"
+#include "opal/parser/atomizer/atomizers/VariableAtomizer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+// Runs a single atomizer over pre-lexed tokens, skipping the tokens it cannot handle like the parser does
+template <typename Atomizer>
+void atomizeConstruct(benchmark::State& state, const std::string& source) {
+    Lexer              lexer(source);
+    std::vector<Token> tokens  = lexer.scanTokens();
+    size_t             current = 0;
+    AstArena           arena;
+    Atomizer           atomizer(current, tokens);
+    atomizer.setLiterals(&lexer.getLiterals());
+    atomizer.setSymbols(&lexer.getSymbols());
+    atomizer.setArena(&arena);
+
+    auto run = [&] {
+        size_t nodes = 0;
+        current      = 0;
+        arena.clear();
+        while (tokens[current].type != TokenType::EOF_TOKEN) {
+            if (!atomizer.canHandle(tokens[current].type)) {
+                current++;
+                continue;
+            }
+            nodes += atomizer.atomize() != nullptr;
+        }
+        return nodes;
+    };
+
+    size_t   nodeCount   = 0;
+    uint64_t allocations = AllocationCounter::measure([&] { nodeCount = run(); });
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(run());
+    }
+
+    BenchmarkCounters::report(state, source.size(), tokens.size(), nodeCount, allocations);
+}
+
+void BM_VariableAtomizer(benchmark::State& state) {
+    atomizeConstruct<VariableAtomizer>(state, BenchmarkCorpus::assignments(static_cast<int>(state.range(0))));
+}
+
+void BM_OperationAtomizer(benchmark::State& state) {
+    atomizeConstruct<OperationAtomizer>(state, BenchmarkCorpus::operations(static_cast<int>(state.range(0))));
+}
+
+void BM_ComplexExpression(benchmark::State& state) {
+    atomizeConstruct<ExpressionAtomizer>(state,
+                                         BenchmarkCorpus::complexExpressions(static_cast<int>(state.range(0))));
+}
+
+void BM_NestedExpression(benchmark::State& state) {
+    atomizeConstruct<ExpressionAtomizer>(
+        state,
+        BenchmarkCorpus::nestedExpressions(static_cast<int>(state.range(0)), static_cast<int>(state.range(1))));
+}
+
+void BM_ChainedExpression(benchmark::State& state) {
+    atomizeConstruct<ExpressionAtomizer>(
+        state,
+        BenchmarkCorpus::chainedExpressions(static_cast<int>(state.range(0)), static_cast<int>(state.range(1))));
+}
+
+void BM_StringAtomizer(benchmark::State& state) {
+    atomizeConstruct<StringAtomizer>(state, BenchmarkCorpus::interpolations(static_cast<int>(state.range(0))));
+}
+
+void BM_TemplateString(benchmark::State& state) {
+    atomizeConstruct<StringAtomizer>(
+        state, BenchmarkCorpus::templates(static_cast<int>(state.range(0)), static_cast<int>(state.range(1))));
+}
+
+void BM_LoadAtomizer(benchmark::State& state) {
+    atomizeConstruct<LoadAtomizer>(state, BenchmarkCorpus::loads(static_cast<int>(state.range(0))));
+}
+
+}  // namespace
+
+BENCHMARK(BM_VariableAtomizer)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_OperationAtomizer)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ComplexExpression)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_NestedExpression)->Args({2000, 8})->Args({2000, 64})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ChainedExpression)->Args({2000, 16})->Args({2000, 128})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StringAtomizer)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TemplateString)->Args({1000, 4})->Args({1000, 64})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_LoadAtomizer)->Arg(10000)->Unit(benchmark::kMicrosecond);
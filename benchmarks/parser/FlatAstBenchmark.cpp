@@ -0,0 +1,175 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "BenchmarkCorpus.hpp"
+#include "BenchmarkCounters.hpp"
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/flat/FlatAst.hpp"
+#include "opal/parser/flat/FlatAstConverter.hpp"
+#include "opal/parser/flat/FlatAstVisitor.hpp"
+#include "opal/parser/node/nodes/BinaryNode.hpp"
+#include "opal/parser/node/nodes/CallNode.hpp"
+#include "opal/parser/node/nodes/OperationNode.hpp"
+#include "opal/parser/node/nodes/UnaryNode.hpp"
+#include "opal/parser/node/nodes/VariableNode.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace opal;
+
+namespace {
+
+// Statements of every kind plus expression-heavy assignments, so that most nodes are expression nodes
+std::string traversalCorpus(int lines) {
+    return BenchmarkCorpus::parseable(lines) + BenchmarkCorpus::complexExpressions(lines);
+}
+
+// Sums the token types of a pointer tree, following its children the way a tree-walking tool would
+uint64_t walkTree(const NodeBase* node, size_t& visited) {
+    visited++;
+    uint64_t sum = static_cast<uint64_t>(node->getTokenType());
+
+    switch (node->getNodeType()) {
+        case NodeType::VARIABLE: {
+            const auto* variable = static_cast<const VariableNode*>(node);
+            if (variable->getOperation()) {
+                sum += walkTree(variable->getOperation(), visited);
+            }
+            if (variable->getStringNode()) {
+                sum += walkTree(variable->getStringNode(), visited);
+            }
+            break;
+        }
+        case NodeType::OPERATION:
+            if (const NodeBase* expression = static_cast<const OperationNode*>(node)->getExpression()) {
+                sum += walkTree(expression, visited);
+            }
+            break;
+        case NodeType::UNARY:
+            sum += walkTree(static_cast<const UnaryNode*>(node)->getOperand(), visited);
+            break;
+        case NodeType::BINARY:
+            sum += walkTree(static_cast<const BinaryNode*>(node)->getLeft(), visited);
+            sum += walkTree(static_cast<const BinaryNode*>(node)->getRight(), visited);
+            break;
+        case NodeType::CALL:
+            sum += walkTree(static_cast<const CallNode*>(node)->getCallee(), visited);
+            for (const NodeBase* argument : static_cast<const CallNode*>(node)->getArguments()) {
+                sum += walkTree(argument, visited);
+            }
+            break;
+        default:
+            break;
+    }
+    return sum;
+}
+
+// Sums the token types of a flat tree through the visitor interface
+class TokenTypeSummer : public FlatAstVisitor {
+public:
+    uint64_t sum     = 0;
+    size_t   visited = 0;
+
+    bool enter(const FlatAst& ast, uint32_t id) override {
+        visited++;
+        sum += static_cast<uint64_t>(ast.node(id).token);
+        return true;
+    }
+};
+
+void BM_TreeWalk(benchmark::State& state) {
+    const std::string source = traversalCorpus(static_cast<int>(state.range(0)));
+    Lexer             lexer(source);
+    Parser            parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    size_t            visited = 0;
+
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        visited      = 0;
+        for (const NodeBase* node : parser.getNodes()) {
+            sum += walkTree(node, visited);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    BenchmarkCounters::reportTraversal(state, visited, parser.getArena().bytesUsed());
+}
+
+void BM_FlatWalk(benchmark::State& state) {
+    const std::string source = traversalCorpus(static_cast<int>(state.range(0)));
+    Lexer             lexer(source);
+    Parser            parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    FlatAst           ast = FlatAstConverter::convert(parser.getNodes());
+
+    for (auto _ : state) {
+        TokenTypeSummer summer;
+        ast.walk(summer);
+        benchmark::DoNotOptimize(summer.sum);
+    }
+
+    BenchmarkCounters::reportTraversal(state, ast.size(), ast.bytesUsed());
+}
+
+// Visits every node without following children, which only the contiguous pre-order layout allows
+void BM_FlatScan(benchmark::State& state) {
+    const std::string source = traversalCorpus(static_cast<int>(state.range(0)));
+    Lexer             lexer(source);
+    Parser            parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    FlatAst           ast = FlatAstConverter::convert(parser.getNodes());
+
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const FlatNode& node : ast.nodes()) {
+            sum += static_cast<uint64_t>(node.token);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    BenchmarkCounters::reportTraversal(state, ast.size(), ast.bytesUsed());
+}
+
+void BM_FlatConvert(benchmark::State& state) {
+    const std::string source = traversalCorpus(static_cast<int>(state.range(0)));
+    Lexer             lexer(source);
+    Parser            parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    size_t            nodes     = 0;
+    size_t            footprint = 0;
+
+    for (auto _ : state) {
+        FlatAst ast = FlatAstConverter::convert(parser.getNodes());
+        nodes       = ast.size();
+        footprint   = ast.bytesUsed();
+        benchmark::DoNotOptimize(ast.nodes().data());
+    }
+
+    BenchmarkCounters::reportTraversal(state, nodes, footprint);
+}
+
+}  // namespace
+
+BENCHMARK(BM_TreeWalk)->Arg(1000)->Arg(50000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FlatWalk)->Arg(1000)->Arg(50000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FlatScan)->Arg(1000)->Arg(50000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FlatConvert)->Arg(1000)->Arg(50000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,73 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "BenchmarkCorpus.hpp"
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+constexpr int BODY_LINES = 20;
+
+// Parses the module with every function body left as a token range
+void BM_FunctionParseLazy(benchmark::State& state) {
+    const std::string  source = BenchmarkCorpus::functions(static_cast<int>(state.range(0)), BODY_LINES);
+    Lexer              lexer(source);
+    std::vector<Token> tokens = lexer.scanTokens();
+    size_t             bytes  = 0;
+
+    for (auto _ : state) {
+        Parser parser(tokens, &lexer.getLiterals(), &lexer.getSymbols());
+        benchmark::DoNotOptimize(parser.getNodes().data());
+        bytes = parser.getArena().bytesUsed();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+    state.counters["arena_bytes"] = static_cast<double>(bytes);
+}
+
+// Parses the module and then every function body, what an eager parse costs
+void BM_FunctionParseEager(benchmark::State& state) {
+    const std::string  source = BenchmarkCorpus::functions(static_cast<int>(state.range(0)), BODY_LINES);
+    Lexer              lexer(source);
+    std::vector<Token> tokens = lexer.scanTokens();
+    size_t             bytes  = 0;
+
+    for (auto _ : state) {
+        Parser parser(tokens, &lexer.getLiterals(), &lexer.getSymbols());
+        benchmark::DoNotOptimize(parser.parseFunctionBodies());
+        bytes = parser.getArena().bytesUsed();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+    state.counters["arena_bytes"] = static_cast<double>(bytes);
+}
+
+}  // namespace
+
+BENCHMARK(BM_FunctionParseLazy)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FunctionParseEager)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,79 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "BenchmarkCorpus.hpp"
+#include "opal/parser/IncrementalParser.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace opal;
+
+namespace {
+
+// Toggles a literal in the middle of the source back and forth, an edit within a line
+void BM_IncrementalEditInLine(benchmark::State& state) {
+    const std::string source = BenchmarkCorpus::parseable(static_cast<int>(state.range(0)));
+    IncrementalParser parser(source);
+    const size_t      offset = source.find(" = ", source.size() / 2) + 3;
+    size_t            tokens = 0;
+
+    for (auto _ : state) {
+        tokens += parser.edit(offset, 0, "1").relexedTokens;
+        tokens += parser.edit(offset, 1, "").relexedTokens;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2);
+    state.counters["relexed"] = benchmark::Counter(static_cast<double>(tokens), benchmark::Counter::kAvgIterations);
+}
+
+// Inserts and removes a line break in the middle of the source, which shifts the lines of every later statement
+void BM_IncrementalEditLineBreak(benchmark::State& state) {
+    const std::string source = BenchmarkCorpus::parseable(static_cast<int>(state.range(0)));
+    IncrementalParser parser(source);
+    const size_t      offset = source.find('\n', source.size() / 2) + 1;
+
+    for (auto _ : state) {
+        parser.edit(offset, 0, "\n");
+        parser.edit(offset, 1, "");
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 2);
+}
+
+// Lexes and parses the whole source, what every edit costs without the incremental parser
+void BM_IncrementalInitialParse(benchmark::State& state) {
+    const std::string source = BenchmarkCorpus::parseable(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        IncrementalParser parser(source);
+        benchmark::DoNotOptimize(parser.getSegmentCount());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_IncrementalEditInLine)->Arg(2000)->Arg(20000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_IncrementalEditLineBreak)->Arg(2000)->Arg(20000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_IncrementalInitialParse)->Arg(2000)->Arg(20000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,105 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "BenchmarkCorpus.hpp"
+#include "opal/parser/ModuleLoader.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace opal;
+
+namespace {
+
+const std::filesystem::path MODULE_DIRECTORY = "module_loader_benchmark";
+
+/**
+ * @brief Writes a layered module graph where every module loads three of the next layer
+ *
+ * Modules of a layer are shared by several loaders, so most are reached
+ * through many paths.
+ *
+ * @return std::string The path of the entry module
+ */
+std::string writeGraph(int layers, int width, int lines) {
+    std::filesystem::remove_all(MODULE_DIRECTORY);
+    std::filesystem::create_directories(MODULE_DIRECTORY);
+
+    // The corpus loads modules of its own, which the graph replaces
+    std::string body = BenchmarkCorpus::parseable(lines);
+    for (size_t load = body.find("load "); load != std::string::npos; load = body.find("load ", load)) {
+        body.erase(load, body.find('\n', load) + 1 - load);
+    }
+
+    for (int layer = 0; layer < layers; layer++) {
+        for (int i = 0; i < width; i++) {
+            std::ofstream module(MODULE_DIRECTORY / ("m_" + std::to_string(layer) + "_" + std::to_string(i) + ".op"));
+            for (int k = 0; layer + 1 < layers && k < 3; k++) {
+                module << "load \"m_" << layer + 1 << "_" << (i + k) % width << ".op\"\n";
+            }
+            module << body;
+        }
+    }
+
+    std::ofstream entry(MODULE_DIRECTORY / "main.op");
+    for (int i = 0; i < width; i++) {
+        entry << "load \"m_0_" << i << ".op\"\n";
+    }
+    return (MODULE_DIRECTORY / "main.op").string();
+}
+
+// Loads the whole graph into a fresh loader, every module being lexed and parsed
+void BM_ModuleLoaderCold(benchmark::State& state) {
+    const std::string entry   = writeGraph(4, 16, 500);
+    size_t            modules = 0;
+
+    for (auto _ : state) {
+        ModuleLoader loader(static_cast<size_t>(state.range(0)));
+        loader.load(entry);
+        modules = loader.getLoadOrder().size();
+    }
+
+    std::filesystem::remove_all(MODULE_DIRECTORY);
+    state.counters["modules"] = static_cast<double>(modules);
+    state.counters["threads"] = static_cast<double>(state.range(0));
+}
+
+// Loads the graph again into the same loader, every module coming from the cache
+void BM_ModuleLoaderWarm(benchmark::State& state) {
+    const std::string entry = writeGraph(4, 16, 500);
+    ModuleLoader      loader(static_cast<size_t>(state.range(0)));
+    loader.load(entry);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(loader.load(entry));
+    }
+
+    std::filesystem::remove_all(MODULE_DIRECTORY);
+    state.counters["modules"] = static_cast<double>(loader.getLoadOrder().size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ModuleLoaderCold)->Arg(1)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ModuleLoaderWarm)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
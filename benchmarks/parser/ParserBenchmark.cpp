@@ -0,0 +1,146 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "AllocationCounter.hpp"
+#include "BenchmarkCorpus.hpp"
+#include "BenchmarkCounters.hpp"
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+struct ParseResult {
+    size_t tokens = 0;
+    size_t nodes  = 0;
+};
+
+ParseResult lexAndParse(const std::string& source) {
+    Lexer       lexer(source);
+    ParseResult result;
+    result.tokens = lexer.scanTokens().size();
+
+    Parser parser(lexer.releaseTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    result.nodes = parser.getNodes().size();
+    return result;
+}
+
+void lexParseSource(benchmark::State& state, const std::string& source) {
+    ParseResult result;
+    uint64_t    allocations = 0;
+
+    try {
+        allocations = AllocationCounter::measure([&] { result = lexAndParse(source); });
+    } catch (const std::runtime_error& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lexAndParse(source));
+    }
+
+    BenchmarkCounters::report(state, source.size(), result.tokens, result.nodes, allocations);
+}
+
+void BM_ParseCorpus(benchmark::State& state) {
+    const std::string  source = BenchmarkCorpus::parseable(static_cast<int>(state.range(0)));
+    Lexer              lexer(source);
+    std::vector<Token> tokens    = lexer.scanTokens();
+    size_t             nodeCount = 0;
+
+    uint64_t allocations = AllocationCounter::measure([&] {
+        Parser parser(tokens, &lexer.getLiterals(), &lexer.getSymbols());
+        nodeCount = parser.getNodes().size();
+    });
+
+    for (auto _ : state) {
+        Parser parser(tokens, &lexer.getLiterals(), &lexer.getSymbols());
+        benchmark::DoNotOptimize(parser.getNodes().data());
+    }
+
+    BenchmarkCounters::report(state, source.size(), tokens.size(), nodeCount, allocations);
+}
+
+// Times the destruction of a parse session alone, which releases the whole tree
+void BM_ParserTeardown(benchmark::State& state) {
+    const std::string  source = BenchmarkCorpus::parseable(static_cast<int>(state.range(0)));
+    Lexer              lexer(source);
+    std::vector<Token> tokens = lexer.scanTokens();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto parser = std::make_unique<Parser>(tokens, &lexer.getLiterals(), &lexer.getSymbols());
+        state.ResumeTiming();
+
+        parser.reset();
+    }
+}
+
+// Lexes without parsing, recovering from invalid lexemes, so that every example gets a number
+void lexSource(benchmark::State& state, const std::string& source) {
+    size_t   tokenCount  = 0;
+    uint64_t allocations = AllocationCounter::measure([&] {
+        Lexer lexer(source);
+        lexer.setErrorMode(Lexer::ErrorMode::RECOVER);
+        tokenCount = lexer.scanTokens().size();
+    });
+
+    for (auto _ : state) {
+        Lexer lexer(source);
+        lexer.setErrorMode(Lexer::ErrorMode::RECOVER);
+        benchmark::DoNotOptimize(lexer.scanTokens().data());
+    }
+
+    BenchmarkCounters::report(state, source.size(), tokenCount, 0, allocations);
+}
+
+void BM_LexParseCorpus(benchmark::State& state) {
+    lexParseSource(state, BenchmarkCorpus::parseable(static_cast<int>(state.range(0))));
+}
+
+// Registers end-to-end benchmarks per program in docs/examples, named after the file. Examples using
+// constructs the parser does not handle yet report the parse error instead of a timing.
+const bool examplesRegistered = [] {
+    for (const auto& [name, source] : BenchmarkCorpus::examples()) {
+        benchmark::RegisterBenchmark(("BM_LexExample/" + name).c_str(),
+                                     [source](benchmark::State& state) { lexSource(state, source); })
+            ->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark(("BM_LexParseExample/" + name).c_str(),
+                                     [source](benchmark::State& state) { lexParseSource(state, source); })
+            ->Unit(benchmark::kMicrosecond);
+    }
+    return true;
+}();
+
+}  // namespace
+
+BENCHMARK(BM_LexParseCorpus)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParseCorpus)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParserTeardown)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
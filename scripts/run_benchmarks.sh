@@ -0,0 +1,114 @@
+#!/bin/bash
+
+RED='\033[0;31m'
+GREEN='\033[0;32m'
+YELLOW='\033[1;33m'
+BLUE='\033[0;34m'
+NC='\033[0m'
+
+OUTPUT_DIR="benchmark_results"
+RESULT_FILE="$OUTPUT_DIR/opal_bench.json"
+FILTER="."
+THRESHOLD=10
+BASELINE=""
+SAVE=""
+
+usage() {
+    echo "Usage: $0 [--filter REGEX] [--baseline FILE] [--threshold PERCENT] [--save FILE]"
+    echo "  --filter REGEX       Only run the benchmarks matching REGEX"
+    echo "  --baseline FILE      Compare the run against a JSON baseline saved earlier"
+    echo "  --threshold PERCENT  Slowdown tolerated before a benchmark counts as a regression (default: $THRESHOLD)"
+    echo "  --save FILE          Save the run as a new JSON baseline"
+}
+
+while [ $# -gt 0 ]; do
+    case "$1" in
+        --filter) FILTER="$2"; shift 2 ;;
+        --baseline) BASELINE="$2"; shift 2 ;;
+        --threshold) THRESHOLD="$2"; shift 2 ;;
+        --save) SAVE="$2"; shift 2 ;;
+        -h|--help) usage; exit 0 ;;
+        *) usage; exit 1 ;;
+    esac
+done
+
+if [ ! -x "./bin/opal_bench" ]; then
+    echo -e "${RED}❌ ./bin/opal_bench not found. Install Google Benchmark and run ./scripts/build.sh first${NC}"
+    exit 1
+fi
+
+if [ -n "$BASELINE" ] && [ ! -f "$BASELINE" ]; then
+    echo -e "${RED}❌ Baseline file does not exist: $BASELINE${NC}"
+    exit 1
+fi
+
+mkdir -p "$OUTPUT_DIR"
+
+echo -e "${BLUE}🚀 Running opal_bench...${NC}"
+./bin/opal_bench --benchmark_filter="$FILTER" \
+                 --benchmark_out="$RESULT_FILE" \
+                 --benchmark_out_format=json || {
+    echo -e "${RED}❌ opal_bench failed${NC}"
+    exit 1
+}
+
+if [ -n "$SAVE" ]; then
+    cp "$RESULT_FILE" "$SAVE"
+    echo -e "${GREEN}💾 Baseline saved to $SAVE${NC}"
+fi
+
+if [ -z "$BASELINE" ]; then
+    echo -e "${GREEN}✨ Results available in $RESULT_FILE${NC}"
+    exit 0
+fi
+
+echo -e "${BLUE}📊 Comparing against $BASELINE (threshold: ${THRESHOLD}%)...${NC}"
+
+# A benchmark regresses when its CPU time or its allocations per token grow past the threshold
+python3 - "$BASELINE" "$RESULT_FILE" "$THRESHOLD" <<'PYEOF'
+import json
+import sys
+
+baseline_path, current_path, threshold = sys.argv[1], sys.argv[2], float(sys.argv[3]) / 100.0
+
+
+def load(path):
+    with open(path) as f:
+        runs = json.load(f)["benchmarks"]
+    return {run["name"]: run for run in runs if run.get("run_type", "iteration") == "iteration" and not run.get("error_occurred")}
+
+
+baseline = load(baseline_path)
+current  = load(current_path)
+regressions = 0
+
+print(f"{'Benchmark':<48} {'Baseline':>12} {'Current':>12} {'Change':>9}")
+for name, run in current.items():
+    if name not in baseline:
+        print(f"{name:<48} {'-':>12} {run['cpu_time']:>12.3f} {'new':>9}")
+        continue
+
+    before = baseline[name]
+    change = run["cpu_time"] / before["cpu_time"] - 1.0 if before["cpu_time"] > 0 else 0.0
+    marker = ""
+    if change > threshold:
+        marker = "  REGRESSION"
+        regressions += 1
+
+    allocs_before = before.get("allocs_per_token")
+    allocs_after  = run.get("allocs_per_token")
+    if allocs_before is not None and allocs_after is not None and allocs_after > allocs_before * (1.0 + threshold) + 1e-9:
+        marker += f"  ALLOCS {allocs_before:.3f} -> {allocs_after:.3f}"
+        regressions += 1
+
+    print(f"{name:<48} {before['cpu_time']:>12.3f} {run['cpu_time']:>12.3f} {change:>+8.1%}{marker}")
+
+sys.exit(1 if regressions else 0)
+PYEOF
+
+if [ $? -ne 0 ]; then
+    echo -e "${RED}❌ Performance regressions detected${NC}"
+    exit 1
+fi
+
+echo -e "${GREEN}✅ No regression above ${THRESHOLD}%${NC}"
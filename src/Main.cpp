@@ -20,13 +20,18 @@
  */
 
 #include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/LineIndex.hpp"
+#include "opal/lexer/TokenCache.hpp"
 #include "opal/parser/Parser.hpp"
 #include "opal/repl/Repl.hpp"
 #include "opal/util/FileUtil.hpp"
+#include "opal/util/MappedFile.hpp"
 
 #include <spdlog/spdlog.h>
 
+#include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <string>
 
 int main(int argc, char* argv[]) {
@@ -49,9 +54,25 @@ int main(int argc, char* argv[]) {
                 return 1;
             }
 
-            std::string              sourceCode = opal::FileUtil::readFile(argv[1]);
-            opal::Lexer              lexer(sourceCode);
-            std::vector<opal::Token> tokens = lexer.scanTokens();
+            opal::MappedFile sourceCode = opal::FileUtil::mapFile(argv[1]);
+
+            // Opt-in token cache, keyed by the source content
+            if (const char* cacheDirectory = std::getenv("OPAL_TOKEN_CACHE")) {
+                opal::LineIndex                          lines(sourceCode.view());
+                opal::TokenCache                         cache(cacheDirectory);
+                std::unique_ptr<opal::TokenCache::Entry> entry = cache.scan(sourceCode.view(), lines);
+
+                spdlog::info("Tokenized file through cache: {} ({} tokens)", argv[1], entry->tokens.size());
+                spdlog::info("Generating AST:");
+                spdlog::info("----------------------------------------");
+                opal::Parser parser(entry->tokens);
+                parser.printAST();
+                spdlog::info("----------------------------------------");
+                return 0;
+            }
+
+            opal::Lexer lexer(sourceCode.view());
+            lexer.scanTokens();
 
             spdlog::info("Tokenizing file: {}", argv[1]);
             spdlog::info("----------------------------------------");
@@ -60,7 +81,7 @@ int main(int argc, char* argv[]) {
 
             spdlog::info("Generating AST:");
             spdlog::info("----------------------------------------");
-            opal::Parser parser(tokens);
+            opal::Parser parser(lexer.releaseTokens(), &lexer.getLiterals(), &lexer.getSymbols());
             parser.printAST();
             spdlog::info("----------------------------------------");
         }
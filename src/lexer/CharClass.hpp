@@ -0,0 +1,105 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace opal {
+
+/**
+ * @enum CharClass
+ * @brief Classifies the first character of a lexeme
+ *
+ * Each class maps to exactly one scanning routine in the lexer, so a single
+ * table lookup replaces probing every tokenizer in turn.
+ */
+enum class CharClass : uint8_t {
+    INVALID,
+    WHITESPACE,
+    NEWLINE,
+    DIGIT,
+    IDENTIFIER,
+    QUOTE,
+    SLASH,
+    OPERATOR,
+    COUNT
+};
+
+/**
+ * @brief Number of entries in a table indexed by CharClass
+ */
+inline constexpr size_t CHAR_CLASS_COUNT = static_cast<size_t>(CharClass::COUNT);
+
+/**
+ * @brief Builds the 256-entry character class table at compile time
+ * @return std::array<CharClass, 256> The class of every byte value
+ */
+constexpr std::array<CharClass, 256> makeCharClassTable() {
+    std::array<CharClass, 256> table{};
+
+    for (CharClass& entry : table) {
+        entry = CharClass::INVALID;
+    }
+
+    table[static_cast<unsigned char>(' ')]  = CharClass::WHITESPACE;
+    table[static_cast<unsigned char>('\t')] = CharClass::WHITESPACE;
+    table[static_cast<unsigned char>('\r')] = CharClass::WHITESPACE;
+    table[static_cast<unsigned char>('\n')] = CharClass::NEWLINE;
+    table[static_cast<unsigned char>('"')]  = CharClass::QUOTE;
+    table[static_cast<unsigned char>('/')]  = CharClass::SLASH;
+
+    for (char c = '0'; c <= '9'; c++) {
+        table[static_cast<unsigned char>(c)] = CharClass::DIGIT;
+    }
+    for (char c = 'a'; c <= 'z'; c++) {
+        table[static_cast<unsigned char>(c)] = CharClass::IDENTIFIER;
+    }
+    for (char c = 'A'; c <= 'Z'; c++) {
+        table[static_cast<unsigned char>(c)] = CharClass::IDENTIFIER;
+    }
+    table[static_cast<unsigned char>('_')] = CharClass::IDENTIFIER;
+
+    for (char c : {'(', ')', '{', '}', '[', ']', ',', '.', ':', ';', '+', '-',
+                   '*', '%', '^', '=', '!', '<', '>', '&', '|', '~', '#'}) {
+        table[static_cast<unsigned char>(c)] = CharClass::OPERATOR;
+    }
+
+    return table;
+}
+
+/**
+ * @brief Character class of every byte value
+ */
+inline constexpr std::array<CharClass, 256> CHAR_CLASS_TABLE = makeCharClassTable();
+
+/**
+ * @brief Looks up the class of a character
+ * @param c The character to classify
+ * @return CharClass The class of the character
+ */
+constexpr CharClass charClassOf(char c) {
+    return CHAR_CLASS_TABLE[static_cast<unsigned char>(c)];
+}
+
+}  // namespace opal
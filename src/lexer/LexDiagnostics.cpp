@@ -0,0 +1,51 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/LexDiagnostics.hpp"
+
+#include "opal/util/ErrorUtil.hpp"
+
+using namespace opal;
+
+std::string_view LexDiagnostics::describe(LexErrorKind kind) {
+    switch (kind) {
+        case LexErrorKind::INVALID_CHARACTER:
+            return "Invalid character";
+        case LexErrorKind::UNTERMINATED_STRING:
+            return "Unterminated string";
+        case LexErrorKind::UNTERMINATED_COMMENT:
+            return "Unterminated multi-line comment";
+    }
+    return "Lexical error";
+}
+
+std::string LexDiagnostics::format(const LexDiagnostic& diagnostic, std::string_view source, const LineIndex& lines) {
+    std::string message(describe(diagnostic.kind));
+    if (diagnostic.kind == LexErrorKind::INVALID_CHARACTER && diagnostic.offset < source.size()) {
+        message += " '" + std::string(1, source[diagnostic.offset]) + "'";
+    }
+    return ErrorUtil::errorMessage(message, lines, diagnostic.offset);
+}
+
+uint32_t LexDiagnostics::add(LexErrorKind kind, size_t offset, size_t length) {
+    this->_records.push_back({kind, static_cast<uint32_t>(offset), static_cast<uint32_t>(length)});
+    return static_cast<uint32_t>(this->_records.size() - 1);
+}
@@ -0,0 +1,139 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/LineIndex.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @enum LexErrorKind
+ * @brief Kinds of lexical errors
+ */
+enum class LexErrorKind : uint8_t { INVALID_CHARACTER, UNTERMINATED_STRING, UNTERMINATED_COMMENT };
+
+/**
+ * @struct LexDiagnostic
+ * @brief Compact record of one lexical error
+ *
+ * Only the kind and the byte range of the offending lexeme are stored, the
+ * message is built on demand through LexDiagnostics::format.
+ */
+struct LexDiagnostic {
+    LexErrorKind kind;
+    uint32_t     offset;  ///< Offset of the first byte of the offending lexeme
+    uint32_t     length;  ///< Length of the offending lexeme, as covered by its ERROR token
+};
+
+/**
+ * @class LexDiagnostics
+ * @brief Collects the lexical errors of a scan
+ *
+ * When recovering, tokenizers record each error here and emit an ERROR token
+ * whose payload is the index of the record, then carry on scanning. Otherwise
+ * the first error is thrown as it always was.
+ */
+class LexDiagnostics {
+private:
+    bool                       _recovering = false;
+    std::vector<LexDiagnostic> _records;
+
+public:
+    /**
+     * @brief Gets the message of an error kind
+     * @param kind The error kind
+     * @return std::string_view The message, without location
+     */
+    static std::string_view describe(LexErrorKind kind);
+
+    /**
+     * @brief Formats the full message of a diagnostic
+     *
+     * Produces the same text as the exception thrown for the error when not
+     * recovering.
+     *
+     * @param diagnostic The diagnostic to format
+     * @param source The source the diagnostic refers to
+     * @param lines The line index of the source
+     * @return std::string The message with the line and column of the error
+     */
+    static std::string format(const LexDiagnostic& diagnostic, std::string_view source, const LineIndex& lines);
+
+    /**
+     * @brief Checks whether errors are recorded instead of thrown
+     * @return bool True when recovering, false otherwise
+     */
+    bool recovering() const { return _recovering; }
+
+    /**
+     * @brief Selects whether errors are recorded instead of thrown
+     * @param recovering True to record errors and keep scanning
+     */
+    void setRecovering(bool recovering) { _recovering = recovering; }
+
+    /**
+     * @brief Records an error
+     * @param kind The error kind
+     * @param offset Offset of the first byte of the offending lexeme
+     * @param length Length of the offending lexeme
+     * @return uint32_t The index of the record
+     */
+    uint32_t add(LexErrorKind kind, size_t offset, size_t length);
+
+    /**
+     * @brief Gets a record by index
+     * @param index The index returned by add
+     * @return const LexDiagnostic& The record
+     */
+    const LexDiagnostic& get(uint32_t index) const { return _records[index]; }
+
+    /**
+     * @brief Gets every record in the order the errors were found
+     * @return const std::vector<LexDiagnostic>& The records
+     */
+    const std::vector<LexDiagnostic>& records() const { return _records; }
+
+    /**
+     * @brief Gets the number of records
+     * @return size_t The error count
+     */
+    size_t size() const { return _records.size(); }
+
+    /**
+     * @brief Checks whether no error was recorded
+     * @return bool True if there is no record, false otherwise
+     */
+    bool empty() const { return _records.empty(); }
+
+    /**
+     * @brief Removes every record, keeping the recovery setting
+     */
+    void clear() { _records.clear(); }
+};
+
+}  // namespace opal
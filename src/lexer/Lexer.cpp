@@ -21,63 +21,244 @@
 
 #include "opal/lexer/Lexer.hpp"
 
-#include "opal/util/ErrorUtil.hpp"
+#include "opal/lexer/SimdScanner.hpp"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 
 using namespace opal;
 
-Lexer::Lexer(std::string source) : _source(std::move(source)) {
+namespace {
+
+// Diagnostics and token buffers store 32-bit offsets into the source
+std::string_view checkedSource(std::string_view source) {
+    if (source.size() > Lexer::MAX_SOURCE_SIZE) {
+        throw std::runtime_error("Source of " + std::to_string(source.size()) + " bytes exceeds the lexer limit of " +
+                                 std::to_string(Lexer::MAX_SOURCE_SIZE) + " bytes");
+    }
+    return source;
+}
+
+}  // namespace
+
+Lexer::Lexer(std::string source, DispatchMode mode)
+    : _storage(std::move(source)),
+      _source(checkedSource(this->_storage)),
+      _ownedLines(std::make_unique<LineIndex>(this->_source)),
+      _lines(this->_ownedLines.get()),
+      _positions(*this->_lines),
+      _mode(mode) {
+    this->createTokenizers();
+}
+
+Lexer::Lexer(std::string_view source, DispatchMode mode)
+    : _source(checkedSource(source)),
+      _ownedLines(std::make_unique<LineIndex>(this->_source)),
+      _lines(this->_ownedLines.get()),
+      _positions(*this->_lines),
+      _mode(mode) {
+    this->createTokenizers();
+}
+
+Lexer::Lexer(std::string_view source, const LineIndex& lines, DispatchMode mode)
+    : _source(checkedSource(source)), _lines(&lines), _positions(lines), _mode(mode) {
+    this->createTokenizers();
+}
+
+void Lexer::createTokenizers() {
     this->_tokenizers = TokenizerFactory::createTokenizers(this->_source,
                                                            this->_current,
-                                                           this->_line,
-                                                           this->_column,
                                                            this->_start,
-                                                           this->_tokens);
+                                                           this->_positions,
+                                                           this->_tokens,
+                                                           this->_literals,
+                                                           *this->_symbols,
+                                                           this->_diagnostics);
+
+    this->_dispatch.fill(nullptr);
+    for (const std::unique_ptr<TokenizerBase>& tokenizer : this->_tokenizers) {
+        TokenizerBase*& slot = this->_dispatch[static_cast<size_t>(tokenizer->charClass())];
+        if (slot == nullptr) {
+            slot = tokenizer.get();
+        }
+    }
 }
 
-std::vector<Token> Lexer::scanTokens() {
+void Lexer::useSymbols(SymbolTable& symbols) {
+    this->_symbols = &symbols;
+    this->createTokenizers();
+}
+
+const std::vector<Token>& Lexer::scanTokens() {
     while (!this->isAtEnd()) {
         this->_start = this->_current;
         this->scanToken();
     }
 
-    this->_tokens.emplace_back(TokenType::EOF_TOKEN, "EOF", this->_line, this->_column);
+    SourcePosition end = this->_positions.resolve(this->_source.length());
+    this->_tokens.emplace_back(TokenType::EOF_TOKEN, "EOF", end.line, end.column);
     return this->_tokens;
 }
 
+Token Lexer::next() {
+    size_t pending = this->_tokens.size();
+
+    while (this->_tokens.size() == pending && !this->isAtEnd()) {
+        this->_start = this->_current;
+        this->scanToken();
+    }
+
+    if (this->_tokens.size() == pending) {
+        SourcePosition end = this->_positions.resolve(this->_source.length());
+        return Token(TokenType::EOF_TOKEN, "EOF", end.line, end.column);
+    }
+
+    Token token = this->_tokens.back();
+    this->_tokens.pop_back();
+    return token;
+}
+
+Lexer::ScannedRange Lexer::scanRange(size_t begin, size_t end, const std::vector<size_t>& stops) {
+    ScannedRange range;
+    auto         stop = std::upper_bound(stops.begin(), stops.end(), begin);
+
+    this->_tokens.clear();
+    this->_literals.clear();
+    this->_symbols->clear();
+    this->_diagnostics.clear();
+    this->_current = begin;
+
+    try {
+        while (!this->isAtEnd() && this->_current < end) {
+            size_t current = this->_current;
+            while (stop != stops.end() && *stop < current) {
+                ++stop;
+            }
+            if (stop != stops.end() && *stop == current) {
+                break;
+            }
+
+            size_t produced = this->_tokens.size();
+            this->_start    = this->_current;
+            this->scanToken();
+            if (this->_tokens.size() != produced) {
+                range.starts.push_back(this->_start);
+            }
+        }
+    } catch (const std::runtime_error& e) {
+        range.error       = e.what();
+        range.errorOffset = this->_start;
+    }
+
+    range.tokens      = std::move(this->_tokens);
+    range.literals    = std::move(this->_literals);
+    range.symbols     = std::move(*this->_symbols);
+    range.diagnostics = std::move(this->_diagnostics);
+    range.end         = this->_current;
+    this->_tokens.clear();
+    this->_literals.clear();
+    this->_symbols->clear();
+    this->_diagnostics.clear();
+    return range;
+}
+
+TokenBuffer Lexer::scanTokenBuffer() {
+    TokenBuffer buffer(this->_source, *this->_lines, &this->_literals, this->_symbols);
+
+    Token token = this->next();
+    while (token.type != TokenType::EOF_TOKEN) {
+        buffer.push(token);
+        token = this->next();
+    }
+    buffer.push(token);
+
+    return buffer;
+}
+
 void Lexer::scanToken() {
     char c = this->_source[this->_current];
 
-    if (c == ' ' || c == '\r' || c == '\t') {
-        this->_current++;
-        this->_column++;
+    switch (charClassOf(c)) {
+        case CharClass::WHITESPACE: {
+            const char* data      = this->_source.data() + this->_current;
+            size_t      remaining = this->_source.length() - this->_current;
+            this->_current += SimdScanner::skipWhitespace(data, remaining);
+            return;
+        }
+        case CharClass::NEWLINE:
+            this->_current++;
+            return;
+        default:
+            break;
+    }
+
+    TokenizerBase* tokenizer =
+        this->_mode == DispatchMode::TABLE ? this->findTokenizerTable(c) : this->findTokenizerLinear(c);
+
+    if (tokenizer == nullptr) {
+        this->reportInvalidCharacter();
         return;
     }
 
-    if (c == '\n') {
+    tokenizer->tokenize();
+}
+
+void Lexer::reportInvalidCharacter() {
+    size_t start = this->_current;
+    this->_current++;
+
+    if (!this->_diagnostics.recovering()) {
+        LexDiagnostic diagnostic = {LexErrorKind::INVALID_CHARACTER, static_cast<uint32_t>(start), 1};
+        throw std::runtime_error(LexDiagnostics::format(diagnostic, this->_source, *this->_lines));
+    }
+
+    // Resynchronize on the next character some tokenizer or the whitespace skip accepts
+    while (!this->isAtEnd()) {
+        char      c         = this->_source[this->_current];
+        CharClass charClass = charClassOf(c);
+        if (charClass == CharClass::WHITESPACE || charClass == CharClass::NEWLINE
+            || this->findTokenizerLinear(c) != nullptr) {
+            break;
+        }
         this->_current++;
-        this->_line++;
-        this->_column = 1;
-        return;
     }
 
+    size_t           length   = this->_current - start;
+    SourcePosition   position = this->_positions.resolve(start);
+    std::string_view text(this->_source.data() + start, length);
+    this->_tokens.emplace_back(TokenType::ERROR, text, position.line, position.column);
+    this->_tokens.back().payload = this->_diagnostics.add(LexErrorKind::INVALID_CHARACTER, start, length);
+}
+
+TokenizerBase* Lexer::findTokenizerLinear(char c) const {
     for (const std::unique_ptr<TokenizerBase>& tokenizer : this->_tokenizers) {
         if (tokenizer->canHandle(c)) {
-            tokenizer->tokenize();
-            return;
+            return tokenizer.get();
+        }
+    }
+    return nullptr;
+}
+
+TokenizerBase* Lexer::findTokenizerTable(char c) const {
+    CharClass charClass = charClassOf(c);
+
+    // '/' opens a comment only when followed by '/' or '*', otherwise it is the division operator
+    if (charClass == CharClass::SLASH) {
+        TokenizerBase* comment = this->_dispatch[static_cast<size_t>(CharClass::SLASH)];
+        if (comment != nullptr && comment->canHandle(c)) {
+            return comment;
         }
+        charClass = CharClass::OPERATOR;
     }
 
-    throw std::runtime_error(
-        ErrorUtil::errorMessage("Invalid character '" + std::string(1, c) + "'", this->_line, this->_column));
+    return this->_dispatch[static_cast<size_t>(charClass)];
 }
 
 bool Lexer::isAtEnd() const {
-    return this->_current >= static_cast<int>(this->_source.length());
+    return this->_current >= this->_source.length();
 }
 
 void Lexer::printTokens() const {
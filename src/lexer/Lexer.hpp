@@ -21,12 +21,23 @@
 
 #pragma once
 
+#include "opal/lexer/CharClass.hpp"
+#include "opal/lexer/LexDiagnostics.hpp"
+#include "opal/lexer/LineIndex.hpp"
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
 #include "opal/lexer/Token.hpp"
+#include "opal/lexer/TokenBuffer.hpp"
+#include "opal/lexer/TokenSource.hpp"
 #include "opal/lexer/tokenizer/TokenizerFactory.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace opal {
@@ -36,37 +47,255 @@ namespace opal {
  * @brief Tokenizes Opal source code into a sequence of tokens
  *
  * The lexer is responsible for breaking down source code into meaningful tokens
- * that can be processed by the parser.
+ * that can be processed by the parser. Tokens can be produced all at once with
+ * scanTokens, or pulled one at a time with next so that only the token being
+ * handed out is kept in memory.
  */
-class Lexer {
+class Lexer : public TokenSource {
 public:
+    /**
+     * @enum DispatchMode
+     * @brief Selects how the lexer picks the tokenizer for the next character
+     */
+    enum class DispatchMode {
+        LINEAR,  ///< Probe every tokenizer through canHandle until one accepts
+        TABLE    ///< Jump through the precomputed character class table
+    };
+
+    /**
+     * @enum ErrorMode
+     * @brief Selects what the lexer does on a lexical error
+     */
+    enum class ErrorMode {
+        THROW,   ///< Throw a std::runtime_error on the first error
+        RECOVER  ///< Emit an ERROR token, record a diagnostic and keep scanning
+    };
+
+    /**
+     * @brief Largest source the lexer accepts, since token offsets are stored in 32 bits
+     */
+    static constexpr size_t MAX_SOURCE_SIZE = UINT32_MAX;
+
     /**
      * @brief Constructs a new Lexer object
      * @param source The source code to tokenize
+     * @param mode The tokenizer dispatch strategy, both produce the same tokens
+     * @throws std::runtime_error If the source is larger than MAX_SOURCE_SIZE
+     */
+    explicit Lexer(std::string source, DispatchMode mode = DispatchMode::TABLE);
+
+    /**
+     * @brief Constructs a new Lexer object from a string literal
+     * @param source The source code to tokenize, copied into the lexer
+     * @param mode The tokenizer dispatch strategy, both produce the same tokens
+     */
+    explicit Lexer(const char* source, DispatchMode mode = DispatchMode::TABLE) : Lexer(std::string(source), mode) {}
+
+    /**
+     * @brief Constructs a new Lexer object that tokenizes a source in place
+     *
+     * The source is not copied, so tokens point straight into it, for instance
+     * into a file mapped with FileUtil::mapFile.
+     *
+     * @param source The source code to tokenize, which must outlive the lexer and its tokens
+     * @param mode The tokenizer dispatch strategy, both produce the same tokens
+     * @throws std::runtime_error If the source is larger than MAX_SOURCE_SIZE
+     */
+    explicit Lexer(std::string_view source, DispatchMode mode = DispatchMode::TABLE);
+
+    /**
+     * @brief Constructs a new Lexer object over a source it does not own
+     *
+     * Lets several lexers share one source and one line index, for instance to
+     * scan separate ranges of a large file.
+     *
+     * @param source The source code to tokenize, which must outlive the lexer and its tokens
+     * @param lines The line index of the source, which must outlive the lexer
+     * @param mode The tokenizer dispatch strategy, both produce the same tokens
+     * @throws std::runtime_error If the source is larger than MAX_SOURCE_SIZE
+     */
+    Lexer(std::string_view source, const LineIndex& lines, DispatchMode mode = DispatchMode::TABLE);
+
+    /**
+     * @struct ScannedRange
+     * @brief Result of scanning part of the source with scanRange
      */
-    explicit Lexer(std::string source);
+    struct ScannedRange {
+        std::vector<Token>  tokens;  ///< Tokens found, without an EOF token
+        std::vector<size_t> starts;  ///< Source offset each token starts at
+        LiteralTable        literals;     ///< Literals the NUMBER payloads index into
+        SymbolTable         symbols;      ///< Symbols the IDENTIFIER payloads index into
+        LexDiagnostics      diagnostics;  ///< Errors the ERROR payloads index into, when recovering
+        size_t              end;     ///< Offset the scan stopped at, always between two tokens
+        std::string         error;   ///< Message of the error that stopped the scan, empty if none
+        size_t              errorOffset;  ///< Offset of the lexeme the error is located at, when there is one
+    };
 
     /**
      * @brief Scans the source code and produces a vector of tokens
+     *
+     * The tokens stay owned by the lexer, so that printTokens can show them,
+     * until releaseTokens hands them over without a copy.
+     *
+     * @return const std::vector<Token>& The tokens extracted from the source, valid until released
+     */
+    const std::vector<Token>& scanTokens();
+
+    /**
+     * @brief Moves the tokens collected by scanTokens out of the lexer
+     *
+     * Meant to hand the tokens over to a Parser, which then owns the only copy
+     * of the array. The lexer keeps no tokens afterwards.
+     *
      * @return std::vector<Token> The tokens extracted from the source
      */
-    std::vector<Token> scanTokens();
+    std::vector<Token> releaseTokens() { return std::move(this->_tokens); }
+
+    /**
+     * @brief Scans the tokens that start in a range of the source
+     *
+     * Scanning starts between two tokens at begin and stops at the first token
+     * boundary at or past end, so the last token may run past end. It also stops
+     * early on reaching one of the given offsets, which lets a caller rejoin the
+     * tokens of a previous scan. Lexing errors are reported in the result
+     * instead of thrown. Literals and symbols found are moved to the result,
+     * so the lexer must not share a symbol table given to useSymbols.
+     *
+     * @param begin The offset to start scanning at
+     * @param end The offset to stop scanning at
+     * @param stops Sorted offsets at which scanning stops before reaching end
+     * @return ScannedRange The tokens found and where scanning stopped
+     */
+    ScannedRange scanRange(size_t begin, size_t end, const std::vector<size_t>& stops = {});
+
+    /**
+     * @brief Scans and returns the next token only
+     *
+     * Tokens returned this way are not kept by the lexer, so memory use does not
+     * grow with the size of the source. Once the source is exhausted an EOF token
+     * is returned on every call. Do not mix with scanTokens on the same lexer.
+     *
+     * @return Token The next token
+     */
+    Token next() override;
+
+    /**
+     * @brief Scans all tokens into a compact TokenBuffer
+     *
+     * Tokens are streamed straight into the buffer, so the full Token vector is
+     * never built. The buffer refers to this lexer's source and must not outlive it.
+     *
+     * @return TokenBuffer The tokens, terminated by an EOF token
+     */
+    TokenBuffer scanTokenBuffer();
 
     /**
      * @brief Prints all tokens to standard output
      *
      * Useful for debugging and visualizing the lexical analysis results.
+     * Only tokens collected by scanTokens are printed.
      */
     void printTokens() const;
 
+    /**
+     * @brief Gets the line index of the source
+     *
+     * Tokens carry resolved positions, but anything holding a plain byte
+     * offset into the source can resolve it through this index.
+     *
+     * @return const LineIndex& The line start table of the source
+     */
+    const LineIndex& getLineIndex() const { return *this->_lines; }
+
+    /**
+     * @brief Gets the literals decoded while scanning
+     *
+     * The payload of every NUMBER token produced by this lexer is an index
+     * into this table.
+     *
+     * @return const LiteralTable& The decoded literals
+     */
+    const LiteralTable& getLiterals() const { return this->_literals; }
+
+    /**
+     * @brief Gets the table the payloads of NUMBER tokens index into
+     * @return const LiteralTable* The literals decoded by this lexer
+     */
+    const LiteralTable* literals() const override { return &this->_literals; }
+
+    /**
+     * @brief Selects what happens on a lexical error
+     *
+     * In RECOVER mode an invalid character run, an unterminated string or an
+     * unterminated comment becomes an ERROR token whose payload indexes the
+     * diagnostics, so every error is collected in one pass without exceptions.
+     *
+     * @param mode The error mode, THROW by default
+     */
+    void setErrorMode(ErrorMode mode) { this->_diagnostics.setRecovering(mode == ErrorMode::RECOVER); }
+
+    /**
+     * @brief Gets the errors recorded while recovering
+     * @return const LexDiagnostics& The diagnostics in source order
+     */
+    const LexDiagnostics& getDiagnostics() const { return this->_diagnostics; }
+
+    /**
+     * @brief Formats the message of a recorded error
+     * @param diagnostic A record from getDiagnostics
+     * @return std::string The message the error would have been thrown with
+     */
+    std::string formatDiagnostic(const LexDiagnostic& diagnostic) const {
+        return LexDiagnostics::format(diagnostic, this->_source, *this->_lines);
+    }
+
+    /**
+     * @brief Interns identifiers into a table shared with other lexers
+     *
+     * Lets successive sources, such as the lines typed into the REPL, give the
+     * same name the same id. Must be called before scanning.
+     *
+     * @param symbols The table to intern into, which must outlive the lexer
+     */
+    void useSymbols(SymbolTable& symbols);
+
+    /**
+     * @brief Gets the table identifiers are interned into
+     *
+     * The payload of every IDENTIFIER token produced by this lexer is an id
+     * in this table.
+     *
+     * @return SymbolTable& The symbol table in use
+     */
+    SymbolTable& getSymbols() const { return *this->_symbols; }
+
+    /**
+     * @brief Gets the table the payloads of IDENTIFIER tokens index into
+     * @return SymbolTable* The symbol table in use
+     */
+    SymbolTable* symbols() const override { return this->_symbols; }
+
 private:
-    std::string                                 _source;
-    std::vector<Token>                          _tokens;
-    std::vector<std::unique_ptr<TokenizerBase>> _tokenizers;
-    int                                         _start   = 0;
-    int                                         _current = 0;
-    int                                         _line    = 1;
-    int                                         _column  = 1;
+    std::string                                  _storage;
+    std::string_view                             _source;
+    std::unique_ptr<LineIndex>                   _ownedLines;
+    const LineIndex*                             _lines;
+    LineIndex::Cursor                            _positions;
+    std::vector<Token>                           _tokens;
+    LiteralTable                                 _literals;
+    SymbolTable                                  _ownedSymbols;
+    SymbolTable*                                 _symbols = &this->_ownedSymbols;
+    LexDiagnostics                               _diagnostics;
+    std::vector<std::unique_ptr<TokenizerBase>>  _tokenizers;
+    std::array<TokenizerBase*, CHAR_CLASS_COUNT> _dispatch{};
+    DispatchMode                                 _mode;
+    size_t                                       _start   = 0;
+    size_t                                       _current = 0;
+
+    /**
+     * @brief Creates the tokenizers and fills the dispatch table
+     */
+    void createTokenizers();
 
     /**
      * @brief Scans a single token from the current position
@@ -75,6 +304,30 @@ private:
      */
     void scanToken();
 
+    /**
+     * @brief Finds the tokenizer for a character by probing each one in order
+     * @param c The first character of the lexeme
+     * @return TokenizerBase* The accepting tokenizer, or nullptr if none
+     */
+    TokenizerBase* findTokenizerLinear(char c) const;
+
+    /**
+     * @brief Finds the tokenizer for a character through the dispatch table
+     * @param c The first character of the lexeme
+     * @return TokenizerBase* The accepting tokenizer, or nullptr if none
+     */
+    TokenizerBase* findTokenizerTable(char c) const;
+
+    /**
+     * @brief Reports the invalid character at the current position
+     *
+     * When recovering, the whole run of characters no tokenizer accepts becomes
+     * a single ERROR token.
+     *
+     * @throws std::runtime_error Unless recovering
+     */
+    void reportInvalidCharacter();
+
     /**
      * @brief Checks if the lexer has reached the end of the source
      * @return bool True if at the end of source, false otherwise
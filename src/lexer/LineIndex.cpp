@@ -0,0 +1,69 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/LineIndex.hpp"
+
+#include "opal/lexer/SimdScanner.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace opal;
+
+LineIndex::LineIndex(std::string_view source) {
+    this->_lineStarts.reserve(SimdScanner::countNewlines(source.data(), source.size()) + 1);
+    this->_lineStarts.push_back(0);
+
+    // An empty view may have a null data pointer, which memchr must not be given
+    if (source.empty()) {
+        return;
+    }
+
+    const char* begin = source.data();
+    const char* end   = begin + source.size();
+    const char* found = begin;
+    while ((found = static_cast<const char*>(std::memchr(found, '\n', static_cast<size_t>(end - found)))) != nullptr) {
+        found++;
+        this->_lineStarts.push_back(static_cast<size_t>(found - begin));
+    }
+}
+
+SourcePosition LineIndex::resolve(size_t offset) const {
+    auto   next = std::upper_bound(this->_lineStarts.begin(), this->_lineStarts.end(), offset);
+    size_t line = static_cast<size_t>(next - this->_lineStarts.begin()) - 1;
+    return {static_cast<int>(line + 1), static_cast<int>(offset - this->_lineStarts[line] + 1)};
+}
+
+SourcePosition LineIndex::Cursor::resolve(size_t offset) {
+    const std::vector<size_t>& starts = this->_index._lineStarts;
+    size_t                     probe  = this->_line + LINEAR_PROBE;
+
+    if (offset < starts[this->_line] || (probe < starts.size() && starts[probe] <= offset)) {
+        SourcePosition position = this->_index.resolve(offset);
+        this->_line             = static_cast<size_t>(position.line - 1);
+        return position;
+    }
+
+    while (this->_line + 1 < starts.size() && starts[this->_line + 1] <= offset) {
+        this->_line++;
+    }
+    return {static_cast<int>(this->_line + 1), static_cast<int>(offset - starts[this->_line] + 1)};
+}
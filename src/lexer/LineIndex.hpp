@@ -0,0 +1,118 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @struct SourcePosition
+ * @brief One-based line and column of a byte in the source
+ */
+struct SourcePosition {
+    int line;
+    int column;
+};
+
+/**
+ * @class LineIndex
+ * @brief Table of line start offsets used to resolve byte offsets to positions
+ *
+ * Built once per source so that the lexer only has to track byte offsets.
+ * Lines and columns are computed from the table when they are needed, with
+ * columns counted in bytes from the start of the line.
+ */
+class LineIndex {
+private:
+    std::vector<size_t> _lineStarts;
+
+public:
+    /**
+     * @class Cursor
+     * @brief Resolver tuned for offsets that mostly move forward
+     *
+     * Remembers the last resolved line so that resolving offsets in source
+     * order costs amortized constant time. Moving backwards or far ahead falls
+     * back to a binary search.
+     */
+    class Cursor {
+    private:
+        /**
+         * @brief Number of lines walked forward before switching to a binary search
+         */
+        static constexpr size_t LINEAR_PROBE = 8;
+
+        const LineIndex& _index;
+        size_t           _line = 0;
+
+    public:
+        /**
+         * @brief Constructs a new Cursor object
+         * @param index The line index to resolve against, which must outlive the cursor
+         */
+        explicit Cursor(const LineIndex& index) : _index(index) {}
+
+        /**
+         * @brief Resolves a byte offset to a position
+         * @param offset The byte offset in the source
+         * @return SourcePosition The line and column of the offset
+         */
+        SourcePosition resolve(size_t offset);
+
+        /**
+         * @brief Gets the line index this cursor resolves against
+         * @return const LineIndex& The line index
+         */
+        const LineIndex& index() const { return _index; }
+    };
+
+    /**
+     * @brief Constructs a new LineIndex object
+     * @param source The source text to index
+     */
+    explicit LineIndex(std::string_view source);
+
+    /**
+     * @brief Resolves a byte offset to a position with a binary search
+     * @param offset The byte offset in the source
+     * @return SourcePosition The line and column of the offset
+     */
+    SourcePosition resolve(size_t offset) const;
+
+    /**
+     * @brief Gets the number of lines in the source
+     * @return size_t The line count, at least 1
+     */
+    size_t lineCount() const { return _lineStarts.size(); }
+
+    /**
+     * @brief Gets the byte offset a line starts at
+     * @param line The zero-based line index
+     * @return size_t The offset of the first byte of the line
+     */
+    size_t lineStart(size_t line) const { return _lineStarts[line]; }
+};
+
+}  // namespace opal
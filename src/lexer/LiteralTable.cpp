@@ -0,0 +1,55 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/LiteralTable.hpp"
+
+#include <charconv>
+#include <system_error>
+
+using namespace opal;
+
+bool LiteralTable::decode(std::string_view lexeme, NumericLiteral& literal) {
+    const char* begin = lexeme.data();
+    const char* end   = begin + lexeme.size();
+
+    if (lexeme.find('.') == std::string_view::npos) {
+        int64_t integer = 0;
+        auto [last, error] = std::from_chars(begin, end, integer);
+        if (error != std::errc() || last != end) {
+            return false;
+        }
+        literal = NumericLiteral::ofInt(integer);
+        return true;
+    }
+
+    double floating = 0.0;
+    auto [last, error] = std::from_chars(begin, end, floating, std::chars_format::fixed);
+    if (error != std::errc() || last != end) {
+        return false;
+    }
+    literal = NumericLiteral::ofFloat(floating);
+    return true;
+}
+
+uint32_t LiteralTable::add(const NumericLiteral& literal) {
+    this->_literals.push_back(literal);
+    return static_cast<uint32_t>(this->_literals.size() - 1);
+}
@@ -0,0 +1,134 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @enum NumericKind
+ * @brief Kind of value held by a NumericLiteral
+ */
+enum class NumericKind : uint8_t { INT, FLOAT };
+
+/**
+ * @struct NumericLiteral
+ * @brief Decoded value of a number literal
+ */
+struct NumericLiteral {
+    NumericKind kind = NumericKind::INT;
+    union {
+        int64_t integer = 0;
+        double  floating;
+    };
+
+    /**
+     * @brief Creates an integer literal
+     * @param value The integer value
+     * @return NumericLiteral The literal
+     */
+    static NumericLiteral ofInt(int64_t value) {
+        NumericLiteral literal;
+        literal.integer = value;
+        return literal;
+    }
+
+    /**
+     * @brief Creates a floating-point literal
+     * @param value The floating-point value
+     * @return NumericLiteral The literal
+     */
+    static NumericLiteral ofFloat(double value) {
+        NumericLiteral literal;
+        literal.kind     = NumericKind::FLOAT;
+        literal.floating = value;
+        return literal;
+    }
+};
+
+/**
+ * @class LiteralTable
+ * @brief Side table of the number literals decoded by the lexer
+ *
+ * NUMBER tokens carry the index of their decoded value in Token::payload, so
+ * later stages read typed values instead of parsing the lexeme again.
+ */
+class LiteralTable {
+private:
+    std::vector<NumericLiteral> _literals;
+
+public:
+    /**
+     * @brief Decodes a number lexeme
+     *
+     * Lexemes with a '.' are decoded as doubles, the others as 64-bit integers.
+     *
+     * @param lexeme The digits of the literal, optionally with one fractional part
+     * @param literal Receives the decoded value
+     * @return bool True if decoded, false if the lexeme is malformed or out of range
+     */
+    static bool decode(std::string_view lexeme, NumericLiteral& literal);
+
+    /**
+     * @brief Appends a literal to the table
+     * @param literal The decoded literal
+     * @return uint32_t The index of the literal
+     */
+    uint32_t add(const NumericLiteral& literal);
+
+    /**
+     * @brief Gets a literal by index
+     * @param index The index returned by add
+     * @return const NumericLiteral& The literal
+     */
+    const NumericLiteral& get(uint32_t index) const { return _literals[index]; }
+
+    /**
+     * @brief Gets the number of literals in the table
+     * @return size_t The literal count
+     */
+    size_t size() const { return _literals.size(); }
+
+    /**
+     * @brief Gets the literals as a contiguous array
+     * @return const NumericLiteral* The literal at index 0, followed by the others in order
+     */
+    const NumericLiteral* data() const { return _literals.data(); }
+
+    /**
+     * @brief Replaces the content of the table
+     * @param literals The literals to copy, in index order
+     * @param count The number of literals
+     */
+    void assign(const NumericLiteral* literals, size_t count) { _literals.assign(literals, literals + count); }
+
+    /**
+     * @brief Removes every literal
+     */
+    void clear() { _literals.clear(); }
+};
+
+}  // namespace opal
@@ -0,0 +1,143 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/ParallelLexer.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/Token.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <stdexcept>
+
+using namespace opal;
+
+ParallelLexer::ParallelLexer(std::string source, size_t threadCount, Lexer::DispatchMode mode)
+    : _source(std::move(source)), _lines(this->_source), _mode(mode), _pool(threadCount) {}
+
+std::vector<size_t> ParallelLexer::splitChunks() const {
+    size_t length     = this->_source.size();
+    size_t chunkCount = std::min(length / MIN_CHUNK_SIZE, this->_pool.size() * CHUNKS_PER_THREAD);
+
+    std::vector<size_t> boundaries = {0};
+    for (size_t i = 1; i < chunkCount; i++) {
+        size_t target = std::max(length * i / chunkCount, boundaries.back());
+        auto   found  = static_cast<const char*>(std::memchr(this->_source.data() + target, '\n', length - target));
+        if (found == nullptr) {
+            break;
+        }
+
+        size_t boundary = static_cast<size_t>(found - this->_source.data()) + 1;
+        if (boundary < length && boundary > boundaries.back()) {
+            boundaries.push_back(boundary);
+        }
+    }
+    boundaries.push_back(length);
+    return boundaries;
+}
+
+void ParallelLexer::appendTokens(std::vector<Token>& tokens, Lexer::ScannedRange& range, size_t from) {
+    std::vector<uint32_t> symbolIds(range.symbols.size(), Token::NO_PAYLOAD);
+
+    for (size_t i = from; i < range.tokens.size(); i++) {
+        Token& token = range.tokens[i];
+        if (token.hasPayload()) {
+            if (token.type == TokenType::ERROR) {
+                const LexDiagnostic& diagnostic = range.diagnostics.get(token.payload);
+                token.payload = this->_diagnostics.add(diagnostic.kind, diagnostic.offset, diagnostic.length);
+            } else if (token.type == TokenType::IDENTIFIER) {
+                uint32_t& id = symbolIds[token.payload];
+                if (id == Token::NO_PAYLOAD) {
+                    id = this->_symbols.intern(range.symbols.name(token.payload));
+                }
+                token.payload = id;
+            } else {
+                token.payload = this->_literals.add(range.literals.get(token.payload));
+            }
+        }
+        tokens.push_back(std::move(token));
+    }
+}
+
+std::vector<Token> ParallelLexer::scanTokens() {
+    this->_literals.clear();
+    this->_symbols.clear();
+    this->_diagnostics.clear();
+
+    std::vector<size_t> boundaries = this->splitChunks();
+    size_t              chunkCount = boundaries.size() - 1;
+
+    std::vector<std::future<Lexer::ScannedRange>> speculative;
+    speculative.reserve(chunkCount);
+    for (size_t i = 0; i < chunkCount; i++) {
+        size_t begin = boundaries[i];
+        size_t end   = boundaries[i + 1];
+        speculative.push_back(this->_pool.submit([this, begin, end]() {
+            Lexer lexer(this->_source, this->_lines, this->_mode);
+            lexer.setErrorMode(this->_errorMode);
+            return lexer.scanRange(begin, end);
+        }));
+    }
+
+    Lexer              stitcher(this->_source, this->_lines, this->_mode);
+    std::vector<Token> tokens;
+    size_t             cursor = 0;
+    stitcher.setErrorMode(this->_errorMode);
+
+    for (size_t i = 0; i < chunkCount; i++) {
+        Lexer::ScannedRange chunk = speculative[i].get();
+        size_t              begin = boundaries[i];
+        size_t              end   = boundaries[i + 1];
+
+        if (cursor >= end) {
+            // The previous chunk ended with a lexeme covering this whole chunk
+            continue;
+        }
+
+        size_t rejoined = 0;
+        if (cursor != begin) {
+            // The chunk started inside a lexeme of the previous one, so lex for real until both scans agree
+            Lexer::ScannedRange fixup = stitcher.scanRange(cursor, end, chunk.starts);
+            this->appendTokens(tokens, fixup, 0);
+            if (!fixup.error.empty()) {
+                throw std::runtime_error(fixup.error);
+            }
+
+            auto match = std::lower_bound(chunk.starts.begin(), chunk.starts.end(), fixup.end);
+            if (match == chunk.starts.end() || *match != fixup.end) {
+                cursor = fixup.end;
+                continue;
+            }
+            rejoined = static_cast<size_t>(match - chunk.starts.begin());
+        }
+
+        this->appendTokens(tokens, chunk, rejoined);
+        if (!chunk.error.empty()) {
+            throw std::runtime_error(chunk.error);
+        }
+        cursor = chunk.end;
+    }
+
+    SourcePosition end = this->_lines.resolve(this->_source.size());
+    tokens.emplace_back(TokenType::EOF_TOKEN, "EOF", end.line, end.column);
+    return tokens;
+}
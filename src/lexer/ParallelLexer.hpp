@@ -0,0 +1,146 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/LexDiagnostics.hpp"
+#include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/LineIndex.hpp"
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
+#include "opal/lexer/Token.hpp"
+#include "opal/util/ThreadPool.hpp"
+
+#include <string>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class ParallelLexer
+ * @brief Tokenizes one large source on several threads
+ *
+ * The source is split into chunks at newline boundaries and every chunk is
+ * lexed on a thread pool as if it started between two tokens. The chunks are
+ * then stitched in order: a chunk whose start turns out to lie inside a string
+ * or a block comment of the previous chunk is re-lexed from the real token
+ * boundary until it rejoins its speculative tokens. Positions are resolved
+ * through one line index of the whole source, so the output, errors included,
+ * is identical to Lexer::scanTokens.
+ */
+class ParallelLexer {
+private:
+    /**
+     * @brief Smallest chunk worth handing to another thread, in bytes
+     */
+    static constexpr size_t MIN_CHUNK_SIZE = 16 * 1024;
+
+    /**
+     * @brief Number of chunks per thread, to even out chunks of uneven cost
+     */
+    static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    std::string         _source;
+    LineIndex           _lines;
+    Lexer::DispatchMode _mode;
+    ThreadPool          _pool;
+    LiteralTable        _literals;
+    SymbolTable         _symbols;
+    LexDiagnostics      _diagnostics;
+    Lexer::ErrorMode    _errorMode = Lexer::ErrorMode::THROW;
+
+    /**
+     * @brief Computes the chunk boundaries of the source
+     * @return std::vector<size_t> Sorted offsets starting with 0 and ending with the source length
+     */
+    std::vector<size_t> splitChunks() const;
+
+    /**
+     * @brief Moves the tokens of a scanned range to the output
+     *
+     * Every chunk decodes literals, interns symbols and records errors into its
+     * own tables, so payloads are rebased onto the merged tables on the way.
+     *
+     * @param tokens The output tokens
+     * @param range The scanned range to take tokens from
+     * @param from The index of the first token of the range to take
+     */
+    void appendTokens(std::vector<Token>& tokens, Lexer::ScannedRange& range, size_t from);
+
+public:
+    /**
+     * @brief Constructs a new ParallelLexer object
+     * @param source The source code to tokenize
+     * @param threadCount Number of lexing threads, 0 to use one per hardware thread
+     * @param mode The tokenizer dispatch strategy used by every chunk
+     */
+    explicit ParallelLexer(std::string         source,
+                           size_t              threadCount = 0,
+                           Lexer::DispatchMode mode        = Lexer::DispatchMode::TABLE);
+
+    /**
+     * @brief Scans the source code and produces a vector of tokens
+     * @return std::vector<Token> The same tokens Lexer::scanTokens produces
+     * @throws std::runtime_error On the first lexing error in source order, unless recovering
+     */
+    std::vector<Token> scanTokens();
+
+    /**
+     * @brief Gets the line index of the source
+     * @return const LineIndex& The line start table of the source
+     */
+    const LineIndex& getLineIndex() const { return this->_lines; }
+
+    /**
+     * @brief Gets the literals decoded by the last scanTokens call
+     * @return const LiteralTable& The table the payloads of NUMBER tokens index into
+     */
+    const LiteralTable& getLiterals() const { return this->_literals; }
+
+    /**
+     * @brief Gets the symbols interned by the last scanTokens call
+     * @return SymbolTable& The table the payloads of IDENTIFIER tokens index into
+     */
+    SymbolTable& getSymbols() { return this->_symbols; }
+
+    /**
+     * @brief Selects what happens on a lexical error, see Lexer::setErrorMode
+     * @param mode The error mode used by every chunk, THROW by default
+     */
+    void setErrorMode(Lexer::ErrorMode mode) { this->_errorMode = mode; }
+
+    /**
+     * @brief Gets the errors recorded by the last scanTokens call while recovering
+     * @return const LexDiagnostics& The diagnostics in source order
+     */
+    const LexDiagnostics& getDiagnostics() const { return this->_diagnostics; }
+
+    /**
+     * @brief Formats the message of a recorded error
+     * @param diagnostic A record from getDiagnostics
+     * @return std::string The message the error would have been thrown with
+     */
+    std::string formatDiagnostic(const LexDiagnostic& diagnostic) const {
+        return LexDiagnostics::format(diagnostic, this->_source, this->_lines);
+    }
+};
+
+}  // namespace opal
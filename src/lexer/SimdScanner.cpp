@@ -0,0 +1,350 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/SimdScanner.hpp"
+
+#include <atomic>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    #define OPAL_SIMD_X86 1
+    #include <immintrin.h>
+#else
+    #define OPAL_SIMD_X86 0
+#endif
+
+using namespace opal;
+
+namespace {
+
+using ScanKernel = size_t (*)(const char*, size_t);
+
+struct ScanKernels {
+    ScanKernel skipWhitespace;
+    ScanKernel scanIdentifier;
+    ScanKernel findStringDelimiter;
+    ScanKernel countNewlines;
+};
+
+inline bool isWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool isIdentifierChar(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+inline bool isStringDelimiter(char c) {
+    return c == '"' || c == '\n';
+}
+
+size_t skipWhitespaceScalar(const char* data, size_t length) {
+    size_t i = 0;
+    while (i < length && isWhitespace(data[i])) {
+        i++;
+    }
+    return i;
+}
+
+size_t scanIdentifierScalar(const char* data, size_t length) {
+    size_t i = 0;
+    while (i < length && isIdentifierChar(data[i])) {
+        i++;
+    }
+    return i;
+}
+
+size_t findStringDelimiterScalar(const char* data, size_t length) {
+    size_t i = 0;
+    while (i < length && !isStringDelimiter(data[i])) {
+        i++;
+    }
+    return i;
+}
+
+size_t countNewlinesScalar(const char* data, size_t length) {
+    size_t count = 0;
+    for (size_t i = 0; i < length; i++) {
+        count += data[i] == '\n';
+    }
+    return count;
+}
+
+#if OPAL_SIMD_X86
+
+// Per-byte counters are flushed before they can wrap around
+constexpr size_t COUNTER_FLUSH_BLOCKS = 255;
+
+// Most lexemes are short, so the first few bytes are checked one by one before any vector load
+constexpr size_t SCALAR_PROLOGUE = 8;
+
+// Bytes >= 0x80 are negative as signed chars, so they never fall inside an ASCII range
+__attribute__((target("sse2"))) inline __m128i inRange16(__m128i bytes, char low, char high) {
+    return _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(static_cast<char>(low - 1))),
+                         _mm_cmplt_epi8(bytes, _mm_set1_epi8(static_cast<char>(high + 1))));
+}
+
+__attribute__((target("sse2"))) inline __m128i whitespaceMask16(__m128i bytes) {
+    __m128i spaces = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(' '));
+    __m128i tabs   = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t'));
+    return _mm_or_si128(_mm_or_si128(spaces, tabs), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')));
+}
+
+__attribute__((target("sse2"))) inline __m128i identifierMask16(__m128i bytes) {
+    // Setting bit 0x20 folds A-Z onto a-z without pulling any other byte into that range
+    __m128i folded = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+    return _mm_or_si128(_mm_or_si128(inRange16(folded, 'a', 'z'), inRange16(bytes, '0', '9')),
+                        _mm_cmpeq_epi8(bytes, _mm_set1_epi8('_')));
+}
+
+__attribute__((target("sse2"))) inline __m128i delimiterMask16(__m128i bytes) {
+    return _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('"')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')));
+}
+
+__attribute__((target("sse2"))) size_t skipWhitespaceSse2(const char* data, size_t length) {
+    size_t i = 0;
+    for (; i < SCALAR_PROLOGUE && i < length; i++) {
+        if (!isWhitespace(data[i])) {
+            return i;
+        }
+    }
+    for (; i + 16 <= length; i += 16) {
+        __m128i  bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        unsigned stop  = ~static_cast<unsigned>(_mm_movemask_epi8(whitespaceMask16(bytes))) & 0xFFFFu;
+        if (stop != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(stop));
+        }
+    }
+    return i + skipWhitespaceScalar(data + i, length - i);
+}
+
+__attribute__((target("sse2"))) size_t scanIdentifierSse2(const char* data, size_t length) {
+    size_t i = 0;
+    for (; i < SCALAR_PROLOGUE && i < length; i++) {
+        if (!isIdentifierChar(data[i])) {
+            return i;
+        }
+    }
+    for (; i + 16 <= length; i += 16) {
+        __m128i  bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        unsigned stop  = ~static_cast<unsigned>(_mm_movemask_epi8(identifierMask16(bytes))) & 0xFFFFu;
+        if (stop != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(stop));
+        }
+    }
+    return i + scanIdentifierScalar(data + i, length - i);
+}
+
+__attribute__((target("sse2"))) size_t findStringDelimiterSse2(const char* data, size_t length) {
+    size_t i = 0;
+    for (; i < SCALAR_PROLOGUE && i < length; i++) {
+        if (isStringDelimiter(data[i])) {
+            return i;
+        }
+    }
+    for (; i + 16 <= length; i += 16) {
+        __m128i  bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        unsigned found = static_cast<unsigned>(_mm_movemask_epi8(delimiterMask16(bytes)));
+        if (found != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(found));
+        }
+    }
+    return i + findStringDelimiterScalar(data + i, length - i);
+}
+
+__attribute__((target("sse2"))) size_t countNewlinesSse2(const char* data, size_t length) {
+    const __m128i newline = _mm_set1_epi8('\n');
+    size_t        count   = 0;
+    size_t        i       = 0;
+
+    while (i + 16 <= length) {
+        __m128i counters = _mm_setzero_si128();
+        for (size_t block = 0; block < COUNTER_FLUSH_BLOCKS && i + 16 <= length; block++, i += 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            counters      = _mm_sub_epi8(counters, _mm_cmpeq_epi8(bytes, newline));
+        }
+        __m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+        count += static_cast<size_t>(_mm_cvtsi128_si32(sums)) + static_cast<size_t>(_mm_extract_epi16(sums, 4));
+    }
+    return count + countNewlinesScalar(data + i, length - i);
+}
+
+__attribute__((target("avx2"))) inline __m256i inRange32(__m256i bytes, char low, char high) {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(static_cast<char>(low - 1))),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(high + 1)), bytes));
+}
+
+__attribute__((target("avx2"))) size_t skipWhitespaceAvx2(const char* data, size_t length) {
+    size_t i = 0;
+    for (; i < SCALAR_PROLOGUE && i < length; i++) {
+        if (!isWhitespace(data[i])) {
+            return i;
+        }
+    }
+    for (; i + 32 <= length; i += 32) {
+        __m256i  bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i  mask  = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' ')),
+                                                       _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\t'))),
+                                       _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\r')));
+        unsigned stop  = ~static_cast<unsigned>(_mm256_movemask_epi8(mask));
+        if (stop != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(stop));
+        }
+    }
+    return i + skipWhitespaceSse2(data + i, length - i);
+}
+
+__attribute__((target("avx2"))) size_t scanIdentifierAvx2(const char* data, size_t length) {
+    size_t i = 0;
+    for (; i < SCALAR_PROLOGUE && i < length; i++) {
+        if (!isIdentifierChar(data[i])) {
+            return i;
+        }
+    }
+    for (; i + 32 <= length; i += 32) {
+        __m256i  bytes  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i  folded = _mm256_or_si256(bytes, _mm256_set1_epi8(0x20));
+        __m256i  mask   = _mm256_or_si256(_mm256_or_si256(inRange32(folded, 'a', 'z'), inRange32(bytes, '0', '9')),
+                                       _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('_')));
+        unsigned stop   = ~static_cast<unsigned>(_mm256_movemask_epi8(mask));
+        if (stop != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(stop));
+        }
+    }
+    return i + scanIdentifierSse2(data + i, length - i);
+}
+
+__attribute__((target("avx2"))) size_t findStringDelimiterAvx2(const char* data, size_t length) {
+    size_t i = 0;
+    for (; i < SCALAR_PROLOGUE && i < length; i++) {
+        if (isStringDelimiter(data[i])) {
+            return i;
+        }
+    }
+    for (; i + 32 <= length; i += 32) {
+        __m256i  bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i  mask  = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('"')),
+                                       _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n')));
+        unsigned found = static_cast<unsigned>(_mm256_movemask_epi8(mask));
+        if (found != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(found));
+        }
+    }
+    return i + findStringDelimiterSse2(data + i, length - i);
+}
+
+__attribute__((target("avx2"))) size_t countNewlinesAvx2(const char* data, size_t length) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    size_t        count   = 0;
+    size_t        i       = 0;
+
+    while (i + 32 <= length) {
+        __m256i counters = _mm256_setzero_si256();
+        for (size_t block = 0; block < COUNTER_FLUSH_BLOCKS && i + 32 <= length; block++, i += 32) {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            counters      = _mm256_sub_epi8(counters, _mm256_cmpeq_epi8(bytes, newline));
+        }
+        __m256i sums = _mm256_sad_epu8(counters, _mm256_setzero_si256());
+        count += static_cast<size_t>(_mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1)
+                                     + _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3));
+    }
+    return count + countNewlinesSse2(data + i, length - i);
+}
+
+#endif
+
+constexpr ScanKernels SCALAR_KERNELS = {
+    skipWhitespaceScalar, scanIdentifierScalar, findStringDelimiterScalar, countNewlinesScalar};
+
+#if OPAL_SIMD_X86
+constexpr ScanKernels SSE2_KERNELS = {
+    skipWhitespaceSse2, scanIdentifierSse2, findStringDelimiterSse2, countNewlinesSse2};
+constexpr ScanKernels AVX2_KERNELS = {
+    skipWhitespaceAvx2, scanIdentifierAvx2, findStringDelimiterAvx2, countNewlinesAvx2};
+#endif
+
+const ScanKernels* kernelsFor(SimdLevel level) {
+    switch (level) {
+#if OPAL_SIMD_X86
+        case SimdLevel::AVX2:
+            return &AVX2_KERNELS;
+        case SimdLevel::SSE2:
+            return &SSE2_KERNELS;
+#endif
+        default:
+            return &SCALAR_KERNELS;
+    }
+}
+
+// Constant-initialized so that calls made before the selection below runs use the scalar kernels.
+// Lexer threads read the table while setLevel may swap it, so both are atomic; relaxed order is
+// enough because the tables are immutable and any of them gives the same results
+std::atomic<SimdLevel>          activeLevel{SimdLevel::SCALAR};
+std::atomic<const ScanKernels*> activeKernels{&SCALAR_KERNELS};
+
+}  // namespace
+
+size_t SimdScanner::skipWhitespace(const char* data, size_t length) {
+    return activeKernels.load(std::memory_order_relaxed)->skipWhitespace(data, length);
+}
+
+size_t SimdScanner::scanIdentifier(const char* data, size_t length) {
+    return activeKernels.load(std::memory_order_relaxed)->scanIdentifier(data, length);
+}
+
+size_t SimdScanner::findStringDelimiter(const char* data, size_t length) {
+    return activeKernels.load(std::memory_order_relaxed)->findStringDelimiter(data, length);
+}
+
+size_t SimdScanner::countNewlines(const char* data, size_t length) {
+    return activeKernels.load(std::memory_order_relaxed)->countNewlines(data, length);
+}
+
+SimdLevel SimdScanner::getLevel() {
+    return activeLevel.load(std::memory_order_relaxed);
+}
+
+SimdLevel SimdScanner::detectLevel() {
+#if OPAL_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
+
+void SimdScanner::setLevel(SimdLevel level) {
+    SimdLevel supported = detectLevel();
+    if (static_cast<int>(level) > static_cast<int>(supported)) {
+        level = supported;
+    }
+    activeLevel.store(level, std::memory_order_relaxed);
+    activeKernels.store(kernelsFor(level), std::memory_order_relaxed);
+}
+
+namespace {
+
+[[maybe_unused]] const bool kernelsSelected = (SimdScanner::setLevel(SimdScanner::detectLevel()), true);
+
+}  // namespace
@@ -0,0 +1,106 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace opal {
+
+/**
+ * @enum SimdLevel
+ * @brief Instruction set used by the SimdScanner kernels
+ */
+enum class SimdLevel { SCALAR, SSE2, AVX2 };
+
+/**
+ * @class SimdScanner
+ * @brief Vectorized byte scanning kernels used by the lexer hot loops
+ *
+ * Each run kernel returns the length of the leading run it recognizes so the
+ * caller can move its position in one step. The best instruction set the
+ * CPU supports is selected once at startup, with a scalar fallback on every
+ * platform. This class cannot be instantiated.
+ */
+class SimdScanner {
+private:
+    SimdScanner()                              = delete;
+    ~SimdScanner()                             = delete;
+    SimdScanner(const SimdScanner&)            = delete;
+    SimdScanner& operator=(const SimdScanner&) = delete;
+
+public:
+    /**
+     * @brief Counts the leading spaces, tabs and carriage returns
+     * @param data Pointer to the first byte to scan
+     * @param length Number of readable bytes
+     * @return size_t Length of the whitespace run
+     */
+    static size_t skipWhitespace(const char* data, size_t length);
+
+    /**
+     * @brief Counts the leading identifier characters (a-z, A-Z, 0-9, _)
+     * @param data Pointer to the first byte to scan
+     * @param length Number of readable bytes
+     * @return size_t Length of the identifier run
+     */
+    static size_t scanIdentifier(const char* data, size_t length);
+
+    /**
+     * @brief Finds the first closing quote or newline of a string body
+     * @param data Pointer to the first byte to scan
+     * @param length Number of readable bytes
+     * @return size_t Offset of the first '"' or '\n', or length if there is none
+     */
+    static size_t findStringDelimiter(const char* data, size_t length);
+
+    /**
+     * @brief Counts the newline characters in a block of bytes
+     * @param data Pointer to the first byte to scan
+     * @param length Number of readable bytes
+     * @return size_t Number of '\n' bytes
+     */
+    static size_t countNewlines(const char* data, size_t length);
+
+    /**
+     * @brief Gets the instruction set the kernels currently use
+     * @return SimdLevel The active level
+     */
+    static SimdLevel getLevel();
+
+    /**
+     * @brief Gets the best instruction set supported by this CPU
+     * @return SimdLevel The detected level
+     */
+    static SimdLevel detectLevel();
+
+    /**
+     * @brief Selects the kernels to use, clamped to what the CPU supports
+     *
+     * Mainly useful for tests and benchmarks comparing kernels. Safe to call
+     * while other threads are lexing; they switch kernels on their next call.
+     *
+     * @param level The requested level
+     */
+    static void setLevel(SimdLevel level);
+};
+
+}  // namespace opal
@@ -0,0 +1,81 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/SymbolTable.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace opal;
+
+std::string_view SymbolTable::store(std::string_view name) {
+    if (name.empty()) {
+        return std::string_view();
+    }
+
+    if (name.size() > BLOCK_SIZE) {
+        // Oversized names get a dedicated block, inserted before the current one so it stays open
+        auto block = std::make_unique<char[]>(name.size());
+        std::memcpy(block.get(), name.data(), name.size());
+        std::string_view stored(block.get(), name.size());
+        this->_blocks.insert(this->_blocks.empty() ? this->_blocks.end() : this->_blocks.end() - 1, std::move(block));
+        return stored;
+    }
+
+    if (this->_blockUsed + name.size() > BLOCK_SIZE) {
+        this->_blocks.push_back(std::make_unique<char[]>(BLOCK_SIZE));
+        this->_blockUsed = 0;
+    }
+
+    char* destination = this->_blocks.back().get() + this->_blockUsed;
+    std::memcpy(destination, name.data(), name.size());
+    this->_blockUsed += name.size();
+    return std::string_view(destination, name.size());
+}
+
+uint32_t SymbolTable::intern(std::string_view name) {
+    auto found = this->_ids.find(name);
+    if (found != this->_ids.end()) {
+        return found->second;
+    }
+
+    if (this->_names.size() >= NO_SYMBOL) {
+        throw std::runtime_error("Too many distinct identifiers");
+    }
+
+    std::string_view stored = this->store(name);
+    uint32_t         id     = static_cast<uint32_t>(this->_names.size());
+    this->_names.push_back(stored);
+    this->_ids.emplace(stored, id);
+    return id;
+}
+
+uint32_t SymbolTable::find(std::string_view name) const {
+    auto found = this->_ids.find(name);
+    return found == this->_ids.end() ? NO_SYMBOL : found->second;
+}
+
+void SymbolTable::clear() {
+    this->_blocks.clear();
+    this->_blockUsed = BLOCK_SIZE;
+    this->_names.clear();
+    this->_ids.clear();
+}
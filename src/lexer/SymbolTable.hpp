@@ -0,0 +1,107 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class SymbolTable
+ * @brief Interns identifiers into dense 32-bit ids
+ *
+ * Every distinct name is stored once and gets the next free id, so names can
+ * be compared as integers and their text is shared by every token and node
+ * that refers to them. Names are copied into fixed blocks that never move,
+ * which keeps the views returned by name valid until the table is cleared or
+ * destroyed, including after a move.
+ */
+class SymbolTable {
+private:
+    /**
+     * @brief Size of a storage block, names longer than this get a block of their own
+     */
+    static constexpr size_t BLOCK_SIZE = 16 * 1024;
+
+    std::vector<std::unique_ptr<char[]>>           _blocks;
+    size_t                                         _blockUsed = BLOCK_SIZE;
+    std::vector<std::string_view>                  _names;
+    std::unordered_map<std::string_view, uint32_t> _ids;
+
+    /**
+     * @brief Copies a name into block storage
+     * @param name The name to copy
+     * @return std::string_view The stored copy
+     */
+    std::string_view store(std::string_view name);
+
+public:
+    /**
+     * @brief Sentinel returned by find for names that were never interned
+     */
+    static constexpr uint32_t NO_SYMBOL = UINT32_MAX;
+
+    SymbolTable()                              = default;
+    SymbolTable(SymbolTable&&)                 = default;
+    SymbolTable& operator=(SymbolTable&&)      = default;
+    SymbolTable(const SymbolTable&)            = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    /**
+     * @brief Gets the id of a name, interning it on first sight
+     * @param name The name to intern
+     * @return uint32_t The id of the name
+     */
+    uint32_t intern(std::string_view name);
+
+    /**
+     * @brief Gets the id of a name without interning it
+     * @param name The name to look up
+     * @return uint32_t The id of the name, or NO_SYMBOL if it was never interned
+     */
+    uint32_t find(std::string_view name) const;
+
+    /**
+     * @brief Gets the name of an id
+     * @param id An id returned by intern
+     * @return std::string_view The interned name, owned by the table
+     */
+    std::string_view name(uint32_t id) const { return _names[id]; }
+
+    /**
+     * @brief Gets the number of interned names
+     * @return size_t The symbol count
+     */
+    size_t size() const { return _names.size(); }
+
+    /**
+     * @brief Removes every name, invalidating all ids and views
+     */
+    void clear();
+};
+
+}  // namespace opal
@@ -23,6 +23,7 @@
 
 #include "opal/lexer/TokenType.hpp"
 
+#include <cstdint>
 #include <string_view>
 
 namespace opal {
@@ -34,10 +35,17 @@ namespace opal {
  * A token is the smallest unit of meaning in the language, such as keywords,
  * identifiers, operators, and literals. Each token contains information about
  * its type, value, and position in the source code.
+ *
+ * The payload indexes data the lexer decoded for the token: the LiteralTable
+ * entry of a NUMBER token or the SymbolTable id of an IDENTIFIER token. It is
+ * NO_PAYLOAD otherwise.
  */
 class Token {
 public:
+    static constexpr uint32_t NO_PAYLOAD = UINT32_MAX;
+
     TokenType        type;
+    uint32_t         payload = NO_PAYLOAD;
     std::string_view value;
     int              line;
     int              column;
@@ -51,6 +59,12 @@ public:
      */
     Token(TokenType type, std::string_view value, int line, int column)
         : type(type), value(value), line(line), column(column) {}
+
+    /**
+     * @brief Checks if the token carries a payload
+     * @return bool True if the payload indexes decoded data, false otherwise
+     */
+    bool hasPayload() const { return payload != NO_PAYLOAD; }
 };
 
 }  // namespace opal
\ No newline at end of file
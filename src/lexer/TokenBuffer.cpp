@@ -0,0 +1,115 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/TokenBuffer.hpp"
+
+#include "opal/lexer/Token.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+using namespace opal;
+
+namespace {
+
+constexpr std::string_view EOF_VALUE = "EOF";
+
+}  // namespace
+
+TokenBuffer::TokenBuffer(std::string_view    source,
+                         const LineIndex&    lines,
+                         const LiteralTable* literals,
+                         SymbolTable*        symbols)
+    : _source(source), _lines(&lines), _literals(literals), _symbols(symbols) {
+    if (source.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("Source is too large for a token buffer");
+    }
+}
+
+void TokenBuffer::push(const Token& token) {
+    uint32_t offset = static_cast<uint32_t>(this->_source.size());
+    uint32_t length = 0;
+
+    if (token.type != TokenType::EOF_TOKEN) {
+        const char* begin = this->_source.data();
+        const char* end   = begin + this->_source.size();
+        if (token.value.data() < begin || token.value.data() + token.value.size() > end) {
+            throw std::runtime_error("Token value does not belong to the buffer source");
+        }
+        offset = static_cast<uint32_t>(token.value.data() - begin);
+        length = static_cast<uint32_t>(token.value.size());
+    }
+
+    this->_types.push_back(static_cast<uint8_t>(token.type));
+    this->_offsets.push_back(offset);
+    this->_lengths.push_back(length);
+    this->_payloads.push_back(token.payload);
+}
+
+void TokenBuffer::assign(const uint8_t*  types,
+                         const uint32_t* offsets,
+                         const uint32_t* lengths,
+                         const uint32_t* payloads,
+                         size_t          count) {
+    this->_types.assign(types, types + count);
+    this->_offsets.assign(offsets, offsets + count);
+    this->_lengths.assign(lengths, lengths + count);
+    this->_payloads.assign(payloads, payloads + count);
+}
+
+void TokenBuffer::reserve(size_t count) {
+    this->_types.reserve(count);
+    this->_offsets.reserve(count);
+    this->_lengths.reserve(count);
+    this->_payloads.reserve(count);
+}
+
+std::string_view TokenBuffer::value(size_t index) const {
+    if (this->type(index) == TokenType::EOF_TOKEN) {
+        return EOF_VALUE;
+    }
+    return this->_source.substr(this->_offsets[index], this->_lengths[index]);
+}
+
+Token TokenBuffer::toToken(size_t index) const {
+    SourcePosition position = this->_lines->resolve(this->startOffset(index));
+    Token          token(this->type(index), this->value(index), position.line, position.column);
+    token.payload = this->_payloads[index];
+    return token;
+}
+
+size_t TokenBuffer::memoryUsage() const {
+    return this->size() * (sizeof(uint8_t) + 3 * sizeof(uint32_t));
+}
+
+Token TokenBuffer::Cursor::next() {
+    if (this->_next < this->_buffer.size()) {
+        size_t         index    = this->_next++;
+        SourcePosition position = this->_positions.resolve(this->_buffer.startOffset(index));
+        Token          token(this->_buffer.type(index), this->_buffer.value(index), position.line, position.column);
+        token.payload = this->_buffer._payloads[index];
+        return token;
+    }
+
+    SourcePosition end = this->_positions.resolve(this->_buffer._source.size());
+    return Token(TokenType::EOF_TOKEN, EOF_VALUE, end.line, end.column);
+}
@@ -0,0 +1,339 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/LineIndex.hpp"
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
+#include "opal/lexer/Token.hpp"
+#include "opal/lexer/TokenSource.hpp"
+#include "opal/lexer/TokenType.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace opal {
+
+class TokenBuffer;
+
+/**
+ * @class TokenView
+ * @brief Lightweight handle to one token stored in a TokenBuffer
+ *
+ * Only holds the buffer and an index; every field is read from the buffer
+ * arrays when requested. The view is invalidated when the buffer is destroyed.
+ */
+class TokenView {
+private:
+    const TokenBuffer* _buffer;
+    size_t             _index;
+
+public:
+    /**
+     * @brief Constructs a new TokenView object
+     * @param buffer The buffer holding the token
+     * @param index The index of the token in the buffer
+     */
+    TokenView(const TokenBuffer& buffer, size_t index) : _buffer(&buffer), _index(index) {}
+
+    /**
+     * @brief Gets the type of the token
+     * @return TokenType The token type
+     */
+    TokenType type() const;
+
+    /**
+     * @brief Gets the lexeme of the token
+     * @return std::string_view The token text
+     */
+    std::string_view value() const;
+
+    /**
+     * @brief Gets the line the token appears on
+     * @return int The line number
+     */
+    int line() const;
+
+    /**
+     * @brief Gets the column the token starts at
+     * @return int The column number
+     */
+    int column() const;
+
+    /**
+     * @brief Materializes the token
+     * @return Token A full token with the same fields
+     */
+    Token toToken() const;
+};
+
+/**
+ * @class TokenBuffer
+ * @brief Compact struct-of-arrays storage for a token sequence
+ *
+ * Types are stored as single bytes and lexemes as 32-bit offsets and lengths
+ * into the source, so type scans only touch one byte per token. Lines and
+ * columns are not stored: they are resolved from the token offset through the
+ * source line index when requested. Token payloads are kept alongside and
+ * index the literal and symbol tables of the lexer that produced them. The
+ * source, its line index and those tables must outlive the buffer, as the
+ * source must for Token values.
+ */
+class TokenBuffer {
+public:
+    /**
+     * @class Cursor
+     * @brief Token source reading a TokenBuffer front to back
+     *
+     * Lets the parser consume a buffer through its streaming interface. An EOF
+     * token is returned on every call past the end of the buffer.
+     */
+    class Cursor : public TokenSource {
+    private:
+        const TokenBuffer& _buffer;
+        LineIndex::Cursor  _positions;
+        size_t             _next = 0;
+
+    public:
+        /**
+         * @brief Constructs a new Cursor object
+         * @param buffer The buffer to read, which must outlive the cursor
+         */
+        explicit Cursor(const TokenBuffer& buffer) : _buffer(buffer), _positions(*buffer._lines) {}
+
+        /**
+         * @brief Materializes the next token of the buffer
+         * @return Token The next token, or an EOF token past the end
+         */
+        Token next() override;
+
+        /**
+         * @brief Gets the table the payloads of NUMBER tokens index into
+         * @return const LiteralTable* The literal table of the buffer, or nullptr if none
+         */
+        const LiteralTable* literals() const override { return this->_buffer._literals; }
+
+        /**
+         * @brief Gets the table the payloads of IDENTIFIER tokens index into
+         * @return SymbolTable* The symbol table of the buffer, or nullptr if none
+         */
+        SymbolTable* symbols() const override { return this->_buffer._symbols; }
+    };
+
+private:
+    std::string_view      _source;
+    const LineIndex*      _lines;
+    const LiteralTable*   _literals;
+    SymbolTable*          _symbols;
+    std::vector<uint8_t>  _types;
+    std::vector<uint32_t> _offsets;
+    std::vector<uint32_t> _lengths;
+    std::vector<uint32_t> _payloads;
+
+    /**
+     * @brief Gets the offset a token starts at in the source
+     *
+     * String values exclude their opening quote, so their token starts one byte earlier.
+     *
+     * @param index The token index
+     * @return size_t The offset of the first byte of the lexeme
+     */
+    size_t startOffset(size_t index) const {
+        return _offsets[index] - (this->type(index) == TokenType::STRING ? 1u : 0u);
+    }
+
+public:
+    /**
+     * @brief Constructs a new empty TokenBuffer object
+     * @param source The source text the tokens refer to
+     * @param lines The line index of the source, used to resolve positions
+     * @param literals The table the NUMBER payloads index into, or nullptr if none
+     * @param symbols The table the IDENTIFIER payloads index into, or nullptr if none
+     * @throws std::runtime_error If the source does not fit 32-bit offsets
+     */
+    TokenBuffer(std::string_view    source,
+                const LineIndex&    lines,
+                const LiteralTable* literals = nullptr,
+                SymbolTable*        symbols  = nullptr);
+
+    /**
+     * @brief Appends a token to the buffer
+     *
+     * The token line and column are not kept; they are resolved again from
+     * the value offset when requested.
+     *
+     * @param token The token to append, whose value must point into the source
+     * @throws std::runtime_error If the token value lies outside the source
+     */
+    void push(const Token& token);
+
+    /**
+     * @brief Replaces the content of the buffer with raw token arrays
+     *
+     * Bulk counterpart of push, used to restore a buffer saved through the
+     * data accessors. Values are not checked against the source.
+     *
+     * @param types The token types
+     * @param offsets The value offsets into the source
+     * @param lengths The value lengths
+     * @param payloads The token payloads
+     * @param count The number of tokens in each array
+     */
+    void assign(const uint8_t*  types,
+                const uint32_t* offsets,
+                const uint32_t* lengths,
+                const uint32_t* payloads,
+                size_t          count);
+
+    /**
+     * @brief Gets the array of token types, one byte per token
+     * @return const uint8_t* The type of the first token, followed by the others in order
+     */
+    const uint8_t* typeData() const { return _types.data(); }
+
+    /**
+     * @brief Gets the array of value offsets into the source
+     * @return const uint32_t* The offset of the first token, followed by the others in order
+     */
+    const uint32_t* offsetData() const { return _offsets.data(); }
+
+    /**
+     * @brief Gets the array of value lengths
+     * @return const uint32_t* The length of the first token, followed by the others in order
+     */
+    const uint32_t* lengthData() const { return _lengths.data(); }
+
+    /**
+     * @brief Gets the array of token payloads
+     * @return const uint32_t* The payload of the first token, followed by the others in order
+     */
+    const uint32_t* payloadData() const { return _payloads.data(); }
+
+    /**
+     * @brief Reserves room for a number of tokens
+     * @param count The number of tokens to reserve
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Gets the number of tokens in the buffer
+     * @return size_t The token count
+     */
+    size_t size() const { return _types.size(); }
+
+    /**
+     * @brief Checks whether the buffer holds no token
+     * @return bool True if the buffer is empty, false otherwise
+     */
+    bool empty() const { return _types.empty(); }
+
+    /**
+     * @brief Gets the type of a token
+     * @param index The token index
+     * @return TokenType The token type
+     */
+    TokenType type(size_t index) const { return static_cast<TokenType>(_types[index]); }
+
+    /**
+     * @brief Gets the lexeme of a token
+     * @param index The token index
+     * @return std::string_view The token text
+     */
+    std::string_view value(size_t index) const;
+
+    /**
+     * @brief Gets the line of a token
+     * @param index The token index
+     * @return int The line number
+     */
+    int line(size_t index) const { return _lines->resolve(this->startOffset(index)).line; }
+
+    /**
+     * @brief Gets the column of a token
+     * @param index The token index
+     * @return int The column number
+     */
+    int column(size_t index) const { return _lines->resolve(this->startOffset(index)).column; }
+
+    /**
+     * @brief Gets the payload of a token
+     * @param index The token index
+     * @return uint32_t The token payload, or Token::NO_PAYLOAD if it has none
+     */
+    uint32_t payload(size_t index) const { return _payloads[index]; }
+
+    /**
+     * @brief Gets the table the NUMBER payloads index into
+     * @return const LiteralTable* The literal table, or nullptr if none
+     */
+    const LiteralTable* literals() const { return _literals; }
+
+    /**
+     * @brief Gets the table the IDENTIFIER payloads index into
+     * @return SymbolTable* The symbol table, or nullptr if none
+     */
+    SymbolTable* symbols() const { return _symbols; }
+
+    /**
+     * @brief Gets a view of a token
+     * @param index The token index
+     * @return TokenView A view of the token
+     */
+    TokenView operator[](size_t index) const { return TokenView(*this, index); }
+
+    /**
+     * @brief Materializes a token
+     * @param index The token index
+     * @return Token A full token with the same fields
+     */
+    Token toToken(size_t index) const;
+
+    /**
+     * @brief Gets the number of bytes used by the token arrays
+     * @return size_t The memory footprint of the stored tokens, excluding unused capacity
+     */
+    size_t memoryUsage() const;
+};
+
+inline TokenType TokenView::type() const {
+    return _buffer->type(_index);
+}
+
+inline std::string_view TokenView::value() const {
+    return _buffer->value(_index);
+}
+
+inline int TokenView::line() const {
+    return _buffer->line(_index);
+}
+
+inline int TokenView::column() const {
+    return _buffer->column(_index);
+}
+
+inline Token TokenView::toToken() const {
+    return _buffer->toToken(_index);
+}
+
+}  // namespace opal
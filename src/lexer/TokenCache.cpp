@@ -0,0 +1,358 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/TokenCache.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/TokenType.hpp"
+#include "opal/util/FileUtil.hpp"
+#include "opal/util/HashUtil.hpp"
+#include "opal/util/MappedFile.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+constexpr char     MAGIC[8]        = {'O', 'P', 'A', 'L', 'T', 'O', 'K', '\0'};
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr size_t   ALIGNMENT       = 8;
+
+/**
+ * @struct FileHeader
+ * @brief Fixed header at the start of every cache file
+ */
+struct FileHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t sourceHash;
+    uint64_t sourceSize;
+    uint32_t tokenCount;
+    uint32_t literalCount;
+    uint32_t symbolCount;
+    uint32_t reserved;
+    uint64_t symbolBytes;
+};
+
+/**
+ * @struct FileLayout
+ * @brief Offsets of the sections that follow the header, each aligned to 8 bytes
+ */
+struct FileLayout {
+    size_t types;
+    size_t offsets;
+    size_t lengths;
+    size_t payloads;
+    size_t literals;
+    size_t symbolLengths;
+    size_t symbolBytes;
+    size_t total;
+};
+
+size_t align(size_t offset) {
+    return (offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+FileLayout layoutOf(const FileHeader& header) {
+    FileLayout layout;
+    layout.types         = align(sizeof(FileHeader));
+    layout.offsets       = align(layout.types + header.tokenCount * sizeof(uint8_t));
+    layout.lengths       = align(layout.offsets + header.tokenCount * sizeof(uint32_t));
+    layout.payloads      = align(layout.lengths + header.tokenCount * sizeof(uint32_t));
+    layout.literals      = align(layout.payloads + header.tokenCount * sizeof(uint32_t));
+    layout.symbolLengths = align(layout.literals + header.literalCount * sizeof(NumericLiteral));
+    layout.symbolBytes   = align(layout.symbolLengths + header.symbolCount * sizeof(uint32_t));
+    layout.total         = layout.symbolBytes + header.symbolBytes;
+    return layout;
+}
+
+/**
+ * @brief Checks that every token of a cache file is one the lexer could have produced for the source
+ */
+bool tokensAreValid(const FileHeader& header, const FileLayout& layout, const char* file) {
+    auto types    = reinterpret_cast<const uint8_t*>(file + layout.types);
+    auto offsets  = reinterpret_cast<const uint32_t*>(file + layout.offsets);
+    auto lengths  = reinterpret_cast<const uint32_t*>(file + layout.lengths);
+    auto payloads = reinterpret_cast<const uint32_t*>(file + layout.payloads);
+
+    for (uint32_t i = 0; i < header.tokenCount; i++) {
+        auto type = static_cast<TokenType>(types[i]);
+        if (types[i] > static_cast<uint8_t>(TokenType::ERROR) || type == TokenType::ERROR) {
+            return false;
+        }
+        if (static_cast<uint64_t>(offsets[i]) + lengths[i] > header.sourceSize) {
+            return false;
+        }
+
+        uint32_t payload = payloads[i];
+        if (type == TokenType::NUMBER) {
+            if (payload != Token::NO_PAYLOAD && payload >= header.literalCount) {
+                return false;
+            }
+        } else if (type == TokenType::IDENTIFIER) {
+            if (payload >= header.symbolCount) {
+                return false;
+            }
+        } else if (payload != Token::NO_PAYLOAD) {
+            return false;
+        }
+    }
+
+    return header.tokenCount > 0 && static_cast<TokenType>(types[header.tokenCount - 1]) == TokenType::EOF_TOKEN;
+}
+
+/**
+ * @brief Checks that every literal of a cache file has a kind the lexer could have produced
+ */
+bool literalsAreValid(const FileHeader& header, const FileLayout& layout, const char* file) {
+    for (uint32_t i = 0; i < header.literalCount; i++) {
+        uint8_t kind;
+        std::memcpy(&kind,
+                    file + layout.literals + i * sizeof(NumericLiteral) + offsetof(NumericLiteral, kind),
+                    sizeof(kind));
+        if (kind > static_cast<uint8_t>(NumericKind::FLOAT)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Gets a temporary file name next to a cache file that no other writer uses
+ */
+std::string temporaryPathFor(const std::string& path) {
+    static std::atomic<uint64_t> sequence{0};
+    return path + "." + std::to_string(::getpid()) + "." + std::to_string(sequence.fetch_add(1)) + ".tmp";
+}
+
+/**
+ * @brief Copies tokens and their tables into an entry, symbols only when given
+ */
+void fillEntry(TokenCache::Entry&    entry,
+               const uint8_t*        types,
+               const uint32_t*       offsets,
+               const uint32_t*       lengths,
+               const uint32_t*       payloads,
+               size_t                tokenCount,
+               const NumericLiteral* literals,
+               size_t                literalCount,
+               const SymbolTable*    symbols) {
+    entry.tokens.assign(types, offsets, lengths, payloads, tokenCount);
+    entry.literals.assign(literals, literalCount);
+
+    if (symbols != nullptr) {
+        for (uint32_t id = 0; id < symbols->size(); id++) {
+            entry.symbols.intern(symbols->name(id));
+        }
+    }
+}
+
+}  // namespace
+
+TokenCache::TokenCache(std::string directory) : _directory(std::move(directory)) {}
+
+std::string TokenCache::pathFor(std::string_view source) const {
+    return this->pathFor(HashUtil::hash64(source));
+}
+
+std::string TokenCache::pathFor(uint64_t hash) const {
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+    return (std::filesystem::path(this->_directory) / (std::string(name) + std::string(EXTENSION))).string();
+}
+
+std::unique_ptr<TokenCache::Entry> TokenCache::load(std::string_view source, const LineIndex& lines) const {
+    return this->load(source, HashUtil::hash64(source), lines);
+}
+
+std::unique_ptr<TokenCache::Entry> TokenCache::load(std::string_view source,
+                                                    uint64_t         hash,
+                                                    const LineIndex& lines) const {
+    std::string path = this->pathFor(hash);
+    if (!FileUtil::fileExists(path)) {
+        return nullptr;
+    }
+
+    MappedFile file;
+    try {
+        file = FileUtil::mapFile(path);
+    } catch (const std::runtime_error& e) {
+        spdlog::warn("Ignoring unreadable token cache {}: {}", path, e.what());
+        return nullptr;
+    }
+
+    if (file.size() < sizeof(FileHeader)) {
+        return nullptr;
+    }
+
+    const char* data = file.view().data();
+    FileHeader  header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != FORMAT_VERSION
+        || header.byteOrder != BYTE_ORDER_MARK || header.sourceHash != hash
+        || header.sourceSize != source.size()) {
+        return nullptr;
+    }
+
+    FileLayout layout = layoutOf(header);
+    if (layout.total != file.size() || !tokensAreValid(header, layout, data)
+        || !literalsAreValid(header, layout, data)) {
+        return nullptr;
+    }
+
+    // Names are stored back to back, their lengths must add up to the byte section
+    auto                   symbolLengths = reinterpret_cast<const uint32_t*>(data + layout.symbolLengths);
+    const char*            symbolBytes   = data + layout.symbolBytes;
+    std::unique_ptr<Entry> entry         = std::make_unique<Entry>(source, lines);
+    uint64_t               consumed      = 0;
+
+    for (uint32_t id = 0; id < header.symbolCount; id++) {
+        if (consumed + symbolLengths[id] > header.symbolBytes) {
+            return nullptr;
+        }
+        if (entry->symbols.intern(std::string_view(symbolBytes + consumed, symbolLengths[id])) != id) {
+            return nullptr;
+        }
+        consumed += symbolLengths[id];
+    }
+    if (consumed != header.symbolBytes) {
+        return nullptr;
+    }
+
+    fillEntry(*entry,
+              reinterpret_cast<const uint8_t*>(data + layout.types),
+              reinterpret_cast<const uint32_t*>(data + layout.offsets),
+              reinterpret_cast<const uint32_t*>(data + layout.lengths),
+              reinterpret_cast<const uint32_t*>(data + layout.payloads),
+              header.tokenCount,
+              reinterpret_cast<const NumericLiteral*>(data + layout.literals),
+              header.literalCount,
+              nullptr);
+    return entry;
+}
+
+void TokenCache::store(std::string_view source, const TokenBuffer& tokens) const {
+    this->store(source, HashUtil::hash64(source), tokens);
+}
+
+void TokenCache::store(std::string_view source, uint64_t hash, const TokenBuffer& tokens) const {
+    const LiteralTable* literals = tokens.literals();
+    const SymbolTable*  symbols  = tokens.symbols();
+
+    FileHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version      = FORMAT_VERSION;
+    header.byteOrder    = BYTE_ORDER_MARK;
+    header.sourceHash   = hash;
+    header.sourceSize   = source.size();
+    header.tokenCount   = static_cast<uint32_t>(tokens.size());
+    header.literalCount = literals ? static_cast<uint32_t>(literals->size()) : 0;
+    header.symbolCount  = symbols ? static_cast<uint32_t>(symbols->size()) : 0;
+
+    std::vector<uint32_t> symbolLengths(header.symbolCount);
+    for (uint32_t id = 0; id < header.symbolCount; id++) {
+        symbolLengths[id] = static_cast<uint32_t>(symbols->name(id).size());
+        header.symbolBytes += symbolLengths[id];
+    }
+
+    FileLayout  layout = layoutOf(header);
+    std::string content(layout.total, '\0');
+    char*       out = content.data();
+
+    std::memcpy(out, &header, sizeof(header));
+    std::memcpy(out + layout.types, tokens.typeData(), header.tokenCount * sizeof(uint8_t));
+    std::memcpy(out + layout.offsets, tokens.offsetData(), header.tokenCount * sizeof(uint32_t));
+    std::memcpy(out + layout.lengths, tokens.lengthData(), header.tokenCount * sizeof(uint32_t));
+    std::memcpy(out + layout.payloads, tokens.payloadData(), header.tokenCount * sizeof(uint32_t));
+    if (header.literalCount > 0) {
+        std::memcpy(out + layout.literals, literals->data(), header.literalCount * sizeof(NumericLiteral));
+    }
+    if (header.symbolCount > 0) {
+        std::memcpy(out + layout.symbolLengths, symbolLengths.data(), header.symbolCount * sizeof(uint32_t));
+    }
+
+    size_t written = layout.symbolBytes;
+    for (uint32_t id = 0; id < header.symbolCount; id++) {
+        std::string_view name = symbols->name(id);
+        std::memcpy(out + written, name.data(), name.size());
+        written += name.size();
+    }
+
+    std::string     path = this->pathFor(hash);
+    std::string     temp = temporaryPathFor(path);
+    std::error_code error;
+    std::filesystem::create_directories(this->_directory, error);
+
+    std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+    if (!file.is_open() || !file.write(content.data(), static_cast<std::streamsize>(content.size()))) {
+        throw std::runtime_error("Could not write token cache: " + temp);
+    }
+    file.close();
+
+    std::filesystem::rename(temp, path, error);
+    if (error) {
+        std::filesystem::remove(temp, error);
+        throw std::runtime_error("Could not write token cache: " + path);
+    }
+}
+
+std::unique_ptr<TokenCache::Entry> TokenCache::scan(std::string_view source, const LineIndex& lines) const {
+    uint64_t               hash  = HashUtil::hash64(source);
+    std::unique_ptr<Entry> entry = this->load(source, hash, lines);
+    if (entry) {
+        return entry;
+    }
+
+    Lexer       lexer(source, lines);
+    TokenBuffer buffer = lexer.scanTokenBuffer();
+
+    try {
+        this->store(source, hash, buffer);
+    } catch (const std::runtime_error& e) {
+        spdlog::warn("{}", e.what());
+    }
+
+    entry = std::make_unique<Entry>(source, lines);
+    fillEntry(*entry,
+              buffer.typeData(),
+              buffer.offsetData(),
+              buffer.lengthData(),
+              buffer.payloadData(),
+              buffer.size(),
+              lexer.getLiterals().data(),
+              lexer.getLiterals().size(),
+              &lexer.getSymbols());
+    return entry;
+}
@@ -0,0 +1,152 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/LineIndex.hpp"
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
+#include "opal/lexer/TokenBuffer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace opal {
+
+/**
+ * @class TokenCache
+ * @brief On-disk cache of lexed token streams keyed by source content
+ *
+ * Sources are hashed with HashUtil::hash64 and their TokenBuffer, literal
+ * table and symbol table are saved in one binary file per hash inside the
+ * cache directory. A later run over the same bytes maps that file and copies
+ * the arrays back instead of lexing. Entries whose format version, hash, size
+ * or contents do not check out are ignored and rewritten. Every loaded token
+ * is checked to lie inside the source, so a damaged or colliding entry can
+ * give wrong tokens but never out of bounds ones.
+ */
+class TokenCache {
+public:
+    /**
+     * @brief Version of the file layout, bumped whenever it or the lexer output changes
+     */
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    /**
+     * @brief Extension of cache files
+     */
+    static constexpr std::string_view EXTENSION = ".optok";
+
+    /**
+     * @class Entry
+     * @brief Tokens of one source together with the tables their payloads index into
+     */
+    class Entry {
+    public:
+        LiteralTable literals;
+        SymbolTable  symbols;
+        TokenBuffer  tokens;
+
+        /**
+         * @brief Constructs a new empty Entry object
+         * @param source The source the tokens refer to, which must outlive the entry
+         * @param lines The line index of the source, which must outlive the entry
+         */
+        Entry(std::string_view source, const LineIndex& lines) : tokens(source, lines, &literals, &symbols) {}
+
+        Entry(const Entry&)            = delete;
+        Entry& operator=(const Entry&) = delete;
+    };
+
+    /**
+     * @brief Constructs a new TokenCache object
+     * @param directory Directory holding the cache files, created on first store
+     */
+    explicit TokenCache(std::string directory);
+
+    /**
+     * @brief Gets the cache file used for a source
+     * @param source The source text
+     * @return std::string The path of the cache file, named after the source hash
+     */
+    std::string pathFor(std::string_view source) const;
+
+    /**
+     * @brief Loads the cached tokens of a source
+     * @param source The source text, which must outlive the entry
+     * @param lines The line index of the source, which must outlive the entry
+     * @return std::unique_ptr<Entry> The cached tokens, or nullptr if there is no valid entry
+     */
+    std::unique_ptr<Entry> load(std::string_view source, const LineIndex& lines) const;
+
+    /**
+     * @brief Saves the tokens of a source
+     *
+     * The file is written next to its final path and renamed over it, so
+     * concurrent readers never see a partial entry.
+     *
+     * @param source The source text
+     * @param tokens The tokens of the whole source, with their literal and symbol tables attached
+     * @throws std::runtime_error If the cache file cannot be written
+     */
+    void store(std::string_view source, const TokenBuffer& tokens) const;
+
+    /**
+     * @brief Gets the tokens of a source from the cache, lexing and storing them on a miss
+     * @param source The source text, which must outlive the entry
+     * @param lines The line index of the source, which must outlive the entry
+     * @return std::unique_ptr<Entry> The tokens of the source
+     * @throws std::runtime_error On a lexing error
+     */
+    std::unique_ptr<Entry> scan(std::string_view source, const LineIndex& lines) const;
+
+private:
+    std::string _directory;
+
+    /**
+     * @brief Gets the cache file for a source hash
+     * @param hash The HashUtil::hash64 of the source
+     * @return std::string The path of the cache file
+     */
+    std::string pathFor(uint64_t hash) const;
+
+    /**
+     * @brief Loads the cached tokens of a source whose hash is already known
+     * @param source The source text, which must outlive the entry
+     * @param hash The HashUtil::hash64 of the source
+     * @param lines The line index of the source, which must outlive the entry
+     * @return std::unique_ptr<Entry> The cached tokens, or nullptr if there is no valid entry
+     */
+    std::unique_ptr<Entry> load(std::string_view source, uint64_t hash, const LineIndex& lines) const;
+
+    /**
+     * @brief Writes the tokens of a source whose hash is already known
+     * @param source The source text
+     * @param hash The HashUtil::hash64 of the source
+     * @param tokens The tokens of the whole source, with their literal and symbol tables attached
+     * @throws std::runtime_error If the cache file cannot be written
+     */
+    void store(std::string_view source, uint64_t hash, const TokenBuffer& tokens) const;
+};
+
+}  // namespace opal
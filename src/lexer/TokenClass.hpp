@@ -0,0 +1,181 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/TokenType.hpp"
+
+#include <cstddef>
+
+namespace opal {
+
+/**
+ * @brief Number of entries in a table indexed by TokenType
+ */
+inline constexpr size_t TOKEN_TYPE_COUNT = static_cast<size_t>(TokenType::ERROR) + 1;
+
+/**
+ * @brief Checks if a token type is one of the arithmetic operators
+ * @param type The token type to check
+ * @return bool True for +, -, *, / and %, false otherwise
+ */
+constexpr bool isArithmeticOperator(TokenType type) {
+    switch (type) {
+        case TokenType::PLUS:
+        case TokenType::MINUS:
+        case TokenType::MULTIPLY:
+        case TokenType::DIVIDE:
+        case TokenType::MODULO:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Checks if a token type can be an operand of an arithmetic operation
+ * @param type The token type to check
+ * @return bool True for numbers and identifiers, false otherwise
+ */
+constexpr bool isOperand(TokenType type) {
+    return type == TokenType::NUMBER || type == TokenType::IDENTIFIER;
+}
+
+/**
+ * @brief Checks if a token type is a literal value
+ * @param type The token type to check
+ * @return bool True for numbers, strings, booleans and nil, false otherwise
+ */
+constexpr bool isLiteral(TokenType type) {
+    switch (type) {
+        case TokenType::NUMBER:
+        case TokenType::STRING:
+        case TokenType::TRUE:
+        case TokenType::FALSE:
+        case TokenType::NIL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Checks if a token type is an operator taking a left and a right operand
+ * @param type The token type to check
+ * @return bool True for arithmetic, power, comparison, logical, bitwise, shift and range operators
+ */
+constexpr bool isBinaryOperator(TokenType type) {
+    switch (type) {
+        case TokenType::PLUS:
+        case TokenType::MINUS:
+        case TokenType::MULTIPLY:
+        case TokenType::DIVIDE:
+        case TokenType::MODULO:
+        case TokenType::POWER:
+        case TokenType::EQUAL_EQUAL:
+        case TokenType::NOT_EQUAL:
+        case TokenType::GREATER:
+        case TokenType::GREATER_EQUAL:
+        case TokenType::LESS:
+        case TokenType::LESS_EQUAL:
+        case TokenType::AND:
+        case TokenType::OR:
+        case TokenType::RANGE:
+        case TokenType::BITWISE_AND:
+        case TokenType::BITWISE_OR:
+        case TokenType::BITWISE_XOR:
+        case TokenType::SHIFT_LEFT:
+        case TokenType::SHIFT_RIGHT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Checks if a token type is an operator written before its operand
+ * @param type The token type to check
+ * @return bool True for -, !, ~, ++ and --, false otherwise
+ */
+constexpr bool isPrefixOperator(TokenType type) {
+    switch (type) {
+        case TokenType::MINUS:
+        case TokenType::NOT:
+        case TokenType::BITWISE_NOT:
+        case TokenType::INCREMENT:
+        case TokenType::DECREMENT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Checks if a token type is an operator written after its operand
+ * @param type The token type to check
+ * @return bool True for ++ and --, false otherwise
+ */
+constexpr bool isPostfixOperator(TokenType type) {
+    return type == TokenType::INCREMENT || type == TokenType::DECREMENT;
+}
+
+/**
+ * @brief Checks if a token type is an operator producing a boolean
+ * @param type The token type to check
+ * @return bool True for comparison and logical operators, false otherwise
+ */
+constexpr bool isBooleanOperator(TokenType type) {
+    switch (type) {
+        case TokenType::EQUAL_EQUAL:
+        case TokenType::NOT_EQUAL:
+        case TokenType::GREATER:
+        case TokenType::GREATER_EQUAL:
+        case TokenType::LESS:
+        case TokenType::LESS_EQUAL:
+        case TokenType::AND:
+        case TokenType::OR:
+        case TokenType::NOT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Checks if a token type continues an operation after an operand
+ * @param type The token type to check
+ * @return bool True for binary operators and opening parentheses, false otherwise
+ */
+constexpr bool isOperationToken(TokenType type) {
+    return isBinaryOperator(type) || type == TokenType::LEFT_PAREN;
+}
+
+/**
+ * @brief Checks if a token type can start an expression
+ * @param type The token type to check
+ * @return bool True for literals, identifiers, opening parentheses and prefix operators
+ */
+constexpr bool isExpressionStart(TokenType type) {
+    return isLiteral(type) || type == TokenType::IDENTIFIER || type == TokenType::LEFT_PAREN
+           || isPrefixOperator(type);
+}
+
+}  // namespace opal
@@ -0,0 +1,81 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
+#include "opal/lexer/Token.hpp"
+
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class TokenSource
+ * @brief Produces tokens one at a time on demand
+ *
+ * Lets the parser pull tokens as it needs them instead of requiring the whole
+ * token array up front.
+ */
+class TokenSource {
+public:
+    /**
+     * @brief Virtual destructor for proper inheritance
+     */
+    virtual ~TokenSource() = default;
+
+    /**
+     * @brief Produces the next token
+     * @return Token The next token, or an EOF_TOKEN once the source is exhausted
+     */
+    virtual Token next() = 0;
+
+    /**
+     * @brief Gets the table the payloads of NUMBER tokens index into
+     * @return const LiteralTable* The literal table, or nullptr if tokens carry no payloads
+     */
+    virtual const LiteralTable* literals() const { return nullptr; }
+
+    /**
+     * @brief Gets the table the payloads of IDENTIFIER tokens index into
+     * @return SymbolTable* The symbol table, or nullptr if tokens carry no symbol ids
+     */
+    virtual SymbolTable* symbols() const { return nullptr; }
+
+    /**
+     * @brief Pulls tokens into a window until it holds the given index
+     *
+     * Stops early once the EOF token has been appended.
+     *
+     * @param window The token window to append to
+     * @param index The index that must be available
+     * @return bool True if the window holds a token at index, false otherwise
+     */
+    bool fillWindow(std::vector<Token>& window, size_t index) {
+        while (index >= window.size() && (window.empty() || window.back().type != TokenType::EOF_TOKEN)) {
+            window.push_back(this->next());
+        }
+        return index < window.size();
+    }
+};
+
+}  // namespace opal
@@ -21,18 +21,29 @@
 
 #include "opal/lexer/tokenizer/TokenizerBase.hpp"
 
+#include <stdexcept>
+
 namespace opal {
 
-TokenizerBase::TokenizerBase(const std::string&  source,
-                             int&                current,
-                             int&                line,
-                             int&                column,
-                             int&                start,
-                             std::vector<Token>& tokens)
-    : _source(source), _current(current), _line(line), _column(column), _start(start), _tokens(tokens) {}
+TokenizerBase::TokenizerBase(std::string_view    source,
+                             size_t&             current,
+                             size_t&             start,
+                             LineIndex::Cursor&  positions,
+                             std::vector<Token>& tokens,
+                             LiteralTable&       literals,
+                             SymbolTable&        symbols,
+                             LexDiagnostics&     diagnostics)
+    : _source(source),
+      _current(current),
+      _start(start),
+      _positions(positions),
+      _tokens(tokens),
+      _literals(literals),
+      _symbols(symbols),
+      _diagnostics(diagnostics) {}
 
 bool TokenizerBase::isAtEnd() const {
-    return _current >= static_cast<int>(_source.length());
+    return _current >= _source.length();
 }
 
 char TokenizerBase::peek() const {
@@ -42,22 +53,38 @@ char TokenizerBase::peek() const {
 }
 
 char TokenizerBase::peekNext() const {
-    if (_current + 1 >= static_cast<int>(_source.length()))
+    if (_current + 1 >= _source.length())
         return '\0';
     return _source[_current + 1];
 }
 
 char TokenizerBase::advance() {
-    _column++;
     return _source[_current++];
 }
 
+void TokenizerBase::advanceBy(size_t count) {
+    _current += count;
+}
+
 void TokenizerBase::addToken(TokenType type) {
     this->addToken(type, std::string_view(_source.data() + _start, _current - _start));
 }
 
 void TokenizerBase::addToken(TokenType type, std::string_view value) {
-    _tokens.emplace_back(type, value, _line, _column - (_current - _start));
+    SourcePosition position = _positions.resolve(_start);
+    _tokens.emplace_back(type, value, position.line, position.column);
+}
+
+void TokenizerBase::reportError(LexErrorKind kind) {
+    size_t length = _current - _start;
+    if (!_diagnostics.recovering()) {
+        LexDiagnostic diagnostic = {kind, static_cast<uint32_t>(_start), static_cast<uint32_t>(length)};
+        throw std::runtime_error(LexDiagnostics::format(diagnostic, _source, _positions.index()));
+    }
+
+    uint32_t index = _diagnostics.add(kind, _start, length);
+    this->addToken(TokenType::ERROR);
+    _tokens.back().payload = index;
 }
 
 bool TokenizerBase::isDigit(char c) const {
@@ -21,6 +21,11 @@
 
 #pragma once
 
+#include "opal/lexer/CharClass.hpp"
+#include "opal/lexer/LexDiagnostics.hpp"
+#include "opal/lexer/LineIndex.hpp"
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
 #include "opal/lexer/Token.hpp"
 
 #include <string>
@@ -38,29 +43,35 @@ namespace opal {
  */
 class TokenizerBase {
 protected:
-    const std::string&  _source;
-    int&                _current;
-    int&                _line;
-    int&                _column;
-    int&                _start;
+    std::string_view    _source;
+    size_t&             _current;
+    size_t&             _start;
+    LineIndex::Cursor&  _positions;
     std::vector<Token>& _tokens;
+    LiteralTable&       _literals;
+    SymbolTable&        _symbols;
+    LexDiagnostics&     _diagnostics;
 
 public:
     /**
      * @brief Constructs a new Tokenizer Base object
-     * @param source Reference to the source code
+     * @param source View of the source code
      * @param current Reference to the current position in the source
-     * @param line Reference to the current line number
-     * @param column Reference to the current column number
      * @param start Reference to the start position of the current token
+     * @param positions Reference to the cursor resolving token offsets to lines and columns
      * @param tokens Reference to the token collection
+     * @param literals Reference to the table receiving decoded literals
+     * @param symbols Reference to the table interning identifiers
+     * @param diagnostics Reference to the sink of lexical errors
      */
-    TokenizerBase(const std::string&  source,
-                  int&                current,
-                  int&                line,
-                  int&                column,
-                  int&                start,
-                  std::vector<Token>& tokens);
+    TokenizerBase(std::string_view    source,
+                  size_t&             current,
+                  size_t&             start,
+                  LineIndex::Cursor&  positions,
+                  std::vector<Token>& tokens,
+                  LiteralTable&       literals,
+                  SymbolTable&        symbols,
+                  LexDiagnostics&     diagnostics);
 
     /**
      * @brief Virtual destructor for proper inheritance
@@ -74,6 +85,16 @@ public:
      */
     virtual bool canHandle(char c) const = 0;
 
+    /**
+     * @brief Gets the character class this tokenizer starts on
+     *
+     * Used by the lexer to build its dispatch table. A tokenizer whose class
+     * is shared with another one (e.g. '/') still decides through canHandle.
+     *
+     * @return CharClass The class of the first character of its lexemes
+     */
+    virtual CharClass charClass() const = 0;
+
     /**
      * @brief Tokenizes the current lexeme and adds the resulting token to the collection
      */
@@ -104,6 +125,12 @@ protected:
      */
     char advance();
 
+    /**
+     * @brief Consumes a run of characters
+     * @param count The number of characters to consume
+     */
+    void advanceBy(size_t count);
+
     /**
      * @brief Adds a token with the given type to the collection
      * @param type The type of the token
@@ -117,6 +144,17 @@ protected:
      */
     void addToken(TokenType type, std::string_view value);
 
+    /**
+     * @brief Reports a lexical error on the lexeme scanned so far
+     *
+     * When recovering, records the error and adds an ERROR token covering the
+     * lexeme, so scanning resumes after it.
+     *
+     * @param kind The error kind
+     * @throws std::runtime_error With the error located at the lexeme start, unless recovering
+     */
+    void reportError(LexErrorKind kind);
+
     /**
      * @brief Checks if a character is a digit (0-9)
      * @param c The character to check
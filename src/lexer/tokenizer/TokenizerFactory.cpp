@@ -29,19 +29,26 @@
 
 namespace opal {
 
-std::vector<std::unique_ptr<TokenizerBase>> TokenizerFactory::createTokenizers(const std::string&  source,
-                                                                               int&                current,
-                                                                               int&                line,
-                                                                               int&                column,
-                                                                               int&                start,
-                                                                               std::vector<Token>& tokens) {
+std::vector<std::unique_ptr<TokenizerBase>> TokenizerFactory::createTokenizers(std::string_view    source,
+                                                                               size_t&             current,
+                                                                               size_t&             start,
+                                                                               LineIndex::Cursor&  positions,
+                                                                               std::vector<Token>& tokens,
+                                                                               LiteralTable&       literals,
+                                                                               SymbolTable&        symbols,
+                                                                               LexDiagnostics&     diagnostics) {
     std::vector<std::unique_ptr<TokenizerBase>> tokenizers;
 
-    tokenizers.push_back(std::make_unique<CommentTokenizer>(source, current, line, column, start, tokens));
-    tokenizers.push_back(std::make_unique<StringTokenizer>(source, current, line, column, start, tokens));
-    tokenizers.push_back(std::make_unique<NumberTokenizer>(source, current, line, column, start, tokens));
-    tokenizers.push_back(std::make_unique<OperatorTokenizer>(source, current, line, column, start, tokens));
-    tokenizers.push_back(std::make_unique<IdentifierTokenizer>(source, current, line, column, start, tokens));
+    tokenizers.push_back(std::make_unique<CommentTokenizer>(
+        source, current, start, positions, tokens, literals, symbols, diagnostics));
+    tokenizers.push_back(std::make_unique<StringTokenizer>(
+        source, current, start, positions, tokens, literals, symbols, diagnostics));
+    tokenizers.push_back(std::make_unique<NumberTokenizer>(
+        source, current, start, positions, tokens, literals, symbols, diagnostics));
+    tokenizers.push_back(std::make_unique<OperatorTokenizer>(
+        source, current, start, positions, tokens, literals, symbols, diagnostics));
+    tokenizers.push_back(std::make_unique<IdentifierTokenizer>(
+        source, current, start, positions, tokens, literals, symbols, diagnostics));
 
     return tokenizers;
 }
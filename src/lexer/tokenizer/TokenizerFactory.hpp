@@ -39,20 +39,24 @@ class TokenizerFactory {
 public:
     /**
      * @brief Creates a collection of tokenizers for lexical analysis
-     * @param source Reference to the source code
+     * @param source View of the source code
      * @param current Reference to the current position in the source
-     * @param line Reference to the current line number
-     * @param column Reference to the current column number
      * @param start Reference to the start position of the current token
+     * @param positions Reference to the cursor resolving token offsets to lines and columns
      * @param tokens Reference to the token collection
+     * @param literals Reference to the table receiving decoded literals
+     * @param symbols Reference to the table interning identifiers
+     * @param diagnostics Reference to the sink of lexical errors
      * @return std::vector<std::unique_ptr<TokenizerBase>> A collection of initialized tokenizers
      */
-    static std::vector<std::unique_ptr<TokenizerBase>> createTokenizers(const std::string&  source,
-                                                                        int&                current,
-                                                                        int&                line,
-                                                                        int&                column,
-                                                                        int&                start,
-                                                                        std::vector<Token>& tokens);
+    static std::vector<std::unique_ptr<TokenizerBase>> createTokenizers(std::string_view    source,
+                                                                        size_t&             current,
+                                                                        size_t&             start,
+                                                                        LineIndex::Cursor&  positions,
+                                                                        std::vector<Token>& tokens,
+                                                                        LiteralTable&       literals,
+                                                                        SymbolTable&        symbols,
+                                                                        LexDiagnostics&     diagnostics);
 };
 
 }  // namespace opal
\ No newline at end of file
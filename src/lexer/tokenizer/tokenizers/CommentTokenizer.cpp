@@ -21,10 +21,6 @@
 
 #include "opal/lexer/tokenizer/tokenizers/CommentTokenizer.hpp"
 
-#include "opal/util/ErrorUtil.hpp"
-
-#include <stdexcept>
-
 using namespace opal;
 
 bool CommentTokenizer::canHandle(char c) const {
@@ -34,6 +30,10 @@ bool CommentTokenizer::canHandle(char c) const {
     return next == '/' || next == '*';
 }
 
+CharClass CommentTokenizer::charClass() const {
+    return CharClass::SLASH;
+}
+
 void CommentTokenizer::tokenize() {
     this->advance();
     if (this->peek() == '/') {
@@ -65,16 +65,13 @@ void CommentTokenizer::handleMultiLineComment() {
             this->advance();
             nesting++;
         } else {
-            if (this->peek() == '\n') {
-                this->_line++;
-                this->_column = 1;
-            }
             this->advance();
         }
     }
 
     if (nesting > 0) {
-        throw std::runtime_error(ErrorUtil::errorMessage("Unterminated multi-line comment", this->_line, 1));
+        this->reportError(LexErrorKind::UNTERMINATED_COMMENT);
+        return;
     }
 
     this->addToken(TokenType::COMMENT);
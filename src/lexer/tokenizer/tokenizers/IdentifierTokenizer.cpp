@@ -21,31 +21,28 @@
 
 #include "opal/lexer/tokenizer/tokenizers/IdentifierTokenizer.hpp"
 
-using namespace opal;
+#include "opal/lexer/SimdScanner.hpp"
 
-const std::unordered_map<std::string_view, TokenType> IdentifierTokenizer::_keywords = {
-    {"class", TokenType::CLASS},     {"fn", TokenType::FN},           {"if", TokenType::IF},
-    {"elif", TokenType::ELIF},       {"else", TokenType::ELSE},       {"while", TokenType::WHILE},
-    {"for", TokenType::FOR},         {"foreach", TokenType::FOREACH}, {"in", TokenType::IN},
-    {"try", TokenType::TRY},         {"catch", TokenType::CATCH},     {"finally", TokenType::FINALLY},
-    {"ret", TokenType::RET},         {"this", TokenType::THIS},       {"true", TokenType::TRUE},
-    {"false", TokenType::FALSE},     {"nil", TokenType::NIL},         {"and", TokenType::AND},
-    {"or", TokenType::OR},           {"not", TokenType::NOT},         {"const", TokenType::CONST},
-    {"enum", TokenType::ENUM},       {"switch", TokenType::SWITCH},   {"case", TokenType::CASE},
-    {"default", TokenType::DEFAULT}, {"break", TokenType::BREAK},     {"continue", TokenType::CONTINUE},
-    {"load", TokenType::LOAD}};
+using namespace opal;
 
 bool IdentifierTokenizer::canHandle(char c) const {
     return this->isAlpha(c);
 }
 
+CharClass IdentifierTokenizer::charClass() const {
+    return CharClass::IDENTIFIER;
+}
+
 void IdentifierTokenizer::tokenize() {
-    while (this->isAlphaNumeric(this->peek())) {
-        this->advance();
-    }
+    const char* data      = this->_source.data() + this->_current;
+    size_t      remaining = this->_source.length() - this->_current;
+    this->advanceBy(SimdScanner::scanIdentifier(data, remaining));
 
     std::string_view text(this->_source.data() + this->_start, this->_current - this->_start);
-    std::unordered_map<std::string_view, TokenType>::const_iterator it = this->_keywords.find(text);
-    TokenType type = it != this->_keywords.end() ? it->second : TokenType::IDENTIFIER;
+    TokenType        type = lookupKeyword(text);
     this->addToken(type, text);
+
+    if (type == TokenType::IDENTIFIER) {
+        this->_tokens.back().payload = this->_symbols.intern(text);
+    }
 }
@@ -24,7 +24,6 @@
 #include "opal/lexer/tokenizer/TokenizerBase.hpp"
 
 #include <string_view>
-#include <unordered_map>
 
 namespace opal {
 
@@ -49,19 +48,124 @@ public:
      */
     bool canHandle(char c) const override;
 
+    /**
+     * @brief Gets the character class this tokenizer starts on
+     * @return CharClass Always CharClass::IDENTIFIER
+     */
+    CharClass charClass() const override;
+
     /**
      * @brief Processes an identifier and creates a corresponding token
      *
      * Determines if the identifier is a keyword or a user-defined identifier
-     * and creates the appropriate token type.
+     * and creates the appropriate token type. User-defined identifiers are
+     * interned, their token payload holding the symbol id.
      */
     void tokenize() override;
 
+    /**
+     * @brief Resolves a word to its keyword token type
+     *
+     * Switches on the length and first character, so at most a couple of
+     * fixed-size comparisons are made and nothing is hashed or allocated.
+     *
+     * @param text The identifier text
+     * @return TokenType The keyword type, or TokenType::IDENTIFIER if the word is not a keyword
+     */
+    static constexpr TokenType lookupKeyword(std::string_view text) {
+        switch (text.size()) {
+            case 2:
+                switch (text[0]) {
+                    case 'f':
+                        return matchKeyword(text, "fn", TokenType::FN);
+                    case 'i':
+                        return text[1] == 'f' ? TokenType::IF : matchKeyword(text, "in", TokenType::IN);
+                    case 'o':
+                        return matchKeyword(text, "or", TokenType::OR);
+                    default:
+                        return TokenType::IDENTIFIER;
+                }
+            case 3:
+                switch (text[0]) {
+                    case 'f':
+                        return matchKeyword(text, "for", TokenType::FOR);
+                    case 't':
+                        return matchKeyword(text, "try", TokenType::TRY);
+                    case 'r':
+                        return matchKeyword(text, "ret", TokenType::RET);
+                    case 'n':
+                        return text[1] == 'i' ? matchKeyword(text, "nil", TokenType::NIL)
+                                              : matchKeyword(text, "not", TokenType::NOT);
+                    case 'a':
+                        return matchKeyword(text, "and", TokenType::AND);
+                    default:
+                        return TokenType::IDENTIFIER;
+                }
+            case 4:
+                switch (text[0]) {
+                    case 'e':
+                        if (text[1] == 'l') {
+                            return text[2] == 'i' ? matchKeyword(text, "elif", TokenType::ELIF)
+                                                  : matchKeyword(text, "else", TokenType::ELSE);
+                        }
+                        return matchKeyword(text, "enum", TokenType::ENUM);
+                    case 't':
+                        return text[1] == 'h' ? matchKeyword(text, "this", TokenType::THIS)
+                                              : matchKeyword(text, "true", TokenType::TRUE);
+                    case 'c':
+                        return matchKeyword(text, "case", TokenType::CASE);
+                    case 'l':
+                        return matchKeyword(text, "load", TokenType::LOAD);
+                    default:
+                        return TokenType::IDENTIFIER;
+                }
+            case 5:
+                switch (text[0]) {
+                    case 'c':
+                        if (text[1] == 'l') {
+                            return matchKeyword(text, "class", TokenType::CLASS);
+                        }
+                        return text[1] == 'a' ? matchKeyword(text, "catch", TokenType::CATCH)
+                                              : matchKeyword(text, "const", TokenType::CONST);
+                    case 'w':
+                        return matchKeyword(text, "while", TokenType::WHILE);
+                    case 'f':
+                        return matchKeyword(text, "false", TokenType::FALSE);
+                    case 'b':
+                        return matchKeyword(text, "break", TokenType::BREAK);
+                    default:
+                        return TokenType::IDENTIFIER;
+                }
+            case 6:
+                return matchKeyword(text, "switch", TokenType::SWITCH);
+            case 7:
+                switch (text[0]) {
+                    case 'f':
+                        return text[1] == 'o' ? matchKeyword(text, "foreach", TokenType::FOREACH)
+                                              : matchKeyword(text, "finally", TokenType::FINALLY);
+                    case 'd':
+                        return matchKeyword(text, "default", TokenType::DEFAULT);
+                    default:
+                        return TokenType::IDENTIFIER;
+                }
+            case 8:
+                return matchKeyword(text, "continue", TokenType::CONTINUE);
+            default:
+                return TokenType::IDENTIFIER;
+        }
+    }
+
 private:
     /**
-     * @brief Map of keyword strings to their corresponding token types
+     * @brief Compares a word against a single keyword candidate
+     * @param text The identifier text
+     * @param keyword The keyword with the same length and first character
+     * @param type The token type of the keyword
+     * @return TokenType type if text is the keyword, TokenType::IDENTIFIER otherwise
      */
-    static const std::unordered_map<std::string_view, TokenType> _keywords;
+    static constexpr TokenType matchKeyword(std::string_view text, std::string_view keyword, TokenType type) {
+        return text == keyword ? type : TokenType::IDENTIFIER;
+    }
 };
 
 }  // namespace opal
\ No newline at end of file
@@ -27,6 +27,10 @@ bool NumberTokenizer::canHandle(char c) const {
     return this->isDigit(c);
 }
 
+CharClass NumberTokenizer::charClass() const {
+    return CharClass::DIGIT;
+}
+
 void NumberTokenizer::tokenize() {
     while (this->isDigit(this->peek()))
         this->advance();
@@ -38,5 +42,12 @@ void NumberTokenizer::tokenize() {
             this->advance();
     }
 
-    this->addToken(TokenType::NUMBER);
+    std::string_view lexeme(this->_source.data() + this->_start, this->_current - this->_start);
+    this->addToken(TokenType::NUMBER, lexeme);
+
+    // Literals that do not fit their type keep no payload, the parser reports them where they are used
+    NumericLiteral literal;
+    if (LiteralTable::decode(lexeme, literal)) {
+        this->_tokens.back().payload = this->_literals.add(literal);
+    }
 }
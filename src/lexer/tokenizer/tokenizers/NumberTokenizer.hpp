@@ -46,8 +46,18 @@ public:
      */
     bool canHandle(char c) const override;
 
+    /**
+     * @brief Gets the character class this tokenizer starts on
+     * @return CharClass Always CharClass::DIGIT
+     */
+    CharClass charClass() const override;
+
     /**
      * @brief Processes a numeric literal and creates a corresponding token
+     *
+     * The literal is decoded once here and stored in the literal table, the
+     * token payload holding its index. A literal that does not fit its type
+     * is left without a payload.
      */
     void tokenize() override;
 };
@@ -23,11 +23,17 @@
 
 #include "opal/lexer/tokenizer/TokenizerBase.hpp"
 
-#include <string_view>
-#include <unordered_map>
-
 namespace opal {
 
+/**
+ * @struct OperatorMatch
+ * @brief Result of matching an operator at the current position
+ */
+struct OperatorMatch {
+    TokenType type;    ///< The matched operator type
+    int       length;  ///< Number of characters matched, 0 if no operator starts here
+};
+
 /**
  * @class OperatorTokenizer
  * @brief Tokenizer for handling operators and symbols
@@ -49,16 +55,102 @@ public:
      */
     bool canHandle(char c) const override;
 
+    /**
+     * @brief Gets the character class this tokenizer starts on
+     * @return CharClass Always CharClass::OPERATOR
+     */
+    CharClass charClass() const override;
+
     /**
      * @brief Processes an operator sequence and creates a corresponding token
      */
     void tokenize() override;
 
-private:
     /**
-     * @brief Map of operator strings to their corresponding token types
+     * @brief Finds the longest operator starting with the given characters
+     *
+     * The 1, 2 and 3 character candidates are resolved in a single switch,
+     * without building any temporary string.
+     *
+     * @param first The first character
+     * @param second The character after it, or '\0' at the end of source
+     * @param third The character after that, or '\0' at the end of source
+     * @return OperatorMatch The matched type and length, length is 0 if none matches
      */
-    static const std::unordered_map<std::string_view, TokenType> _operators;
+    static constexpr OperatorMatch matchOperator(char first, char second, char third) {
+        switch (first) {
+            case '(':
+                return {TokenType::LEFT_PAREN, 1};
+            case ')':
+                return {TokenType::RIGHT_PAREN, 1};
+            case '{':
+                return {TokenType::LEFT_BRACE, 1};
+            case '}':
+                return {TokenType::RIGHT_BRACE, 1};
+            case '[':
+                return {TokenType::LEFT_BRACKET, 1};
+            case ']':
+                return {TokenType::RIGHT_BRACKET, 1};
+            case ',':
+                return {TokenType::COMMA, 1};
+            case ':':
+                return {TokenType::COLON, 1};
+            case ';':
+                return {TokenType::SEMICOLON, 1};
+            case '~':
+                return {TokenType::BITWISE_NOT, 1};
+            case '.':
+                return second == '.' ? OperatorMatch{TokenType::RANGE, 2} : OperatorMatch{TokenType::DOT, 1};
+            case '+':
+                if (second == '+')
+                    return {TokenType::INCREMENT, 2};
+                return second == '=' ? OperatorMatch{TokenType::PLUS_EQUAL, 2} : OperatorMatch{TokenType::PLUS, 1};
+            case '-':
+                if (second == '-')
+                    return {TokenType::DECREMENT, 2};
+                return second == '=' ? OperatorMatch{TokenType::MINUS_EQUAL, 2} : OperatorMatch{TokenType::MINUS, 1};
+            case '*':
+                return second == '=' ? OperatorMatch{TokenType::MULTIPLY_EQUAL, 2}
+                                     : OperatorMatch{TokenType::MULTIPLY, 1};
+            case '/':
+                return second == '=' ? OperatorMatch{TokenType::DIVIDE_EQUAL, 2} : OperatorMatch{TokenType::DIVIDE, 1};
+            case '%':
+                return second == '=' ? OperatorMatch{TokenType::MODULO_EQUAL, 2} : OperatorMatch{TokenType::MODULO, 1};
+            case '^':
+                return second == '=' ? OperatorMatch{TokenType::POWER_EQUAL, 2} : OperatorMatch{TokenType::POWER, 1};
+            case '=':
+                return second == '=' ? OperatorMatch{TokenType::EQUAL_EQUAL, 2} : OperatorMatch{TokenType::EQUAL, 1};
+            case '!':
+                return second == '=' ? OperatorMatch{TokenType::NOT_EQUAL, 2} : OperatorMatch{TokenType::NOT, 1};
+            case '#':
+                return second == '=' ? OperatorMatch{TokenType::XOR_EQUAL, 2}
+                                     : OperatorMatch{TokenType::BITWISE_XOR, 1};
+            case '&':
+                if (second == '&')
+                    return {TokenType::AND, 2};
+                return second == '=' ? OperatorMatch{TokenType::AND_EQUAL, 2}
+                                     : OperatorMatch{TokenType::BITWISE_AND, 1};
+            case '|':
+                if (second == '|')
+                    return {TokenType::OR, 2};
+                return second == '=' ? OperatorMatch{TokenType::OR_EQUAL, 2} : OperatorMatch{TokenType::BITWISE_OR, 1};
+            case '<':
+                if (second == '<') {
+                    return third == '=' ? OperatorMatch{TokenType::SHIFT_LEFT_EQUAL, 3}
+                                        : OperatorMatch{TokenType::SHIFT_LEFT, 2};
+                }
+                return second == '=' ? OperatorMatch{TokenType::LESS_EQUAL, 2} : OperatorMatch{TokenType::LESS, 1};
+            case '>':
+                if (second == '>') {
+                    return third == '=' ? OperatorMatch{TokenType::SHIFT_RIGHT_EQUAL, 3}
+                                        : OperatorMatch{TokenType::SHIFT_RIGHT, 2};
+                }
+                return second == '=' ? OperatorMatch{TokenType::GREATER_EQUAL, 2}
+                                     : OperatorMatch{TokenType::GREATER, 1};
+            default:
+                return {TokenType::ERROR, 0};
+        }
+    }
 };
 
 }  // namespace opal
\ No newline at end of file
@@ -21,9 +21,7 @@
 
 #include "opal/lexer/tokenizer/tokenizers/StringTokenizer.hpp"
 
-#include "opal/util/ErrorUtil.hpp"
-
-#include <stdexcept>
+#include "opal/lexer/SimdScanner.hpp"
 
 using namespace opal;
 
@@ -31,19 +29,27 @@ bool StringTokenizer::canHandle(char c) const {
     return c == '"';
 }
 
+CharClass StringTokenizer::charClass() const {
+    return CharClass::QUOTE;
+}
+
 void StringTokenizer::tokenize() {
     this->advance();
 
-    while (this->peek() != '"' && !this->isAtEnd()) {
-        if (this->peek() == '\n') {
-            this->_line++;
-            this->_column = 1;
+    while (!this->isAtEnd()) {
+        const char* data      = this->_source.data() + this->_current;
+        size_t      remaining = this->_source.length() - this->_current;
+        this->advanceBy(SimdScanner::findStringDelimiter(data, remaining));
+
+        if (this->peek() != '\n') {
+            break;
         }
         this->advance();
     }
 
     if (this->isAtEnd()) {
-        throw std::runtime_error(ErrorUtil::errorMessage("Unterminated string", this->_line, 1));
+        this->reportError(LexErrorKind::UNTERMINATED_STRING);
+        return;
     }
 
     this->advance();
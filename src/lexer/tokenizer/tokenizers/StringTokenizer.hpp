@@ -46,6 +46,12 @@ public:
      */
     bool canHandle(char c) const override;
 
+    /**
+     * @brief Gets the character class this tokenizer starts on
+     * @return CharClass Always CharClass::QUOTE
+     */
+    CharClass charClass() const override;
+
     /**
      * @brief Processes a string literal and creates a corresponding token
      */
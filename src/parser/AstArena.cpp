@@ -0,0 +1,47 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/AstArena.hpp"
+
+using namespace opal;
+
+void* AstArena::allocateSlow(size_t size, size_t alignment) {
+    if (size > BLOCK_SIZE / 2) {
+        // Large arrays get a dedicated block, inserted before the current one so it stays open
+        auto  block  = std::make_unique_for_overwrite<std::byte[]>(size);
+        void* memory = block.get();
+        this->_blocks.insert(this->_blocks.empty() ? this->_blocks.end() : this->_blocks.end() - 1, std::move(block));
+        this->_bytesUsed += size;
+        return memory;
+    }
+
+    this->_blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(BLOCK_SIZE));
+    this->_cursor = this->_blocks.back().get();
+    this->_end    = this->_cursor + BLOCK_SIZE;
+    return this->allocate(size, alignment);
+}
+
+void AstArena::clear() {
+    this->_blocks.clear();
+    this->_cursor    = nullptr;
+    this->_end       = nullptr;
+    this->_bytesUsed = 0;
+}
@@ -0,0 +1,156 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class AstArena
+ * @brief Bump-pointer allocator owning the nodes of a parse session
+ *
+ * Nodes, and the strings and arrays they refer to, are carved out of large
+ * blocks that are only released together when the arena is cleared or
+ * destroyed. Objects are never destroyed individually, so only trivially
+ * destructible types can be created in it. Blocks never move, which keeps
+ * every pointer valid until then, including after a move of the arena.
+ */
+class AstArena {
+private:
+    /**
+     * @brief Size of a storage block, allocations larger than half of it get a block of their own
+     */
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    std::vector<std::unique_ptr<std::byte[]>> _blocks;
+    std::byte*                                _cursor    = nullptr;
+    std::byte*                                _end       = nullptr;
+    size_t                                    _bytesUsed = 0;
+
+    /**
+     * @brief Allocates from a new block once the current one is full
+     * @param size The number of bytes to allocate
+     * @param alignment The required alignment, a power of two
+     * @return void* The allocated memory
+     */
+    void* allocateSlow(size_t size, size_t alignment);
+
+public:
+    AstArena()                           = default;
+    AstArena(AstArena&&)                 = default;
+    AstArena& operator=(AstArena&&)      = default;
+    AstArena(const AstArena&)            = delete;
+    AstArena& operator=(const AstArena&) = delete;
+
+    /**
+     * @brief Allocates uninitialized memory
+     * @param size The number of bytes to allocate
+     * @param alignment The required alignment, a power of two no larger than alignof(std::max_align_t)
+     * @return void* The allocated memory, valid until the arena is cleared or destroyed
+     */
+    void* allocate(size_t size, size_t alignment) {
+        uintptr_t cursor  = reinterpret_cast<uintptr_t>(this->_cursor);
+        uintptr_t aligned = (cursor + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+        if (this->_cursor && aligned + size <= reinterpret_cast<uintptr_t>(this->_end)) {
+            this->_cursor = reinterpret_cast<std::byte*>(aligned + size);
+            this->_bytesUsed += size;
+            return reinterpret_cast<void*>(aligned);
+        }
+        return this->allocateSlow(size, alignment);
+    }
+
+    /**
+     * @brief Constructs an object in the arena
+     * @tparam T The type of the object, which must be trivially destructible
+     * @param args The constructor arguments
+     * @return T* The object, owned by the arena
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed individually");
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Arena blocks are only max_align_t aligned");
+        return new (this->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Copies an array into the arena
+     * @tparam T The element type, which must be trivially copyable
+     * @param items The elements to copy
+     * @return std::span<T> The copy, owned by the arena
+     */
+    template <typename T>
+    std::span<T> copyArray(std::span<const T> items) {
+        static_assert(std::is_trivially_copyable_v<T>, "Arena arrays are copied bytewise");
+        if (items.empty()) {
+            return std::span<T>();
+        }
+
+        T* copy = static_cast<T*>(this->allocate(items.size_bytes(), alignof(T)));
+        std::memcpy(copy, items.data(), items.size_bytes());
+        return std::span<T>(copy, items.size());
+    }
+
+    /**
+     * @brief Copies a string into the arena
+     * @param text The string to copy
+     * @return std::string_view The copy, owned by the arena
+     */
+    std::string_view copyString(std::string_view text) {
+        if (text.empty()) {
+            return std::string_view();
+        }
+
+        char* copy = static_cast<char*>(this->allocate(text.size(), 1));
+        std::memcpy(copy, text.data(), text.size());
+        return std::string_view(copy, text.size());
+    }
+
+    /**
+     * @brief Gets the number of bytes handed out, excluding alignment padding
+     * @return size_t The number of allocated bytes
+     */
+    size_t bytesUsed() const { return this->_bytesUsed; }
+
+    /**
+     * @brief Gets the number of blocks the arena holds
+     * @return size_t The number of blocks
+     */
+    size_t blockCount() const { return this->_blocks.size(); }
+
+    /**
+     * @brief Releases every block at once, invalidating every object created in the arena
+     */
+    void clear();
+};
+
+}  // namespace opal
@@ -0,0 +1,451 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/IncrementalParser.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/node/nodes/BinaryNode.hpp"
+#include "opal/parser/node/nodes/CallNode.hpp"
+#include "opal/parser/node/nodes/FunctionNode.hpp"
+#include "opal/parser/node/nodes/OperandNode.hpp"
+#include "opal/parser/node/nodes/OperationNode.hpp"
+#include "opal/parser/node/nodes/UnaryNode.hpp"
+#include "opal/parser/node/nodes/VariableNode.hpp"
+#include "opal/util/ErrorUtil.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+// Literals of the same kind are equal when their bits are, which tells 0.0 from -0.0
+uint64_t bitsOf(const NumericLiteral& literal) {
+    if (literal.kind == NumericKind::FLOAT) {
+        return std::bit_cast<uint64_t>(literal.floating);
+    }
+    return static_cast<uint64_t>(literal.integer);
+}
+
+// Maps a position in the text of an edit to the source, the text starting at base
+SourcePosition toSource(SourcePosition base, int line, int column) {
+    if (line == 1) {
+        return SourcePosition{base.line, base.column + column - 1};
+    }
+    return SourcePosition{base.line + line - 1, column};
+}
+
+// Moves the location ending an error raised in the text of an edit to the source, leaving other messages alone
+std::string toSource(const std::string& message, SourcePosition base, SourcePosition local) {
+    std::string suffix = ErrorUtil::errorMessage("", local.line, local.column);
+    if (message.size() < suffix.size()
+        || message.compare(message.size() - suffix.size(), suffix.size(), suffix) != 0) {
+        return message;
+    }
+
+    SourcePosition position = toSource(base, local.line, local.column);
+    return ErrorUtil::errorMessage(message.substr(0, message.size() - suffix.size()), position.line, position.column);
+}
+
+void shiftLines(std::span<Token> tokens, int delta) {
+    for (Token& token : tokens) {
+        token.line += delta;
+    }
+}
+
+// Checks if a span of tokens views the tokens of a segment, which are shifted along with the segment
+bool isWithin(std::span<const Token> tokens, std::span<const Token> segment) {
+    std::less<const Token*> before;
+    return !tokens.empty() && !before(tokens.data(), segment.data())
+           && before(tokens.data(), segment.data() + segment.size());
+}
+
+// Nodes keep copies of their tokens, so reused nodes are moved to new lines along with the tokens of their segment
+void shiftLines(NodeBase* root, std::span<const Token> segment, int delta, std::vector<NodeBase*>& pending) {
+    pending.assign(1, root);
+
+    while (!pending.empty()) {
+        NodeBase* node = pending.back();
+        pending.pop_back();
+        if (node == nullptr) {
+            continue;
+        }
+
+        switch (node->getNodeType()) {
+            case NodeType::VARIABLE:
+                pending.push_back(static_cast<VariableNode*>(node)->getOperation());
+                break;
+            case NodeType::OPERATION:
+                shiftLines(static_cast<OperationNode*>(node)->getTokens(), delta);
+                pending.push_back(static_cast<OperationNode*>(node)->getExpression());
+                break;
+            case NodeType::FUNCTION: {
+                // Top-level bodies view the tokens of the segment, nested ones those of the parser of their parent
+                auto* function = static_cast<FunctionNode*>(node);
+                if (!isWithin(function->getBody(), segment)) {
+                    shiftLines(function->getBody(), delta);
+                }
+                pending.insert(pending.end(), function->getStatements().begin(), function->getStatements().end());
+                break;
+            }
+            case NodeType::OPERAND:
+                static_cast<OperandNode*>(node)->getToken().line += delta;
+                break;
+            case NodeType::UNARY:
+                pending.push_back(static_cast<UnaryNode*>(node)->getOperand());
+                break;
+            case NodeType::BINARY:
+                pending.push_back(static_cast<BinaryNode*>(node)->getLeft());
+                pending.push_back(static_cast<BinaryNode*>(node)->getRight());
+                break;
+            case NodeType::CALL: {
+                std::span<NodeBase* const> arguments = static_cast<CallNode*>(node)->getArguments();
+                pending.push_back(static_cast<CallNode*>(node)->getCallee());
+                pending.insert(pending.end(), arguments.begin(), arguments.end());
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+}  // namespace
+
+IncrementalParser::IncrementalParser(std::string source) {
+    auto owner  = std::make_shared<Generation>();
+    owner->text = std::move(source);
+
+    Lexer               lexer{std::string_view(owner->text)};
+    Lexer::ScannedRange range = lexer.scanRange(0, owner->text.size());
+    if (!range.error.empty()) {
+        throw std::runtime_error(range.error);
+    }
+
+    this->_literals = std::move(range.literals);
+    this->_symbols  = std::move(range.symbols);
+    for (uint32_t id = 0; id < this->_literals.size(); id++) {
+        const NumericLiteral& literal = this->_literals.get(id);
+        this->_literalIds[static_cast<size_t>(literal.kind)].try_emplace(bitsOf(literal), id);
+    }
+    this->_size     = owner->text.size();
+    this->_end      = lexer.getLineIndex().resolve(owner->text.size());
+
+    size_t count  = range.tokens.size();
+    owner->tokens = std::move(range.tokens);
+    owner->tokens.emplace_back(TokenType::EOF_TOKEN, "EOF", this->_end.line, this->_end.column);
+    owner->parser = std::make_unique<Parser>(owner->tokens, 0, count, &this->_literals, &this->_symbols);
+
+    this->_segments = splitSegments(owner, 0, range.starts, owner->text.size(), SourcePosition{1, 1});
+    for (const Segment& segment : this->_segments) {
+        this->_offsets.push_back(static_cast<size_t>(segment.text.data() - owner->text.data()));
+    }
+}
+
+uint32_t IncrementalParser::internLiteral(const NumericLiteral& literal) {
+    auto [found, inserted] = this->_literalIds[static_cast<size_t>(literal.kind)].try_emplace(bitsOf(literal), 0);
+    if (inserted) {
+        found->second = this->_literals.add(literal);
+    }
+    return found->second;
+}
+
+size_t IncrementalParser::segmentAt(size_t offset) const {
+    auto found = std::upper_bound(this->_offsets.begin(), this->_offsets.end(), offset);
+    return static_cast<size_t>(found - this->_offsets.begin()) - 1;
+}
+
+std::vector<IncrementalParser::Segment> IncrementalParser::splitSegments(const std::shared_ptr<Generation>& owner,
+                                                                         size_t                             first,
+                                                                         const std::vector<size_t>&         starts,
+                                                                         size_t                             textEnd,
+                                                                         SourcePosition                     start) {
+    const std::vector<NodeBase*>& nodes      = owner->parser->getNodes();
+    const std::vector<size_t>&    nodeStarts = owner->parser->getStarts();
+    std::string_view              text       = owner->text;
+    Token*                        tokens     = owner->tokens.data() + first;
+    size_t                        count      = starts.size();
+
+    std::vector<Segment> segments;
+    if (nodes.empty()) {
+        segments.push_back(Segment{text.substr(0, textEnd), start, std::span<Token>(tokens, count), nullptr, owner});
+        return segments;
+    }
+
+    // Tokens skipped before the first statement stay with it, so the segments cover the whole text
+    segments.reserve(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        size_t firstToken = i == 0 ? 0 : nodeStarts[i] - first;
+        size_t endToken   = i + 1 < nodes.size() ? nodeStarts[i + 1] - first : count;
+        size_t textBegin  = i == 0 ? 0 : starts[firstToken];
+        size_t textStop   = i + 1 < nodes.size() ? starts[endToken] : textEnd;
+
+        SourcePosition position = i == 0 ? start : SourcePosition{tokens[firstToken].line, tokens[firstToken].column};
+        segments.push_back(Segment{text.substr(textBegin, textStop - textBegin),
+                                   position,
+                                   std::span<Token>(tokens + firstToken, endToken - firstToken),
+                                   nodes[i],
+                                   owner});
+    }
+    return segments;
+}
+
+IncrementalParser::EditStats IncrementalParser::edit(size_t offset, size_t length, std::string_view replacement) {
+    if (offset > this->_size || length > this->_size - offset) {
+        throw std::runtime_error("Edit range lies outside the source");
+    }
+
+    size_t count     = this->_segments.size();
+    size_t firstEdit = this->segmentAt(offset);
+    size_t lastEdit  = this->segmentAt(offset + length);
+
+    // A statement may look one token ahead into the next one, which may be the edited one
+    size_t         restart     = firstEdit >= 2 ? firstEdit - 2 : 0;
+    size_t         windowStart = this->_offsets[restart];
+    SourcePosition base        = this->_segments[restart].start;
+    ptrdiff_t      sizeDelta   = static_cast<ptrdiff_t>(replacement.size()) - static_cast<ptrdiff_t>(length);
+
+    // Old statements on the line the edit ends on would keep stale columns, so resynchronizing waits for the next line
+    const Segment&   last       = this->_segments[lastEdit];
+    std::string_view editPrefix = last.text.substr(0, offset + length - this->_offsets[lastEdit]);
+    int editEndLine = last.start.line + static_cast<int>(std::count(editPrefix.begin(), editPrefix.end(), '\n'));
+
+    // The token before the first re-parsed statement, which the parser looks back at for const
+    const Token* lookbehind = nullptr;
+    for (size_t k = restart; k > 0 && lookbehind == nullptr; k--) {
+        if (!this->_segments[k - 1].tokens.empty()) {
+            lookbehind = &this->_segments[k - 1].tokens.back();
+        }
+    }
+
+    size_t minResync = lastEdit + 1;
+    size_t extra     = 2;
+    size_t lookahead = LOOKAHEAD_TOKENS;
+    while (true) {
+        size_t windowEnd = std::min(minResync + extra, count);
+        bool   atEnd     = windowEnd == count;
+
+        auto owner = std::make_shared<Generation>();
+        for (size_t k = restart; k < windowEnd; k++) {
+            owner->text += this->_segments[k].text;
+        }
+        owner->text.replace(offset - windowStart, length, replacement);
+
+        std::vector<size_t> stops;
+        std::vector<size_t> stopSegments;
+        for (size_t k = minResync; k < windowEnd; k++) {
+            if (this->_segments[k].start.line > editEndLine) {
+                ptrdiff_t stop = static_cast<ptrdiff_t>(this->_offsets[k] - windowStart) + sizeDelta;
+                stops.push_back(static_cast<size_t>(stop));
+                stopSegments.push_back(k);
+            }
+        }
+
+        Lexer               lexer{std::string_view(owner->text)};
+        Lexer::ScannedRange range = lexer.scanRange(0, owner->text.size(), stops);
+        if (!range.error.empty() && !atEnd) {
+            // The error may come from cutting the text short, such as a string closed further down
+            extra *= 2;
+            continue;
+        }
+        if (!range.error.empty()) {
+            SourcePosition local = lexer.getLineIndex().resolve(range.errorOffset);
+            throw std::runtime_error(toSource(range.error, base, local));
+        }
+
+        auto   stop   = std::find(stops.begin(), stops.end(), range.end);
+        size_t resync = count;
+        if (stop != stops.end()) {
+            resync = stopSegments[static_cast<size_t>(stop - stops.begin())];
+        } else if (!atEnd) {
+            extra *= 2;
+            continue;
+        }
+
+        size_t         textEnd      = resync < count ? range.end : owner->text.size();
+        SourcePosition windowEndPos = lexer.getLineIndex().resolve(textEnd);
+        SourcePosition resyncPos    = toSource(base, windowEndPos.line, windowEndPos.column);
+        int            lineDelta    = resync < count ? resyncPos.line - this->_segments[resync].start.line : 0;
+        SourcePosition end          = resyncPos;
+        if (resync < count) {
+            end = SourcePosition{this->_end.line + lineDelta, this->_end.column};
+        }
+
+        // Lay out the tokens to parse: the lookbehind, the new tokens, then a few reused ones for the lookahead
+        size_t first    = lookbehind != nullptr ? 1 : 0;
+        size_t relexed  = range.tokens.size();
+        size_t parseEnd = first + relexed;
+        owner->tokens.reserve(parseEnd + lookahead + 1);
+        if (lookbehind != nullptr) {
+            owner->tokens.push_back(*lookbehind);
+        }
+
+        std::vector<uint32_t> symbolIds(range.symbols.size(), Token::NO_PAYLOAD);
+        for (Token& token : range.tokens) {
+            SourcePosition position = toSource(base, token.line, token.column);
+            token.line              = position.line;
+            token.column            = position.column;
+            if (token.hasPayload()) {
+                if (token.type == TokenType::IDENTIFIER) {
+                    uint32_t& id = symbolIds[token.payload];
+                    if (id == Token::NO_PAYLOAD) {
+                        id = this->_symbols.intern(range.symbols.name(token.payload));
+                    }
+                    token.payload = id;
+                } else {
+                    token.payload = this->internLiteral(range.literals.get(token.payload));
+                }
+            }
+            owner->tokens.push_back(token);
+        }
+
+        size_t next = resync;
+        while (next < count && owner->tokens.size() < parseEnd + lookahead) {
+            for (Token token : this->_segments[next].tokens) {
+                token.line += lineDelta;
+                owner->tokens.push_back(token);
+            }
+            next++;
+        }
+        if (next == count) {
+            owner->tokens.emplace_back(TokenType::EOF_TOKEN, "EOF", end.line, end.column);
+        }
+
+        std::unique_ptr<Parser> parser;
+        try {
+            parser = std::make_unique<Parser>(owner->tokens, first, parseEnd, &this->_literals, &this->_symbols);
+        } catch (const std::runtime_error&) {
+            if (next == count) {
+                throw;
+            }
+            // The last statement may run past the reused tokens in view, such as a body closed further down
+            lookahead *= 2;
+            continue;
+        }
+
+        size_t position = parser->getPosition();
+        if (position > parseEnd && resync < count) {
+            // The last statement runs on into the reused ones, so they have to be parsed again too
+            size_t consumed = position - parseEnd;
+            size_t absorbed = resync;
+            while (absorbed < count && consumed >= this->_segments[absorbed].tokens.size()) {
+                consumed -= this->_segments[absorbed].tokens.size();
+                absorbed++;
+            }
+            minResync = std::min(absorbed + 1, count);
+            extra     = 2;
+            continue;
+        }
+
+        // The first reused statement looks back at the token before it, which must not have changed
+        if (resync < count) {
+            const Token* before = nullptr;
+            for (size_t k = resync; k > 0 && before == nullptr; k--) {
+                if (!this->_segments[k - 1].tokens.empty()) {
+                    before = &this->_segments[k - 1].tokens.back();
+                }
+            }
+            const Token* after = parseEnd > 0 ? &owner->tokens[parseEnd - 1] : nullptr;
+            if ((before == nullptr) != (after == nullptr) || (before != nullptr && before->type != after->type)) {
+                minResync = resync + 1;
+                extra     = 2;
+                continue;
+            }
+        }
+
+        owner->parser = std::move(parser);
+        std::vector<Segment> fresh = splitSegments(owner, first, range.starts, textEnd, base);
+        EditStats            stats = {range.end, relexed, owner->parser->getNodes().size()};
+
+        std::vector<size_t> offsets;
+        offsets.reserve(fresh.size());
+        for (const Segment& segment : fresh) {
+            offsets.push_back(windowStart + static_cast<size_t>(segment.text.data() - owner->text.data()));
+        }
+
+        size_t replaced = resync - restart;
+        auto   segmentAt = this->_segments.begin() + static_cast<ptrdiff_t>(restart);
+        auto   offsetAt  = this->_offsets.begin() + static_cast<ptrdiff_t>(restart);
+        if (fresh.size() != replaced) {
+            // Only resize when the statement count changes, as moving the later segments is linear in the source
+            this->_segments.erase(segmentAt, segmentAt + static_cast<ptrdiff_t>(replaced));
+            this->_offsets.erase(offsetAt, offsetAt + static_cast<ptrdiff_t>(replaced));
+            this->_segments.insert(this->_segments.begin() + static_cast<ptrdiff_t>(restart), fresh.size(), Segment{});
+            this->_offsets.insert(this->_offsets.begin() + static_cast<ptrdiff_t>(restart), fresh.size(), 0);
+        }
+        std::move(fresh.begin(), fresh.end(), this->_segments.begin() + static_cast<ptrdiff_t>(restart));
+        std::copy(offsets.begin(), offsets.end(), this->_offsets.begin() + static_cast<ptrdiff_t>(restart));
+
+        for (size_t k = restart + fresh.size(); k < this->_offsets.size(); k++) {
+            this->_offsets[k] = static_cast<size_t>(static_cast<ptrdiff_t>(this->_offsets[k]) + sizeDelta);
+        }
+        if (lineDelta != 0) {
+            std::vector<NodeBase*> pending;
+            for (size_t k = restart + fresh.size(); k < this->_segments.size(); k++) {
+                Segment& segment = this->_segments[k];
+                segment.start.line += lineDelta;
+                shiftLines(segment.tokens, lineDelta);
+                shiftLines(segment.node, segment.tokens, lineDelta, pending);
+            }
+        }
+
+        this->_size = static_cast<size_t>(static_cast<ptrdiff_t>(this->_size) + sizeDelta);
+        this->_end  = end;
+        return stats;
+    }
+}
+
+std::vector<NodeBase*> IncrementalParser::getNodes() const {
+    std::vector<NodeBase*> nodes;
+    nodes.reserve(this->_segments.size());
+    for (const Segment& segment : this->_segments) {
+        if (segment.node != nullptr) {
+            nodes.push_back(segment.node);
+        }
+    }
+    return nodes;
+}
+
+std::span<NodeBase* const> IncrementalParser::parseFunctionBody(FunctionNode& function) {
+    // The closing brace of the body lies in the segment holding the function, nested or not
+    const Token& close       = function.getBody().back();
+    auto         startsAfter = [](const Token& token, const Segment& segment) {
+        return token.line < segment.start.line
+               || (token.line == segment.start.line && token.column < segment.start.column);
+    };
+    auto after = std::upper_bound(this->_segments.begin(), this->_segments.end(), close, startsAfter);
+    return std::prev(after)->owner->parser->parseFunctionBody(function);
+}
+
+std::string IncrementalParser::getSource() const {
+    std::string source;
+    source.reserve(this->_size);
+    for (const Segment& segment : this->_segments) {
+        source += segment.text;
+    }
+    return source;
+}
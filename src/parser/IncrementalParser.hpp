@@ -0,0 +1,228 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/LineIndex.hpp"
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class IncrementalParser
+ * @brief Keeps the tokens and AST of a source up to date across text edits
+ *
+ * The source is held as a list of segments, one per top-level statement,
+ * each running from the start of its statement to the start of the next one
+ * and holding its tokens and node. An edit re-lexes the text from two
+ * statements before it until the new tokens reach the start of an old
+ * statement on a later line, then re-parses only the statements in between.
+ * Every other segment, its tokens and its node are reused as they are, so
+ * an edit lexes and parses only the statements around it, whatever the size
+ * of the source; the byte offsets of later segments are shifted, one integer
+ * each. Edits that add or remove line breaks also shift the line numbers held
+ * by later tokens and nodes, which is linear in the rest of the source but
+ * involves no lexing or parsing.
+ *
+ * Segments refer to the text and arena of the edit that produced them, which
+ * are released once no segment refers to them anymore. Symbol ids stay stable
+ * across edits, with names first seen in an edit interned after the others.
+ * Re-lexed names and literals reuse the entries of equal ones, so the tables
+ * only grow with values never seen before.
+ */
+class IncrementalParser {
+public:
+    /**
+     * @struct EditStats
+     * @brief Work done by an edit
+     */
+    struct EditStats {
+        size_t relexedBytes;   ///< Bytes of new text scanned by the lexer
+        size_t relexedTokens;  ///< Tokens produced by the lexer
+        size_t reparsedNodes;  ///< Top-level nodes produced by the parser
+    };
+
+private:
+    /**
+     * @brief Number of tokens past the re-parsed statements first kept in view of the parser's lookahead
+     *
+     * Doubled whenever the parse fails before seeing EOF, as the last statement
+     * may only have run past the tokens in view.
+     */
+    static constexpr size_t LOOKAHEAD_TOKENS = 4;
+
+    /**
+     * @struct Generation
+     * @brief Text, tokens and nodes produced by the initial parse or by one edit
+     */
+    struct Generation {
+        std::string             text;
+        std::vector<Token>      tokens;
+        std::unique_ptr<Parser> parser;
+    };
+
+    /**
+     * @struct Segment
+     * @brief One top-level statement with the whitespace, comments and skipped tokens following it
+     */
+    struct Segment {
+        std::string_view            text;    ///< Text from the start of the statement to the start of the next one
+        SourcePosition              start;   ///< Position of the first byte of the text
+        std::span<Token>            tokens;  ///< Tokens starting in the text
+        NodeBase*                   node;    ///< The statement, or nullptr for a segment without any
+        std::shared_ptr<Generation> owner;   ///< Owner of the text, tokens and node
+    };
+
+    std::vector<Segment> _segments;
+    std::vector<size_t>  _offsets;  ///< Byte offset of each segment, kept apart so shifting it stays cheap
+    size_t               _size = 0;
+    SourcePosition       _end  = {1, 1};
+    LiteralTable         _literals;
+    SymbolTable          _symbols;
+
+    /**
+     * @brief Index in the literal table of every literal value, by bit pattern, for each NumericKind
+     */
+    std::array<std::unordered_map<uint64_t, uint32_t>, 2> _literalIds;
+
+    /**
+     * @brief Gets the segment containing a byte offset
+     * @param offset The byte offset, at most the size of the source
+     * @return size_t The index of the last segment starting at or before the offset
+     */
+    size_t segmentAt(size_t offset) const;
+
+    /**
+     * @brief Adds a literal to the literal table, unless an equal one is already in it
+     *
+     * Every edit re-lexes the literals of the statements around it, so reusing
+     * entries keeps the table from growing with edits that leave them as they were.
+     *
+     * @param literal The decoded literal
+     * @return uint32_t The index of the literal in the table
+     */
+    uint32_t internLiteral(const NumericLiteral& literal);
+
+    /**
+     * @brief Splits the tokens parsed by a generation into segments
+     * @param owner The generation holding the text, the tokens and the parser
+     * @param first The index of the first parsed token in the tokens of the generation
+     * @param starts The offset in the text of every parsed token
+     * @param textEnd The offset in the text the last segment ends at
+     * @param start The position of the first byte of the text
+     * @return std::vector<Segment> The segments in order, covering the text up to textEnd
+     */
+    static std::vector<Segment> splitSegments(const std::shared_ptr<Generation>& owner,
+                                              size_t                             first,
+                                              const std::vector<size_t>&         starts,
+                                              size_t                             textEnd,
+                                              SourcePosition                     start);
+
+public:
+    /**
+     * @brief Constructs a new IncrementalParser object, lexing and parsing the whole source
+     * @param source The source code
+     * @throws std::runtime_error On the first lexing or parsing error
+     */
+    explicit IncrementalParser(std::string source);
+
+    IncrementalParser(const IncrementalParser&)            = delete;
+    IncrementalParser& operator=(const IncrementalParser&) = delete;
+
+    /**
+     * @brief Replaces a range of the source and updates the tokens and nodes around it
+     *
+     * The source, tokens and nodes stay as they were when the edit throws, so
+     * the edit can be corrected and applied again.
+     *
+     * @param offset The byte offset the replaced range starts at
+     * @param length The number of bytes replaced
+     * @param replacement The new text of the range
+     * @return EditStats The work the edit took
+     * @throws std::runtime_error If the range lies outside the source, or on a lexing or parsing error in the
+     * new source
+     */
+    EditStats edit(size_t offset, size_t length, std::string_view replacement);
+
+    /**
+     * @brief Gets the parsed top-level nodes
+     * @return std::vector<NodeBase*> The nodes in source order, valid until the next edit replaces them
+     */
+    std::vector<NodeBase*> getNodes() const;
+
+    /**
+     * @brief Parses the body of a pre-parsed function, unless it already was
+     *
+     * The body is parsed by the parser of the statement holding the function,
+     * so its statements live as long as the function does and move to new
+     * lines along with it.
+     *
+     * @param function A function of getNodes, or one nested in a parsed body
+     * @return std::span<NodeBase* const> The statements of the body in order
+     * @throws std::runtime_error On a parsing error in the body, leaving the function unparsed
+     */
+    std::span<NodeBase* const> parseFunctionBody(FunctionNode& function);
+
+    /**
+     * @brief Gets the current source
+     * @return std::string A copy of the source with every edit applied
+     */
+    std::string getSource() const;
+
+    /**
+     * @brief Gets the size of the current source
+     * @return size_t The number of bytes
+     */
+    size_t size() const { return this->_size; }
+
+    /**
+     * @brief Gets the number of top-level segments the source is held in
+     * @return size_t The segment count
+     */
+    size_t getSegmentCount() const { return this->_segments.size(); }
+
+    /**
+     * @brief Gets the literals the payloads of NUMBER tokens index into
+     * @return const LiteralTable& The literal table, which grows with every edit
+     */
+    const LiteralTable& getLiterals() const { return this->_literals; }
+
+    /**
+     * @brief Gets the symbols the payloads of IDENTIFIER tokens and the ids of nodes index into
+     * @return SymbolTable& The symbol table
+     */
+    SymbolTable& getSymbols() { return this->_symbols; }
+};
+
+}  // namespace opal
@@ -0,0 +1,246 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/ModuleLoader.hpp"
+
+#include "opal/parser/node/nodes/LoadNode.hpp"
+#include "opal/util/FileUtil.hpp"
+#include "opal/util/HashUtil.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+
+using namespace opal;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double milliseconds(std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+/**
+ * @struct ModuleLoader::LoadState
+ * @brief State of one load, shared by the tasks processing its modules
+ */
+struct ModuleLoader::LoadState {
+    std::mutex                                                     mutex;
+    std::condition_variable                                        finished;
+    size_t                                                         pending = 0;
+    std::unordered_map<std::string, std::shared_ptr<const Module>> modules;  ///< nullptr until processed
+    std::unordered_map<std::string, CacheEntry>                    cache;
+    std::map<std::string, std::string>                             errors;   ///< Sorted by path
+    std::vector<ModuleReport>                                      report;
+};
+
+ModuleLoader::ModuleLoader(size_t threadCount) : _pool(threadCount) {}
+
+std::shared_ptr<const ModuleLoader::Module> ModuleLoader::load(const std::string& path) {
+    std::error_code error;
+    std::string     entry = std::filesystem::canonical(path, error).string();
+    if (error) {
+        throw std::runtime_error("Cannot load " + path + ": " + error.message());
+    }
+
+    LoadState state;
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        this->schedule(entry, state);
+        state.finished.wait(lock, [&state]() { return state.pending == 0; });
+    }
+
+    // Keep what did parse, so that fixing the failing module does not parse the others again
+    for (auto& [modulePath, cached] : state.cache) {
+        this->_cache[modulePath] = std::move(cached);
+    }
+    if (!state.errors.empty()) {
+        throw std::runtime_error(state.errors.begin()->second);
+    }
+
+    this->orderModules(entry, state.modules);
+    std::sort(state.report.begin(), state.report.end(), [](const ModuleReport& a, const ModuleReport& b) {
+        return a.lexTime + a.parseTime > b.lexTime + b.parseTime;
+    });
+    this->_report = std::move(state.report);
+    return state.modules.at(entry);
+}
+
+void ModuleLoader::schedule(const std::string& path, LoadState& state) {
+    if (!state.modules.emplace(path, nullptr).second) {
+        return;
+    }
+
+    state.pending++;
+    this->_pool.submit([this, path, &state]() { this->process(path, state); });
+}
+
+void ModuleLoader::process(const std::string& path, LoadState& state) {
+    ModuleReport                  report = {path, 0, 0, {}, {}, true};
+    CacheEntry                    entry  = {nullptr, {}, 0};
+    std::shared_ptr<const Module> module;
+
+    try {
+        entry.modified = std::filesystem::last_write_time(path);
+        entry.size     = std::filesystem::file_size(path);
+
+        // The cache is only written once every task of the load has finished
+        auto cached = this->_cache.find(path);
+        if (cached != this->_cache.end() && cached->second.modified == entry.modified
+            && cached->second.size == entry.size) {
+            module = cached->second.module;
+        } else {
+            auto fresh    = std::make_shared<Module>();
+            fresh->path   = path;
+            fresh->source = FileUtil::mapFile(path);
+            fresh->hash   = HashUtil::hash64(fresh->source.view());
+
+            if (cached != this->_cache.end() && cached->second.module->hash == fresh->hash
+                && cached->second.module->source.size() == fresh->source.size()) {
+                module = cached->second.module;
+            } else {
+                Clock::time_point start = Clock::now();
+                fresh->lexer            = std::make_unique<Lexer>(fresh->source.view());
+                fresh->lexer->scanTokens();
+
+                Clock::time_point lexed = Clock::now();
+                fresh->parser           = std::make_unique<Parser>(
+                    fresh->lexer->releaseTokens(), &fresh->lexer->getLiterals(), &fresh->lexer->getSymbols());
+
+                report.lexTime      = lexed - start;
+                report.parseTime    = Clock::now() - lexed;
+                report.cached       = false;
+                fresh->dependencies = resolveDependencies(*fresh);
+                module              = std::move(fresh);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.errors.emplace(path, path + ": " + e.what());
+        if (--state.pending == 0) {
+            state.finished.notify_all();
+        }
+        return;
+    }
+
+    report.bytes = module->source.size();
+    report.nodes = module->getNodes().size();
+    entry.module = module;
+
+    // Notifying under the lock keeps the state alive until this task is done with it
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.modules[path] = module;
+    state.cache[path]   = std::move(entry);
+    state.report.push_back(std::move(report));
+    for (const std::string& dependency : module->dependencies) {
+        this->schedule(dependency, state);
+    }
+    if (--state.pending == 0) {
+        state.finished.notify_all();
+    }
+}
+
+std::vector<std::string> ModuleLoader::resolveDependencies(const Module& module) {
+    std::filesystem::path    directory = std::filesystem::path(module.path).parent_path();
+    std::vector<std::string> dependencies;
+
+    for (const NodeBase* node : module.getNodes()) {
+        if (node->getNodeType() != NodeType::BASE || node->getTokenType() != TokenType::LOAD) {
+            continue;
+        }
+
+        std::string_view target = static_cast<const LoadNode*>(node)->getPath();
+        std::error_code  error;
+        std::string      resolved = std::filesystem::canonical(directory / target, error).string();
+        if (error) {
+            throw std::runtime_error("Cannot load \"" + std::string(target) + "\": " + error.message());
+        }
+        if (std::find(dependencies.begin(), dependencies.end(), resolved) == dependencies.end()) {
+            dependencies.push_back(std::move(resolved));
+        }
+    }
+    return dependencies;
+}
+
+void ModuleLoader::orderModules(const std::string&                                                   entry,
+                                const std::unordered_map<std::string, std::shared_ptr<const Module>>& modules) {
+    // A module on the depth-first path, with the next dependency to visit
+    struct Frame {
+        const Module* module;
+        size_t        next;
+    };
+
+    // Modules on the current path are marked false, finished ones true
+    std::unordered_map<std::string, bool>      finished;
+    std::vector<Frame>                         path;
+    std::vector<std::shared_ptr<const Module>> order;
+
+    finished.emplace(entry, false);
+    path.push_back(Frame{modules.at(entry).get(), 0});
+    while (!path.empty()) {
+        Frame& frame = path.back();
+        if (frame.next == frame.module->dependencies.size()) {
+            finished[frame.module->path] = true;
+            order.push_back(modules.at(frame.module->path));
+            path.pop_back();
+            continue;
+        }
+
+        const std::string& dependency = frame.module->dependencies[frame.next++];
+        auto               mark       = finished.find(dependency);
+        if (mark == finished.end()) {
+            finished.emplace(dependency, false);
+            path.push_back(Frame{modules.at(dependency).get(), 0});
+        } else if (!mark->second) {
+            std::string cycle;
+            auto        start = std::find_if(
+                path.begin(), path.end(), [&dependency](const Frame& f) { return f.module->path == dependency; });
+            for (auto it = start; it != path.end(); it++) {
+                cycle += it->module->path + " -> ";
+            }
+            throw std::runtime_error("Load cycle: " + cycle + dependency);
+        }
+    }
+
+    this->_order = std::move(order);
+}
+
+void ModuleLoader::printReport() const {
+    std::chrono::nanoseconds total{0};
+    for (const ModuleReport& report : this->_report) {
+        total += report.lexTime + report.parseTime;
+        spdlog::info("{:>10.3f} ms lex {:>10.3f} ms parse {:>8} nodes  {}{}",
+                     milliseconds(report.lexTime),
+                     milliseconds(report.parseTime),
+                     report.nodes,
+                     report.path,
+                     report.cached ? " (cached)" : "");
+    }
+    spdlog::info("{} modules, {:.3f} ms of lexing and parsing", this->_report.size(), milliseconds(total));
+}
@@ -0,0 +1,182 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+#include "opal/util/MappedFile.hpp"
+#include "opal/util/ThreadPool.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class ModuleLoader
+ * @brief Loads a module and every module it reaches through load statements
+ *
+ * Load paths are resolved against the directory of the loading module and
+ * canonicalized, so a module reached through several paths is lexed and
+ * parsed exactly once. Each module is mapped, lexed and parsed on a thread
+ * pool as soon as a loading module names it, so independent modules are
+ * processed concurrently. Once the whole graph is known, it is checked for
+ * cycles and ordered with every module after its dependencies.
+ *
+ * Parsed modules stay cached in memory across loads. A cached module is
+ * reused as is when the size and modification time of its file did not
+ * change, and after hashing the file when only the modification time did.
+ */
+class ModuleLoader {
+public:
+    /**
+     * @class Module
+     * @brief One parsed module, holding its mapped source and the nodes viewing it
+     */
+    class Module {
+    public:
+        std::string              path;          ///< Canonical path of the file
+        uint64_t                 hash = 0;      ///< HashUtil::hash64 of the source
+        MappedFile               source;        ///< The mapped file, which the tokens and nodes view
+        std::unique_ptr<Lexer>   lexer;         ///< Owner of the literal and symbol tables of the module
+        std::unique_ptr<Parser>  parser;        ///< Owner of the nodes of the module
+        std::vector<std::string> dependencies;  ///< Canonical paths of the loaded modules, in source order
+
+        /**
+         * @brief Gets the parsed top-level nodes
+         * @return const std::vector<NodeBase*>& The nodes in source order
+         */
+        const std::vector<NodeBase*>& getNodes() const { return this->parser->getNodes(); }
+    };
+
+    /**
+     * @struct ModuleReport
+     * @brief Front-end work spent on one module during a load
+     */
+    struct ModuleReport {
+        std::string              path;
+        size_t                   bytes;
+        size_t                   nodes;
+        std::chrono::nanoseconds lexTime;
+        std::chrono::nanoseconds parseTime;
+        bool                     cached;  ///< True when the module was reused from an earlier load
+    };
+
+private:
+    /**
+     * @struct CacheEntry
+     * @brief A parsed module with the file state it was parsed from
+     */
+    struct CacheEntry {
+        std::shared_ptr<const Module>   module;
+        std::filesystem::file_time_type modified;
+        uintmax_t                       size;
+    };
+
+    struct LoadState;
+
+    std::unordered_map<std::string, CacheEntry> _cache;
+    std::vector<std::shared_ptr<const Module>>  _order;
+    std::vector<ModuleReport>                   _report;
+    ThreadPool                                  _pool;
+
+    /**
+     * @brief Gets a module from the cache, or maps, lexes and parses it, then schedules its dependencies
+     * @param path The canonical path of the module
+     * @param state The state of the current load
+     */
+    void process(const std::string& path, LoadState& state);
+
+    /**
+     * @brief Queues a module for processing unless the current load already reached it
+     * @param path The canonical path of the module
+     * @param state The state of the current load, locked by the caller
+     */
+    void schedule(const std::string& path, LoadState& state);
+
+    /**
+     * @brief Resolves the load statements of a module
+     * @param module The parsed module
+     * @return std::vector<std::string> The canonical paths of the loaded modules, in source order
+     * @throws std::runtime_error If a loaded file does not exist
+     */
+    static std::vector<std::string> resolveDependencies(const Module& module);
+
+    /**
+     * @brief Orders the modules reached from an entry module after their dependencies
+     * @param entry The canonical path of the entry module
+     * @param modules Every module reached from it
+     * @throws std::runtime_error If the modules load each other in a cycle
+     */
+    void orderModules(const std::string&                                                   entry,
+                      const std::unordered_map<std::string, std::shared_ptr<const Module>>& modules);
+
+public:
+    /**
+     * @brief Constructs a new ModuleLoader object
+     * @param threadCount Number of threads processing modules, 0 to use one per hardware thread
+     */
+    explicit ModuleLoader(size_t threadCount = 0);
+
+    ModuleLoader(const ModuleLoader&)            = delete;
+    ModuleLoader& operator=(const ModuleLoader&) = delete;
+
+    /**
+     * @brief Loads a module and every module it reaches
+     * @param path The path of the entry module
+     * @return std::shared_ptr<const Module> The entry module, which stays valid after later loads
+     * @throws std::runtime_error If a module cannot be read, lexed or parsed, naming the first failing module by
+     * path so that errors do not depend on thread timing, or if the modules load each other in a cycle
+     */
+    std::shared_ptr<const Module> load(const std::string& path);
+
+    /**
+     * @brief Gets the modules reached by the last load
+     * @return const std::vector<std::shared_ptr<const Module>>& The modules, each after its dependencies
+     */
+    const std::vector<std::shared_ptr<const Module>>& getLoadOrder() const { return this->_order; }
+
+    /**
+     * @brief Gets the work spent on each module by the last load
+     * @return const std::vector<ModuleReport>& The reports, slowest module first
+     */
+    const std::vector<ModuleReport>& getReport() const { return this->_report; }
+
+    /**
+     * @brief Logs the report of the last load, slowest module first
+     */
+    void printReport() const;
+
+    /**
+     * @brief Gets the number of cached modules
+     * @return size_t The number of modules kept across loads
+     */
+    size_t getCacheSize() const { return this->_cache.size(); }
+};
+
+}  // namespace opal
@@ -0,0 +1,183 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/ParallelParser.hpp"
+
+#include "opal/lexer/TokenClass.hpp"
+#include "opal/parser/node/nodes/FunctionNode.hpp"
+#include "opal/parser/node/nodes/StringNode.hpp"
+#include "opal/parser/node/nodes/VariableNode.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <utility>
+
+using namespace opal;
+
+namespace {
+
+// A line starting right after an operator, or with one, most likely continues the statement of the line before
+bool continuesStatement(TokenType previous, TokenType next) {
+    return isBinaryOperator(previous) || previous == TokenType::EQUAL || previous == TokenType::LEFT_PAREN
+           || previous == TokenType::COMMA || isBinaryOperator(next) || isPostfixOperator(next);
+}
+
+void internSegments(StringNode& node, SymbolTable& symbols) {
+    std::span<const StringSegment> segments = node.getSegments();
+    for (size_t i = 0; i < segments.size(); i++) {
+        if (segments[i].type == StringSegmentType::VARIABLE) {
+            node.setSegmentSymbol(i, symbols.intern(segments[i].content));
+        }
+    }
+}
+
+// Interns the names of top-level or body statements in the order Parser would, nested bodies being parsed later
+void internSymbols(std::span<NodeBase* const> nodes, SymbolTable& symbols) {
+    for (NodeBase* node : nodes) {
+        if (node->getNodeType() == NodeType::VARIABLE) {
+            auto* variable = static_cast<VariableNode*>(node);
+            variable->setSymbol(symbols.intern(variable->getName()));
+            if (StringNode* string = variable->getStringNode()) {
+                internSegments(*string, symbols);
+            }
+        } else if (node->getNodeType() == NodeType::STRING) {
+            internSegments(*static_cast<StringNode*>(node), symbols);
+        } else if (node->getNodeType() == NodeType::FUNCTION) {
+            auto* function = static_cast<FunctionNode*>(node);
+            function->setSymbol(symbols.intern(function->getName()));
+        }
+    }
+}
+
+}  // namespace
+
+ParallelParser::ParallelParser(std::vector<Token>  tokens,
+                               const LiteralTable* literals,
+                               SymbolTable*        symbols,
+                               size_t              threadCount)
+    : _tokens(std::move(tokens)), _literals(literals), _symbols(symbols), _pool(threadCount) {
+    this->parse();
+}
+
+std::vector<size_t> ParallelParser::splitChunks() const {
+    size_t length = this->_tokens.size();
+    if (length > 0 && this->_tokens.back().type == TokenType::EOF_TOKEN) {
+        length--;
+    }
+
+    size_t chunkCount = std::min(length / MIN_CHUNK_TOKENS, this->_pool.size() * CHUNKS_PER_THREAD);
+
+    std::vector<size_t> boundaries = {0};
+    size_t              target     = chunkCount > 1 ? length / chunkCount : length;
+    size_t              depth      = 0;
+    for (size_t i = 1; i < length && boundaries.size() < chunkCount; i++) {
+        const Token& previous = this->_tokens[i - 1];
+        const Token& token    = this->_tokens[i];
+
+        if (previous.type == TokenType::LEFT_BRACE) {
+            depth++;
+        } else if (previous.type == TokenType::RIGHT_BRACE && depth > 0) {
+            depth--;
+        }
+
+        if (i >= target && depth == 0 && token.line != previous.line
+            && !continuesStatement(previous.type, token.type)) {
+            boundaries.push_back(i);
+            target = length * boundaries.size() / chunkCount;
+        }
+    }
+    boundaries.push_back(length);
+    return boundaries;
+}
+
+void ParallelParser::appendNodes(std::unique_ptr<Parser> parser) {
+    const std::vector<NodeBase*>& nodes = parser->getNodes();
+
+    if (this->_symbols) {
+        internSymbols(nodes, *this->_symbols);
+    }
+
+    this->_nodes.insert(this->_nodes.end(), nodes.begin(), nodes.end());
+    this->_parsers.push_back(std::move(parser));
+}
+
+void ParallelParser::parse() {
+    std::vector<size_t> boundaries = this->splitChunks();
+    size_t              chunkCount = boundaries.size() - 1;
+
+    std::vector<std::future<std::unique_ptr<Parser>>> speculative;
+    speculative.reserve(chunkCount);
+    for (size_t i = 0; i < chunkCount; i++) {
+        size_t begin = boundaries[i];
+        size_t end   = boundaries[i + 1];
+        speculative.push_back(this->_pool.submit([this, begin, end]() {
+            return std::make_unique<Parser>(this->_tokens, begin, end, this->_literals);
+        }));
+    }
+
+    size_t cursor = 0;
+    for (size_t i = 0; i < chunkCount; i++) {
+        std::unique_ptr<Parser> chunk;
+        std::exception_ptr      error;
+        try {
+            chunk = speculative[i].get();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        size_t begin = boundaries[i];
+        size_t end   = boundaries[i + 1];
+        if (cursor >= end) {
+            // The last statement of the previous chunk covered this whole chunk
+            continue;
+        }
+
+        if (cursor != begin) {
+            // The chunk started inside the last statement of the previous one, so parse it from the real boundary
+            chunk = std::make_unique<Parser>(this->_tokens, cursor, end, this->_literals);
+        } else if (error) {
+            std::rethrow_exception(error);
+        }
+
+        cursor = chunk->getPosition();
+        this->appendNodes(std::move(chunk));
+    }
+}
+
+std::span<NodeBase* const> ParallelParser::parseFunctionBody(FunctionNode& function) {
+    if (function.isParsed()) {
+        return function.getStatements();
+    }
+
+    // Any chunk parser will do, as they only differ by the range of tokens they read
+    std::span<NodeBase* const> statements = this->_parsers.front()->parseFunctionBody(function);
+    if (this->_symbols) {
+        internSymbols(statements, *this->_symbols);
+    }
+    return statements;
+}
+
+void ParallelParser::printAST() const {
+    for (const NodeBase* node : this->_nodes) {
+        node->print();
+    }
+}
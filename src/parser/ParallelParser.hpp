@@ -0,0 +1,134 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+#include "opal/util/ThreadPool.hpp"
+
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class ParallelParser
+ * @brief Parses the top-level statements of one large token array on several threads
+ *
+ * A linear pre-pass splits the tokens into chunks at statements that begin a
+ * line outside of any brace block, and every chunk is parsed on a thread pool
+ * into the arena of its own Parser, reading the shared token array. The
+ * chunks are then stitched in order: a chunk whose start turns out to lie
+ * inside the last statement of the previous chunk is parsed again from the
+ * real statement boundary. Symbol ids are assigned while stitching, in source
+ * order, so the nodes, errors included, are identical to those of Parser.
+ */
+class ParallelParser {
+private:
+    /**
+     * @brief Smallest chunk worth handing to another thread, in tokens
+     */
+    static constexpr size_t MIN_CHUNK_TOKENS = 4096;
+
+    /**
+     * @brief Number of chunks per thread, to even out chunks of uneven cost
+     */
+    static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    std::vector<Token>                   _tokens;
+    const LiteralTable*                  _literals;
+    SymbolTable*                         _symbols;
+    std::vector<std::unique_ptr<Parser>> _parsers;
+    std::vector<NodeBase*>               _nodes;
+    ThreadPool                           _pool;
+
+    /**
+     * @brief Computes the chunk boundaries of the token array
+     * @return std::vector<size_t> Sorted token indices starting with 0 and ending with the index of EOF, if any
+     */
+    std::vector<size_t> splitChunks() const;
+
+    /**
+     * @brief Parses every chunk and stitches the results in source order
+     * @throws std::runtime_error On the first parsing error in source order
+     */
+    void parse();
+
+    /**
+     * @brief Moves the nodes of a parsed chunk to the output
+     *
+     * Chunks are parsed without a symbol table, so the names of variables,
+     * functions and interpolations are interned on the way, in the order Parser
+     * would.
+     *
+     * @param parser The parser of the chunk
+     */
+    void appendNodes(std::unique_ptr<Parser> parser);
+
+public:
+    /**
+     * @brief Constructs a new ParallelParser object and parses the tokens
+     * @param tokens The tokens to parse
+     * @param literals The table the payloads of NUMBER tokens index into, or nullptr to decode lexemes
+     * @param symbols The table the tokens were lexed with, or nullptr to skip symbol ids
+     * @param threadCount Number of parsing threads, 0 to use one per hardware thread
+     * @throws std::runtime_error On the first parsing error in source order
+     */
+    explicit ParallelParser(std::vector<Token>  tokens,
+                            const LiteralTable* literals    = nullptr,
+                            SymbolTable*        symbols     = nullptr,
+                            size_t              threadCount = 0);
+
+    /**
+     * @brief Gets the parsed top-level nodes
+     * @return const std::vector<NodeBase*>& The nodes in source order, valid as long as the parser
+     */
+    const std::vector<NodeBase*>& getNodes() const { return this->_nodes; }
+
+    /**
+     * @brief Parses the body of a pre-parsed function, unless it already was
+     *
+     * Names in the body are interned as the body is parsed, like Parser does.
+     *
+     * @param function A function of getNodes, or one nested in a parsed body
+     * @return std::span<NodeBase* const> The statements of the body in order, valid as long as the parser
+     * @throws std::runtime_error On a parsing error in the body, leaving the function unparsed
+     */
+    std::span<NodeBase* const> parseFunctionBody(FunctionNode& function);
+
+    /**
+     * @brief Gets the number of chunks the tokens were parsed in
+     * @return size_t The number of chunk parsers holding nodes
+     */
+    size_t getChunkCount() const { return this->_parsers.size(); }
+
+    /**
+     * @brief Prints the Abstract Syntax Tree to standard output
+     */
+    void printAST() const;
+};
+
+}  // namespace opal
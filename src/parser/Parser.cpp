@@ -25,42 +25,147 @@
 #include "opal/parser/atomizer/AtomizerBase.hpp"
 #include "opal/parser/atomizer/AtomizerFactory.hpp"
 
+#include <span>
+#include <utility>
 #include <vector>
 
 using namespace opal;
 
-Token Parser::peek() const {
-    return _tokens[_current];
+const Token& Parser::peek() const {
+    return (*_input)[_current];
 }
 
-bool Parser::isAtEnd() const {
-    return _current >= _tokens.size() || _tokens[_current].type == TokenType::EOF_TOKEN;
+bool Parser::isAtEnd() {
+    if (_current >= _tokens.size() && _stream) {
+        _stream->fillWindow(_tokens, _current);
+    }
+    return _current >= _end || _current >= _input->size() || (*_input)[_current].type == TokenType::EOF_TOKEN;
 }
 
-Parser::Parser(std::vector<Token> tokens) : _tokens(tokens) {
-    _atomizers = AtomizerFactory::createAtomizers(_current, _tokens);
+Parser::Parser(std::vector<Token> tokens, const LiteralTable* literals, SymbolTable* symbols)
+    : _tokens(std::move(tokens)), _literals(literals), _symbols(symbols) {
+    this->parse();
+}
 
-    while (!this->isAtEnd()) {
-        bool handled = false;
-        for (const std::unique_ptr<AtomizerBase>& atomizer : _atomizers) {
-            if (atomizer->canHandle(this->peek().type)) {
-                std::unique_ptr<NodeBase> node = atomizer->atomize();
-                if (node) {
-                    _nodes.push_back(std::move(node));
-                }
-                handled = true;
-                break;
+Parser::Parser(std::vector<Token>& tokens,
+               size_t              begin,
+               size_t              end,
+               const LiteralTable* literals,
+               SymbolTable*        symbols)
+    : _input(&tokens), _end(end), _current(begin), _literals(literals), _symbols(symbols) {
+    this->parse();
+}
+
+Parser::Parser(TokenSource& source)
+    : _stream(&source), _literals(source.literals()), _symbols(source.symbols()) {
+    this->parse();
+}
+
+Parser::Parser(const TokenBuffer& buffer) : _literals(buffer.literals()), _symbols(buffer.symbols()) {
+    TokenBuffer::Cursor cursor(buffer);
+    _stream = &cursor;
+    this->parse();
+}
+
+const std::vector<NodeBase*>& Parser::getNodes() const {
+    return _nodes;
+}
+
+std::span<NodeBase* const> Parser::parseFunctionBody(FunctionNode& function) {
+    if (function.isParsed()) {
+        return function.getStatements();
+    }
+
+    // The closing brace becomes EOF, so the body parses like a source of its own
+    std::span<const Token> body  = function.getBody();
+    const Token&           close = body.back();
+    std::vector<Token>     tokens(body.begin(), body.end() - 1);
+    tokens.emplace_back(TokenType::EOF_TOKEN, "EOF", close.line, close.column);
+
+    auto parser = std::make_unique<Parser>(std::move(tokens), _literals, _symbols);
+    function.setStatements(_arena.copyArray(std::span<NodeBase* const>(parser->getNodes())));
+    _bodies.push_back(std::move(parser));
+    return function.getStatements();
+}
+
+size_t Parser::parseFunctionBodies() {
+    std::vector<NodeBase*> pending(_nodes.begin(), _nodes.end());
+    size_t                 parsed = 0;
+
+    while (!pending.empty()) {
+        NodeBase* node = pending.back();
+        pending.pop_back();
+        if (node->getNodeType() != NodeType::FUNCTION) {
+            continue;
+        }
+
+        auto* function = static_cast<FunctionNode*>(node);
+        if (!function->isParsed()) {
+            this->parseFunctionBody(*function);
+            parsed++;
+        }
+        pending.insert(pending.end(), function->getStatements().begin(), function->getStatements().end());
+    }
+    return parsed;
+}
+
+void Parser::compactWindow() {
+    if (!_stream || _current < WINDOW_COMPACT_THRESHOLD) {
+        return;
+    }
+
+    size_t dropped = _current - WINDOW_HISTORY;
+    _tokens.erase(_tokens.begin(), _tokens.begin() + static_cast<std::ptrdiff_t>(dropped));
+    _current -= dropped;
+}
+
+void Parser::createAtomizers() {
+    _atomizers = AtomizerFactory::createAtomizers(_current, *_input);
+
+    _dispatch.fill(nullptr);
+    for (const std::unique_ptr<AtomizerBase>& atomizer : _atomizers) {
+        atomizer->setStream(_stream);
+        atomizer->setLiterals(_literals);
+        atomizer->setSymbols(_symbols);
+        atomizer->setArena(&_arena);
+
+        for (TokenType type : atomizer->leadingTypes()) {
+            AtomizerBase*& slot = _dispatch[static_cast<size_t>(type)];
+            if (slot == nullptr) {
+                slot = atomizer.get();
             }
         }
+    }
+}
+
+void Parser::parse() {
+    this->createAtomizers();
+
+    while (!this->isAtEnd()) {
+        TokenType     type     = this->peek().type;
+        AtomizerBase* atomizer = _dispatch[static_cast<size_t>(type)];
 
-        if (!handled) {
+        if (atomizer != nullptr && atomizer->canHandle(type)) {
+            size_t start = _current;
+            if (NodeBase* node = atomizer->atomize()) {
+                _nodes.push_back(node);
+                _starts.push_back(start);
+            }
+        } else {
             _current++;
         }
+
+        this->compactWindow();
+    }
+
+    _stream = nullptr;
+    for (const std::unique_ptr<AtomizerBase>& atomizer : _atomizers) {
+        atomizer->setStream(nullptr);
     }
 }
 
 void Parser::printAST() const {
-    for (const std::unique_ptr<NodeBase>& node : _nodes) {
+    for (const NodeBase* node : _nodes) {
         node->print();
     }
 }
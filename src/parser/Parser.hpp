@@ -21,10 +21,19 @@
 
 #pragma once
 
+#include "opal/lexer/LiteralTable.hpp"
 #include "opal/lexer/Token.hpp"
+#include "opal/lexer/TokenBuffer.hpp"
+#include "opal/lexer/TokenClass.hpp"
+#include "opal/lexer/TokenSource.hpp"
+#include "opal/parser/AstArena.hpp"
 #include "opal/parser/atomizer/AtomizerBase.hpp"
+#include "opal/parser/node/nodes/FunctionNode.hpp"
 
+#include <array>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace opal {
@@ -34,33 +43,166 @@ namespace opal {
  * @brief Parses tokens into an Abstract Syntax Tree (AST)
  *
  * The parser takes a sequence of tokens from the lexer and constructs
- * a hierarchical representation of the program structure (AST).
+ * a hierarchical representation of the program structure (AST). Tokens can
+ * be handed over as a complete vector or pulled from a TokenSource, in which
+ * case only a small window of tokens is kept in memory. Nodes live in an
+ * arena owned by the parser and are released together with it. Names, values
+ * and string segments of nodes are views into the source the tokens were
+ * lexed from, so that source must outlive the parser as well. The atomizer
+ * for a statement is found through a table indexed by the type of its first
+ * token, so the cost of dispatch does not grow with the number of atomizers.
+ * Function bodies are only pre-parsed, and parsed into nodes on demand.
  */
 class Parser {
 private:
-    std::vector<Token>                         _tokens;
-    std::vector<std::unique_ptr<AtomizerBase>> _atomizers;
-    std::vector<std::unique_ptr<NodeBase>>     _nodes;
-    size_t                                     _current = 0;
+    /**
+     * @brief Number of consumed tokens after which a streaming window is compacted
+     */
+    static constexpr size_t WINDOW_COMPACT_THRESHOLD = 256;
+
+    /**
+     * @brief Number of consumed tokens kept behind the cursor for atomizer lookback
+     */
+    static constexpr size_t WINDOW_HISTORY = 3;
+
+    std::vector<Token>                          _tokens;
+    std::vector<Token>*                         _input = &_tokens;
+    size_t                                      _end   = SIZE_MAX;
+    std::vector<std::unique_ptr<AtomizerBase>>  _atomizers;
+    std::array<AtomizerBase*, TOKEN_TYPE_COUNT> _dispatch{};
+    AstArena                                    _arena;
+    std::vector<NodeBase*>                      _nodes;
+    std::vector<size_t>                         _starts;
+    std::vector<std::unique_ptr<Parser>>        _bodies;
+    size_t                                      _current = 0;
+    TokenSource*                                _stream   = nullptr;
+    const LiteralTable*                         _literals = nullptr;
+    SymbolTable*                                _symbols  = nullptr;
+
+    /**
+     * @brief Creates the atomizers and maps every token type to the one handling it
+     *
+     * A token type claimed by several atomizers belongs to the first one
+     * created by the factory.
+     */
+    void createAtomizers();
+
+    /**
+     * @brief Runs the atomizers over the token stream until EOF or the end of the range
+     *
+     * Detaches the stream once done, so it only needs to live during the call.
+     */
+    void parse();
+
+    /**
+     * @brief Drops consumed tokens from a streaming window
+     *
+     * Keeps WINDOW_HISTORY tokens behind the cursor so lookbacks stay valid.
+     */
+    void compactWindow();
 
     /**
      * @brief Checks if the parser has reached the end of the token stream
+     *
+     * Pulls the current token from the stream first when streaming.
+     *
      * @return bool True if at the end of tokens, false otherwise
      */
-    bool isAtEnd() const;
+    bool isAtEnd();
 
     /**
      * @brief Returns the current token without consuming it
-     * @return Token The current token
+     * @return const Token& The current token, valid until the window is extended or compacted
      */
-    Token peek() const;
+    const Token& peek() const;
 
 public:
     /**
      * @brief Constructs a new Parser object
-     * @param tokens The vector of tokens to parse
+     * @param tokens The vector of tokens to parse, moved in so that no copy of the array is made
+     * @param literals The table the payloads of NUMBER tokens index into, or nullptr to decode lexemes
+     * @param symbols The table the payloads of IDENTIFIER tokens index into, or nullptr to skip symbol ids
+     */
+    explicit Parser(std::vector<Token>  tokens,
+                    const LiteralTable* literals = nullptr,
+                    SymbolTable*        symbols  = nullptr);
+
+    /**
+     * @brief Constructs a new Parser object parsing the statements that start in a range of a token array
+     *
+     * The array is only read, so several parsers can share it across threads.
+     * The last statement may run past the end of the range, see getPosition.
+     *
+     * @param tokens The tokens, ending with EOF, which must outlive the parser
+     * @param begin The index of the token the first statement starts at
+     * @param end The index from which no further statement is started
+     * @param literals The table the payloads of NUMBER tokens index into, or nullptr to decode lexemes
+     * @param symbols The table the payloads of IDENTIFIER tokens index into, or nullptr to skip symbol ids
+     */
+    Parser(std::vector<Token>& tokens,
+           size_t              begin,
+           size_t              end,
+           const LiteralTable* literals = nullptr,
+           SymbolTable*        symbols  = nullptr);
+
+    /**
+     * @brief Constructs a new Parser object that pulls tokens on demand
+     * @param source The token source to parse, read until it yields EOF
+     */
+    explicit Parser(TokenSource& source);
+
+    /**
+     * @brief Constructs a new Parser object reading a compact token buffer
+     * @param buffer The token buffer to parse
+     */
+    explicit Parser(const TokenBuffer& buffer);
+
+    /**
+     * @brief Gets the parsed top-level nodes
+     * @return const std::vector<NodeBase*>& The nodes in source order, valid as long as the parser
+     */
+    const std::vector<NodeBase*>& getNodes() const;
+
+    /**
+     * @brief Parses the body of a pre-parsed function, unless it already was
+     *
+     * The statements are allocated by a parser kept by this one, so they live
+     * as long as this parser. Functions nested in the body are pre-parsed in
+     * turn and can be passed here as well.
+     *
+     * @param function A function node produced by this parser or by an earlier call
+     * @return std::span<NodeBase* const> The statements of the body in order
+     * @throws std::runtime_error On a parsing error in the body, leaving the function unparsed
+     */
+    std::span<NodeBase* const> parseFunctionBody(FunctionNode& function);
+
+    /**
+     * @brief Parses the body of every function, nested ones included
+     * @return size_t The number of bodies that were parsed by this call
+     * @throws std::runtime_error On the first parsing error in a body
+     */
+    size_t parseFunctionBodies();
+
+    /**
+     * @brief Gets where every parsed node starts
+     *
+     * Only meaningful when parsing a token array, as a streaming window drops consumed tokens.
+     *
+     * @return const std::vector<size_t>& The index of the first token of each node, parallel to getNodes
+     */
+    const std::vector<size_t>& getStarts() const { return this->_starts; }
+
+    /**
+     * @brief Gets the index of the token following the last parsed statement
+     * @return size_t The position the parse stopped at, in the token array when parsing a range
+     */
+    size_t getPosition() const { return this->_current; }
+
+    /**
+     * @brief Gets the arena holding the nodes
+     * @return const AstArena& The arena of the parse session
      */
-    explicit Parser(std::vector<Token> tokens);
+    const AstArena& getArena() const { return this->_arena; }
 
     /**
      * @brief Prints the Abstract Syntax Tree to standard output
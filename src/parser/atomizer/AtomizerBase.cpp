@@ -22,23 +22,68 @@
 #include "opal/parser/atomizer/AtomizerBase.hpp"
 
 #include "opal/lexer/Token.hpp"
+#include "opal/util/ErrorUtil.hpp"
 
+#include <stdexcept>
 #include <vector>
 
 namespace opal {
 
 AtomizerBase::AtomizerBase(size_t& current, std::vector<Token>& tokens) : _current(current), _tokens(tokens) {}
 
-Token AtomizerBase::peek() const {
+void AtomizerBase::setStream(TokenSource* stream) {
+    _stream = stream;
+}
+
+void AtomizerBase::setLiterals(const LiteralTable* literals) {
+    _literals = literals;
+}
+
+void AtomizerBase::setSymbols(SymbolTable* symbols) {
+    _symbols = symbols;
+}
+
+void AtomizerBase::setArena(AstArena* arena) {
+    _arena = arena ? arena : &_ownedArena;
+}
+
+bool AtomizerBase::hasToken(size_t index) const {
+    return index < _tokens.size() || (_stream && _stream->fillWindow(_tokens, index));
+}
+
+const Token& AtomizerBase::peek() const {
+    this->hasToken(_current);
     return _tokens[_current];
 }
 
-Token AtomizerBase::peekNext() const {
+const Token& AtomizerBase::peekNext() const {
+    this->hasToken(_current + 1);
     return _tokens[_current + 1];
 }
 
-Token AtomizerBase::advance() {
-    return _tokens[++_current];
+const Token& AtomizerBase::advance() {
+    ++_current;
+    return this->hasToken(_current) ? _tokens[_current] : _tokens.back();
+}
+
+NumericLiteral AtomizerBase::numberLiteral(const Token& token) const {
+    if (_literals && token.hasPayload()) {
+        return _literals->get(token.payload);
+    }
+
+    NumericLiteral literal;
+    if (!LiteralTable::decode(token.value, literal)) {
+        throw std::runtime_error(ErrorUtil::errorMessage("Number literal out of range", token.line, token.column));
+    }
+    return literal;
+}
+
+uint32_t AtomizerBase::symbolOf(std::string_view name) const {
+    return _symbols ? _symbols->intern(name) : SymbolTable::NO_SYMBOL;
+}
+
+uint32_t AtomizerBase::symbolOf(const Token& token) const {
+    return _symbols && token.hasPayload() ? token.payload : this->symbolOf(token.value);
 }
 
 }  // namespace opal
\ No newline at end of file
@@ -21,10 +21,15 @@
 
 #pragma once
 
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
 #include "opal/lexer/Token.hpp"
+#include "opal/lexer/TokenSource.hpp"
+#include "opal/parser/AstArena.hpp"
 #include "opal/parser/node/NodeBase.hpp"
 
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace opal {
@@ -35,11 +40,19 @@ namespace opal {
  *
  * Atomizers are responsible for converting sequences of tokens into AST nodes.
  * Each atomizer specializes in handling a specific language construct.
+ * When a token stream is attached, tokens past the end of the collection are
+ * pulled from it on demand. Nodes are created in the attached arena, or in one
+ * owned by the atomizer when it is used on its own.
  */
 class AtomizerBase {
 protected:
     size_t&             _current;
     std::vector<Token>& _tokens;
+    TokenSource*        _stream   = nullptr;
+    const LiteralTable* _literals = nullptr;
+    SymbolTable*        _symbols  = nullptr;
+    AstArena            _ownedArena;
+    AstArena*           _arena = &_ownedArena;
 
 public:
     /**
@@ -61,30 +74,107 @@ public:
      */
     virtual bool canHandle(TokenType type) const = 0;
 
+    /**
+     * @brief Gets the token types a construct handled by this atomizer can start with
+     *
+     * Used by the parser to build its dispatch table, so that only the atomizer
+     * registered for the current token type is asked through canHandle, which
+     * can still refuse it after looking ahead.
+     *
+     * @return std::span<const TokenType> The leading token types of the construct
+     */
+    virtual std::span<const TokenType> leadingTypes() const = 0;
+
     /**
      * @brief Converts a sequence of tokens into an AST node
-     * @return std::unique_ptr<NodeBase> A unique pointer to the created AST node
+     * @return NodeBase* The created AST node, owned by the arena of the atomizer
+     */
+    virtual NodeBase* atomize() = 0;
+
+    /**
+     * @brief Attaches a token stream used to extend the token collection
+     * @param stream The stream to pull tokens from, or nullptr to disable streaming
+     */
+    void setStream(TokenSource* stream);
+
+    /**
+     * @brief Attaches the table the payloads of NUMBER tokens index into
+     * @param literals The literal table of the lexer, or nullptr to decode lexemes instead
      */
-    virtual std::unique_ptr<NodeBase> atomize() = 0;
+    void setLiterals(const LiteralTable* literals);
+
+    /**
+     * @brief Attaches the table the payloads of IDENTIFIER tokens index into
+     * @param symbols The symbol table of the lexer, or nullptr to leave nodes without symbol ids
+     */
+    void setSymbols(SymbolTable* symbols);
+
+    /**
+     * @brief Attaches the arena nodes are created in
+     * @param arena The arena of the parse session, or nullptr to use the one owned by the atomizer
+     */
+    void setArena(AstArena* arena);
 
 protected:
+    /**
+     * @brief Checks whether a token exists at the given index, pulling it from the stream if needed
+     * @param index The token index to check
+     * @return bool True if the token collection holds a token at index, false otherwise
+     */
+    bool hasToken(size_t index) const;
+
     /**
      * @brief Returns the current token without consuming it
-     * @return Token The current token
+     *
+     * The reference points into the token collection, which grows when tokens
+     * are pulled from a stream, so copy the token to keep it across calls that
+     * may pull more tokens.
+     *
+     * @return const Token& The current token
      */
-    Token peek() const;
+    const Token& peek() const;
 
     /**
      * @brief Returns the next token without consuming it
-     * @return Token The next token
+     * @return const Token& The next token, with the same lifetime as the one returned by peek
+     */
+    const Token& peekNext() const;
+
+    /**
+     * @brief Consumes the current token and returns the one after it
+     * @return const Token& The new current token, or the last token at the end of the collection
+     */
+    const Token& advance();
+
+    /**
+     * @brief Gets the decoded value of a NUMBER token
+     *
+     * Reads the value the lexer stored in the literal table, and only decodes
+     * the lexeme for tokens that carry no payload, such as hand-built ones.
+     *
+     * @param token The NUMBER token
+     * @return NumericLiteral The value of the literal
+     * @throws std::runtime_error If the lexeme cannot be decoded
+     */
+    NumericLiteral numberLiteral(const Token& token) const;
+
+    /**
+     * @brief Gets the symbol id of a name
+     *
+     * Interns the name when a symbol table is attached, for instance for
+     * names found inside string interpolations.
+     *
+     * @param name The name to look up
+     * @return uint32_t The symbol id, or SymbolTable::NO_SYMBOL without a symbol table
      */
-    Token peekNext() const;
+    uint32_t symbolOf(std::string_view name) const;
 
     /**
-     * @brief Consumes and returns the current token
-     * @return Token The current token
+     * @brief Gets the symbol id of an IDENTIFIER token
+     * @param token The IDENTIFIER token
+     * @return uint32_t The id stored by the lexer, or the id of its name for tokens without payload
      */
-    Token advance();
+    uint32_t symbolOf(const Token& token) const;
 };
 
 }  // namespace opal
\ No newline at end of file
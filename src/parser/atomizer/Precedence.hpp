@@ -0,0 +1,117 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/TokenType.hpp"
+
+#include <cstdint>
+
+namespace opal {
+
+/**
+ * @enum Precedence
+ * @brief Binding strength of operators, from the loosest to the tightest
+ *
+ * Prefix operators bind like POWER so that -2 ^ 2 negates the power, and
+ * postfix operators and calls bind tighter than every binary operator.
+ */
+enum class Precedence : uint8_t {
+    NONE,
+    OR,
+    AND,
+    BITWISE_OR,
+    BITWISE_XOR,
+    BITWISE_AND,
+    EQUALITY,
+    COMPARISON,
+    RANGE,
+    SHIFT,
+    TERM,
+    FACTOR,
+    POWER,
+    POSTFIX
+};
+
+/**
+ * @brief Gets the precedence of a token used as a binary operator
+ * @param type The token type of the operator
+ * @return Precedence The binding strength, or Precedence::NONE if the token is not a binary operator
+ */
+constexpr Precedence binaryPrecedence(TokenType type) {
+    switch (type) {
+        case TokenType::OR:
+            return Precedence::OR;
+        case TokenType::AND:
+            return Precedence::AND;
+        case TokenType::BITWISE_OR:
+            return Precedence::BITWISE_OR;
+        case TokenType::BITWISE_XOR:
+            return Precedence::BITWISE_XOR;
+        case TokenType::BITWISE_AND:
+            return Precedence::BITWISE_AND;
+        case TokenType::EQUAL_EQUAL:
+        case TokenType::NOT_EQUAL:
+            return Precedence::EQUALITY;
+        case TokenType::GREATER:
+        case TokenType::GREATER_EQUAL:
+        case TokenType::LESS:
+        case TokenType::LESS_EQUAL:
+            return Precedence::COMPARISON;
+        case TokenType::RANGE:
+            return Precedence::RANGE;
+        case TokenType::SHIFT_LEFT:
+        case TokenType::SHIFT_RIGHT:
+            return Precedence::SHIFT;
+        case TokenType::PLUS:
+        case TokenType::MINUS:
+            return Precedence::TERM;
+        case TokenType::MULTIPLY:
+        case TokenType::DIVIDE:
+        case TokenType::MODULO:
+            return Precedence::FACTOR;
+        case TokenType::POWER:
+            return Precedence::POWER;
+        default:
+            return Precedence::NONE;
+    }
+}
+
+/**
+ * @brief Checks if a binary operator groups from the right
+ * @param type The token type of the operator
+ * @return bool True for the power operator, so that 2 ^ 3 ^ 2 is 2 ^ (3 ^ 2)
+ */
+constexpr bool isRightAssociative(TokenType type) {
+    return type == TokenType::POWER;
+}
+
+/**
+ * @brief Gets the minimum precedence of the right operand of a binary operator
+ * @param type The token type of the operator
+ * @return Precedence The precedence of the operator for right-associative ones, the next tighter one otherwise
+ */
+constexpr Precedence rightOperandPrecedence(TokenType type) {
+    Precedence precedence = binaryPrecedence(type);
+    return isRightAssociative(type) ? precedence : static_cast<Precedence>(static_cast<uint8_t>(precedence) + 1);
+}
+
+}  // namespace opal
@@ -31,6 +31,10 @@ bool ConditionAtomizer::canHandle(TokenType type) const {
     return type == TokenType::IF;
 }
 
-std::unique_ptr<NodeBase> ConditionAtomizer::atomize() {
+std::span<const TokenType> ConditionAtomizer::leadingTypes() const {
+    return LEADING_TYPES;
+}
+
+NodeBase* ConditionAtomizer::atomize() {
     return nullptr;
 }
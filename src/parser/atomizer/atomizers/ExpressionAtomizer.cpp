@@ -0,0 +1,185 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/atomizer/atomizers/ExpressionAtomizer.hpp"
+
+#include "opal/lexer/TokenClass.hpp"
+#include "opal/parser/node/NodeFactory.hpp"
+#include "opal/util/ErrorUtil.hpp"
+
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace opal;
+
+ExpressionAtomizer::ExpressionAtomizer(size_t& current, std::vector<Token>& tokens) : AtomizerBase(current, tokens) {}
+
+bool ExpressionAtomizer::canHandle(TokenType type) const {
+    return isExpressionStart(type);
+}
+
+std::span<const TokenType> ExpressionAtomizer::leadingTypes() const {
+    return LEADING_TYPES;
+}
+
+NodeBase* ExpressionAtomizer::atomize() {
+    this->_arguments.clear();
+    this->_depth = 0;
+
+    NodeBase* expression = this->parseExpression(Precedence::OR);
+
+    if (this->hasToken(this->_current) && this->_tokens[this->_current].type == TokenType::RIGHT_PAREN) {
+        const Token& token = this->_tokens[this->_current];
+        throw std::runtime_error(ErrorUtil::errorMessage("Unmatched right parenthesis", token.line, token.column));
+    }
+    return expression;
+}
+
+NodeBase* ExpressionAtomizer::parseExpression(Precedence minPrecedence) {
+    NodeBase* left = this->parseUnary();
+
+    while (this->hasToken(this->_current)) {
+        TokenType  op         = this->_tokens[this->_current].type;
+        Precedence precedence = binaryPrecedence(op);
+        if (precedence == Precedence::NONE || precedence < minPrecedence) {
+            break;
+        }
+
+        // Right-associative chains recurse once per operator, so they count against the depth too
+        this->enter(this->_tokens[this->_current]);
+        this->advance();
+        NodeBase* right = this->parseExpression(rightOperandPrecedence(op));
+        left            = NodeFactory::createBinaryNode(*this->_arena, op, left, right);
+        this->_depth--;
+    }
+    return left;
+}
+
+NodeBase* ExpressionAtomizer::parseUnary() {
+    if (!this->hasToken(this->_current)) {
+        const Token& token = this->lastToken();
+        throw std::runtime_error(ErrorUtil::errorMessage("Expected operand", token.line, token.column));
+    }
+
+    Token token = this->_tokens[this->_current];
+    if (!isPrefixOperator(token.type)) {
+        return this->parsePostfix(this->parsePrimary());
+    }
+
+    this->enter(token);
+    this->advance();
+    NodeBase* operand = this->parseExpression(Precedence::POWER);
+    this->_depth--;
+    return NodeFactory::createUnaryNode(*this->_arena, token.type, operand);
+}
+
+NodeBase* ExpressionAtomizer::parsePrimary() {
+    Token token = this->_tokens[this->_current];
+
+    if (isLiteral(token.type) || token.type == TokenType::IDENTIFIER) {
+        this->advance();
+        return NodeFactory::createOperandNode(*this->_arena, token);
+    }
+
+    if (token.type == TokenType::RIGHT_PAREN) {
+        throw std::runtime_error(ErrorUtil::errorMessage("Unmatched right parenthesis", token.line, token.column));
+    }
+
+    if (token.type != TokenType::LEFT_PAREN) {
+        throw std::runtime_error(
+            ErrorUtil::errorMessage("Invalid operation: expected a number, identifier, or parenthesized expression",
+                                    token.line,
+                                    token.column));
+    }
+
+    this->enter(token);
+    this->advance();
+    if (this->hasToken(this->_current) && this->_tokens[this->_current].type == TokenType::RIGHT_PAREN) {
+        const Token& closing = this->_tokens[this->_current];
+        throw std::runtime_error(
+            ErrorUtil::errorMessage("Invalid operation: empty parentheses", closing.line, closing.column));
+    }
+
+    NodeBase* expression = this->parseExpression(Precedence::OR);
+    if (!this->hasToken(this->_current) || this->_tokens[this->_current].type != TokenType::RIGHT_PAREN) {
+        throw std::runtime_error(ErrorUtil::errorMessage("Unmatched left parenthesis", token.line, token.column));
+    }
+
+    this->advance();
+    this->_depth--;
+    return expression;
+}
+
+NodeBase* ExpressionAtomizer::parsePostfix(NodeBase* operand) {
+    while (this->hasToken(this->_current)) {
+        TokenType type     = this->_tokens[this->_current].type;
+        bool      callable = operand->getNodeType() == NodeType::CALL
+                        || (operand->getNodeType() == NodeType::OPERAND
+                            && operand->getTokenType() == TokenType::IDENTIFIER);
+
+        if (type == TokenType::LEFT_PAREN && callable) {
+            operand = this->parseCall(operand);
+        } else if (isPostfixOperator(type)) {
+            this->advance();
+            operand = NodeFactory::createUnaryNode(*this->_arena, type, operand, true);
+        } else {
+            break;
+        }
+    }
+    return operand;
+}
+
+NodeBase* ExpressionAtomizer::parseCall(NodeBase* callee) {
+    Token paren = this->_tokens[this->_current];
+    this->enter(paren);
+    this->advance();
+
+    size_t first = this->_arguments.size();
+    if (this->hasToken(this->_current) && this->_tokens[this->_current].type != TokenType::RIGHT_PAREN) {
+        this->_arguments.push_back(this->parseExpression(Precedence::OR));
+        while (this->hasToken(this->_current) && this->_tokens[this->_current].type == TokenType::COMMA) {
+            this->advance();
+            this->_arguments.push_back(this->parseExpression(Precedence::OR));
+        }
+    }
+
+    if (!this->hasToken(this->_current) || this->_tokens[this->_current].type != TokenType::RIGHT_PAREN) {
+        throw std::runtime_error(ErrorUtil::errorMessage("Unmatched left parenthesis", paren.line, paren.column));
+    }
+    this->advance();
+    this->_depth--;
+
+    std::span<NodeBase* const> arguments(this->_arguments.data() + first, this->_arguments.size() - first);
+    CallNode*                  call = NodeFactory::createCallNode(*this->_arena, callee, arguments);
+    this->_arguments.resize(first);
+    return call;
+}
+
+void ExpressionAtomizer::enter(const Token& token) {
+    if (++this->_depth > MAX_DEPTH) {
+        throw std::runtime_error(ErrorUtil::errorMessage("Expression nested too deeply", token.line, token.column));
+    }
+}
+
+const Token& ExpressionAtomizer::lastToken() const {
+    return this->_tokens[this->_current - 1];
+}
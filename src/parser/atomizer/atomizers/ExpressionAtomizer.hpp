@@ -0,0 +1,150 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/parser/atomizer/AtomizerBase.hpp"
+#include "opal/parser/atomizer/Precedence.hpp"
+#include "opal/parser/node/NodeFactory.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class ExpressionAtomizer
+ * @brief Atomizer building expression trees by precedence climbing
+ *
+ * Parses unary, binary, comparison, logical, bitwise, range and power
+ * operators, parenthesized groups and calls in a single left-to-right pass
+ * without backtracking. Each operator token is read once and turned into a
+ * UnaryNode or BinaryNode whose shape encodes precedence and associativity,
+ * with OperandNode leaves for literals and identifiers.
+ */
+class ExpressionAtomizer : public AtomizerBase {
+private:
+    static constexpr std::array<TokenType, 12> LEADING_TYPES = {TokenType::NUMBER,
+                                                                TokenType::STRING,
+                                                                TokenType::TRUE,
+                                                                TokenType::FALSE,
+                                                                TokenType::NIL,
+                                                                TokenType::IDENTIFIER,
+                                                                TokenType::LEFT_PAREN,
+                                                                TokenType::MINUS,
+                                                                TokenType::NOT,
+                                                                TokenType::BITWISE_NOT,
+                                                                TokenType::INCREMENT,
+                                                                TokenType::DECREMENT};
+
+    /**
+     * @brief Maximum nesting of groups, calls, prefix operators and binary right operands, bounding the recursion
+     */
+    static constexpr size_t MAX_DEPTH = 256;
+
+    std::vector<NodeBase*> _arguments;  ///< Scratch stack of the arguments of the calls being parsed
+    size_t                 _depth = 0;  ///< Current nesting of groups, calls, prefix operators and right operands
+
+    /**
+     * @brief Parses an expression whose operators bind at least as tightly as the given precedence
+     * @param minPrecedence The loosest operator allowed at this level
+     * @return NodeBase* The root of the parsed expression
+     * @throws std::runtime_error If an operand is missing or a parenthesis is unmatched
+     */
+    NodeBase* parseExpression(Precedence minPrecedence);
+
+    /**
+     * @brief Parses an operand, with its prefix operators and its postfix operators and calls
+     * @return NodeBase* The parsed operand
+     * @throws std::runtime_error If no operand starts at the current token
+     */
+    NodeBase* parseUnary();
+
+    /**
+     * @brief Parses a literal, an identifier or a parenthesized expression
+     * @return NodeBase* The parsed operand
+     * @throws std::runtime_error If no operand starts at the current token
+     */
+    NodeBase* parsePrimary();
+
+    /**
+     * @brief Parses the calls and postfix operators following an operand
+     * @param operand The operand they apply to
+     * @return NodeBase* The operand wrapped in call and unary nodes
+     */
+    NodeBase* parsePostfix(NodeBase* operand);
+
+    /**
+     * @brief Parses the argument list of a call, starting at its opening parenthesis
+     * @param callee The called expression
+     * @return NodeBase* The call node
+     * @throws std::runtime_error If the argument list is not closed
+     */
+    NodeBase* parseCall(NodeBase* callee);
+
+    /**
+     * @brief Enters a nested group, call, prefix operator or binary right operand
+     * @param token The token opening it, used for error reporting
+     * @throws std::runtime_error If the expression is nested deeper than MAX_DEPTH
+     */
+    void enter(const Token& token);
+
+    /**
+     * @brief Gets the token to report an error at when the tokens ran out
+     * @return const Token& The last token available
+     */
+    const Token& lastToken() const;
+
+public:
+    /**
+     * @brief Constructs a new Expression Atomizer object
+     * @param current Reference to the current token index
+     * @param tokens Reference to the token collection
+     */
+    ExpressionAtomizer(size_t& current, std::vector<Token>& tokens);
+
+    /**
+     * @brief Checks if this atomizer can handle the given token type
+     * @param type The token type to check
+     * @return bool True if an expression can start with the token type, false otherwise
+     */
+    bool canHandle(TokenType type) const override;
+
+    /**
+     * @brief Gets the token types a construct handled by this atomizer can start with
+     * @return std::span<const TokenType> The leading token types of the construct
+     */
+    std::span<const TokenType> leadingTypes() const override;
+
+    /**
+     * @brief Parses an expression into a tree of expression nodes
+     *
+     * Stops at the first token that cannot continue the expression, which is
+     * left unconsumed.
+     *
+     * @return NodeBase* The root of the expression, owned by the arena of the atomizer
+     * @throws std::runtime_error If the expression is malformed or followed by an unmatched parenthesis
+     */
+    NodeBase* atomize() override;
+};
+
+}  // namespace opal
@@ -0,0 +1,98 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/atomizer/atomizers/FunctionAtomizer.hpp"
+
+#include "opal/parser/node/NodeFactory.hpp"
+#include "opal/util/ErrorUtil.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace opal;
+
+FunctionAtomizer::FunctionAtomizer(size_t& current, std::vector<Token>& tokens) : AtomizerBase(current, tokens) {}
+
+bool FunctionAtomizer::canHandle(TokenType type) const {
+    return type == TokenType::FN;
+}
+
+std::span<const TokenType> FunctionAtomizer::leadingTypes() const {
+    return LEADING_TYPES;
+}
+
+const Token& FunctionAtomizer::expect(TokenType type, const char* message, const Token& at) {
+    if (!this->hasToken(this->_current)) {
+        throw std::runtime_error(ErrorUtil::errorMessage(message, at.line, at.column));
+    }
+
+    const Token& token = this->_tokens[this->_current];
+    if (token.type != type) {
+        throw std::runtime_error(ErrorUtil::errorMessage(message, token.line, token.column));
+    }
+    this->_current++;
+    return token;
+}
+
+NodeBase* FunctionAtomizer::atomize() {
+    Token fnToken = this->_tokens[this->_current];
+    this->_current++;
+
+    Token name = this->expect(TokenType::IDENTIFIER, "Expected function name after fn", fnToken);
+    this->expect(TokenType::LEFT_PAREN, "Expected ( after function name", name);
+
+    std::vector<std::string_view> parameters;
+    if (this->hasToken(this->_current) && this->_tokens[this->_current].type != TokenType::RIGHT_PAREN) {
+        parameters.push_back(this->expect(TokenType::IDENTIFIER, "Expected parameter name", name).value);
+        while (this->hasToken(this->_current) && this->_tokens[this->_current].type == TokenType::COMMA) {
+            this->_current++;
+            parameters.push_back(this->expect(TokenType::IDENTIFIER, "Expected parameter name", name).value);
+        }
+    }
+    this->expect(TokenType::RIGHT_PAREN, "Expected ) after function parameters", name);
+    Token openBrace = this->expect(TokenType::LEFT_BRACE, "Expected { before function body", name);
+
+    // Only the braces are checked, the statements are parsed when the function is first used
+    size_t bodyStart = this->_current;
+    size_t depth     = 1;
+    while (depth > 0) {
+        if (!this->hasToken(this->_current) || this->_tokens[this->_current].type == TokenType::EOF_TOKEN) {
+            throw std::runtime_error(
+                ErrorUtil::errorMessage("Unclosed function body", openBrace.line, openBrace.column));
+        }
+
+        TokenType type = this->_tokens[this->_current].type;
+        if (type == TokenType::LEFT_BRACE) {
+            depth++;
+        } else if (type == TokenType::RIGHT_BRACE) {
+            depth--;
+        }
+        this->_current++;
+    }
+
+    std::span<Token> body(this->_tokens.data() + bodyStart, this->_current - bodyStart);
+    if (this->_stream != nullptr) {
+        body = this->_arena->copyArray(std::span<const Token>(body));
+    }
+
+    return NodeFactory::createFunctionNode(*this->_arena, name.value, this->symbolOf(name), parameters, body);
+}
@@ -0,0 +1,87 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/parser/atomizer/AtomizerBase.hpp"
+#include "opal/parser/node/NodeFactory.hpp"
+
+#include <array>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class FunctionAtomizer
+ * @brief Atomizer pre-parsing function declarations
+ *
+ * Reads the name and parameter list of a function, then skips its body while
+ * checking that the braces balance, and keeps the body tokens for the parser
+ * to parse on first use. The body tokens are viewed in the token collection,
+ * or copied into the arena when tokens come from a stream whose window drops
+ * them.
+ */
+class FunctionAtomizer : public AtomizerBase {
+private:
+    static constexpr std::array<TokenType, 1> LEADING_TYPES = {TokenType::FN};
+
+    /**
+     * @brief Checks that the current token has a type and consumes it
+     * @param type The expected token type
+     * @param message The error message if it does not match
+     * @param at The token reported when the collection ends before it
+     * @return const Token& The consumed token, valid until more tokens are pulled from the stream
+     * @throws std::runtime_error If the current token is missing or of another type
+     */
+    const Token& expect(TokenType type, const char* message, const Token& at);
+
+public:
+    /**
+     * @brief Constructs a new Function Atomizer object
+     * @param current Reference to the current token index
+     * @param tokens Reference to the token collection
+     */
+    FunctionAtomizer(size_t& current, std::vector<Token>& tokens);
+
+    /**
+     * @brief Checks if this atomizer can handle the given token type
+     * @param type The token type to check
+     * @return bool True if this atomizer can handle the token type, false otherwise
+     */
+    bool canHandle(TokenType type) const override;
+
+    /**
+     * @brief Gets the token types a construct handled by this atomizer can start with
+     * @return std::span<const TokenType> The leading token types of the construct
+     */
+    std::span<const TokenType> leadingTypes() const override;
+
+    /**
+     * @brief Pre-parses a function declaration into a function node with an unparsed body
+     * @return NodeBase* The created function node, owned by the arena of the atomizer
+     * @throws std::runtime_error If the name, parameter list or braces of the body are malformed
+     */
+    NodeBase* atomize() override;
+};
+
+}  // namespace opal
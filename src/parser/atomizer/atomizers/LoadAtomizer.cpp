@@ -37,11 +37,15 @@ bool LoadAtomizer::canHandle(TokenType type) const {
     return type == TokenType::LOAD;
 }
 
-std::unique_ptr<NodeBase> LoadAtomizer::atomize() {
+std::span<const TokenType> LoadAtomizer::leadingTypes() const {
+    return LEADING_TYPES;
+}
+
+NodeBase* LoadAtomizer::atomize() {
     Token loadToken = this->_tokens[this->_current];
     this->advance();
 
-    if (this->_current >= this->_tokens.size()) {
+    if (!this->hasToken(this->_current)) {
         throw std::runtime_error(
             ErrorUtil::errorMessage("Expected string after load keyword", loadToken.line, loadToken.column));
     }
@@ -53,5 +57,5 @@ std::unique_ptr<NodeBase> LoadAtomizer::atomize() {
 
     std::string_view path = this->_tokens[this->_current].value;
     this->advance();
-    return std::unique_ptr<NodeBase>(NodeFactory::createLoadNode(path).release());
+    return NodeFactory::createLoadNode(*this->_arena, path);
 }
@@ -24,7 +24,8 @@
 #include "opal/parser/atomizer/AtomizerBase.hpp"
 #include "opal/parser/node/NodeFactory.hpp"
 
-#include <memory>
+#include <array>
+#include <span>
 #include <vector>
 
 namespace opal {
@@ -37,6 +38,9 @@ namespace opal {
  * in the Opal language, allowing for inclusion of external code files.
  */
 class LoadAtomizer : public AtomizerBase {
+private:
+    static constexpr std::array<TokenType, 1> LEADING_TYPES = {TokenType::LOAD};
+
 public:
     /**
      * @brief Constructs a new Load Atomizer object
@@ -52,11 +56,17 @@ public:
      */
     bool canHandle(TokenType type) const override;
 
+    /**
+     * @brief Gets the token types a construct handled by this atomizer can start with
+     * @return std::span<const TokenType> The leading token types of the construct
+     */
+    std::span<const TokenType> leadingTypes() const override;
+
     /**
      * @brief Converts a sequence of tokens into a load node
-     * @return std::unique_ptr<NodeBase> A unique pointer to the created load node
+     * @return NodeBase* The created load node, owned by the arena of the atomizer
      */
-    std::unique_ptr<NodeBase> atomize() override;
+    NodeBase* atomize() override;
 };
 
 }  // namespace opal
\ No newline at end of file
@@ -21,101 +21,35 @@
 
 #include "opal/parser/atomizer/atomizers/OperationAtomizer.hpp"
 
+#include "opal/lexer/TokenClass.hpp"
 #include "opal/parser/node/NodeFactory.hpp"
-#include "opal/util/ErrorUtil.hpp"
 
-#include <iostream>
-#include <memory>
-#include <stdexcept>
+#include <span>
 #include <vector>
 
 using namespace opal;
 
-OperationAtomizer::OperationAtomizer(size_t& current, std::vector<Token>& tokens) : AtomizerBase(current, tokens) {}
+OperationAtomizer::OperationAtomizer(size_t& current, std::vector<Token>& tokens)
+    : AtomizerBase(current, tokens), _expressionAtomizer(current, tokens) {}
 
 bool OperationAtomizer::canHandle(TokenType type) const {
-    return type == TokenType::PLUS || type == TokenType::MINUS || type == TokenType::MULTIPLY
-           || type == TokenType::DIVIDE || type == TokenType::MODULO || type == TokenType::LEFT_PAREN;
+    return isOperationToken(type);
 }
 
-bool OperationAtomizer::isOperand(TokenType type) const {
-    return type == TokenType::NUMBER || type == TokenType::IDENTIFIER;
+std::span<const TokenType> OperationAtomizer::leadingTypes() const {
+    return LEADING_TYPES;
 }
 
-void OperationAtomizer::handleToken(std::vector<Token>& tokens, const Token& token) {
-    tokens.push_back(token);
-    this->advance();
-}
-
-void OperationAtomizer::handleParenthesizedExpression(std::vector<Token>& operationTokens) {
-    handleToken(operationTokens, this->_tokens[this->_current]);  // Push LEFT_PAREN
-
-    if (this->_current < this->_tokens.size() && this->_tokens[this->_current].type == TokenType::RIGHT_PAREN) {
-        throw std::runtime_error(ErrorUtil::errorMessage("Invalid operation: empty parentheses",
-                                                         this->_tokens[this->_current].line,
-                                                         this->_tokens[this->_current].column));
-    }
-
-    int parenCount = 1;
-    while (this->_current < this->_tokens.size() && parenCount > 0) {
-        TokenType currentType = this->_tokens[this->_current].type;
-        if (currentType == TokenType::LEFT_PAREN) {
-            parenCount++;
-        } else if (currentType == TokenType::RIGHT_PAREN) {
-            parenCount--;
-            if (parenCount == 0) {
-                handleToken(operationTokens, this->_tokens[this->_current]);
-                return;
-            }
-        }
-        handleToken(operationTokens, this->_tokens[this->_current]);
-    }
-
-    throw std::runtime_error(ErrorUtil::errorMessage("Unmatched left parenthesis",
-                                                     this->_tokens[this->_current - 1].line,
-                                                     this->_tokens[this->_current - 1].column));
-}
-
-void OperationAtomizer::handleOperand(std::vector<Token>& operationTokens) {
-    if (this->_current >= this->_tokens.size()) {
-        throw std::runtime_error(ErrorUtil::errorMessage("Expected operand",
-                                                         this->_tokens[this->_current - 1].line,
-                                                         this->_tokens[this->_current - 1].column));
-    }
-
-    Token currentToken = this->_tokens[this->_current];
-    if (currentToken.type == TokenType::LEFT_PAREN) {
-        handleParenthesizedExpression(operationTokens);
-    } else if (isOperand(currentToken.type)) {
-        handleToken(operationTokens, currentToken);
-    } else if (currentToken.type == TokenType::RIGHT_PAREN) {
-        throw std::runtime_error(
-            ErrorUtil::errorMessage("Unmatched right parenthesis", currentToken.line, currentToken.column));
-    } else {
-        throw std::runtime_error(
-            ErrorUtil::errorMessage("Invalid operation: expected a number, identifier, or parenthesized expression",
-                                    currentToken.line,
-                                    currentToken.column));
-    }
-}
-
-std::unique_ptr<NodeBase> OperationAtomizer::atomize() {
-    std::vector<Token> operationTokens;
-    handleOperand(operationTokens);
-
-    while (this->_current < this->_tokens.size()) {
-        Token currentToken = this->_tokens[this->_current];
-        if (!canHandle(currentToken.type)) {
-            if (currentToken.type == TokenType::RIGHT_PAREN) {
-                throw std::runtime_error(
-                    ErrorUtil::errorMessage("Unmatched right parenthesis", currentToken.line, currentToken.column));
-            }
-            break;
-        }
+NodeBase* OperationAtomizer::atomize() {
+    size_t first = this->_current;
 
-        handleToken(operationTokens, currentToken);
-        handleOperand(operationTokens);
-    }
+    this->_expressionAtomizer.setStream(this->_stream);
+    this->_expressionAtomizer.setLiterals(this->_literals);
+    this->_expressionAtomizer.setSymbols(this->_symbols);
+    this->_expressionAtomizer.setArena(this->_arena);
+    NodeBase* expression = this->_expressionAtomizer.atomize();
 
-    return NodeFactory::createOperationNode(operationTokens);
+    // The expression is one run of tokens, so it is read in place rather than collected while parsing
+    std::span<const Token> tokens(this->_tokens.data() + first, this->_current - first);
+    return NodeFactory::createOperationNode(*this->_arena, tokens, expression);
 }
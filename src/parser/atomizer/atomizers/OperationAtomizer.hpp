@@ -22,9 +22,11 @@
 #pragma once
 
 #include "opal/parser/atomizer/AtomizerBase.hpp"
+#include "opal/parser/atomizer/atomizers/ExpressionAtomizer.hpp"
 #include "opal/parser/node/NodeFactory.hpp"
 
-#include <memory>
+#include <array>
+#include <span>
 #include <vector>
 
 namespace opal {
@@ -34,40 +36,15 @@ namespace opal {
  * @brief Atomizer for handling mathematical and logical operations
  *
  * Processes token sequences that represent operations such as arithmetic,
- * logical comparisons, and other expressions in the Opal language.
+ * logical comparisons, and other expressions in the Opal language. The tokens
+ * are read once by an ExpressionAtomizer, and the node keeps both the tokens
+ * it consumed and the expression tree built from them.
  */
 class OperationAtomizer : public AtomizerBase {
 private:
-    /**
-     * @brief Checks if the given token type represents a valid operand
-     * @param type The token type to check
-     * @return bool True if the token type is a valid operand
-     */
-    bool isOperand(TokenType type) const;
+    static constexpr std::array<TokenType, 1> LEADING_TYPES = {TokenType::LEFT_PAREN};
 
-    /**
-     * @brief Processes a parenthesized expression and adds its tokens to the operation
-     * @param operationTokens Vector to store the processed tokens
-     */
-    void handleParenthesizedExpression(std::vector<Token>& operationTokens);
-
-    /**
-     * @brief Processes an operand (number, identifier, or parenthesized expression)
-     * @param operationTokens Vector to store the processed tokens
-     */
-    void handleOperand(std::vector<Token>& operationTokens);
-
-    /**
-     * @brief Checks for unmatched right parenthesis in the token sequence
-     */
-    void checkUnmatchedRightParenthesis() const;
-
-    /**
-     * @brief Processes a token and adds it to the operation tokens vector
-     * @param tokens Vector to store the processed tokens
-     * @param token The token to process
-     */
-    void handleToken(std::vector<Token>& tokens, const Token& token);
+    ExpressionAtomizer _expressionAtomizer;  ///< Parses the tokens of the operation into an expression tree
 
 public:
     /**
@@ -84,11 +61,18 @@ public:
      */
     bool canHandle(TokenType type) const override;
 
+    /**
+     * @brief Gets the token types a construct handled by this atomizer can start with
+     * @return std::span<const TokenType> The leading token types of the construct
+     */
+    std::span<const TokenType> leadingTypes() const override;
+
     /**
      * @brief Converts a sequence of tokens into an operation node
-     * @return std::unique_ptr<NodeBase> A unique pointer to the created operation node
+     * @return NodeBase* The created operation node, owned by the arena of the atomizer
+     * @throws std::runtime_error If the operation is malformed
      */
-    std::unique_ptr<NodeBase> atomize() override;
+    NodeBase* atomize() override;
 };
 
 }  // namespace opal
\ No newline at end of file
@@ -24,6 +24,9 @@
 #include "opal/parser/node/nodes/StringNode.hpp"
 #include "opal/util/ErrorUtil.hpp"
 
+#include <cstring>
+#include <stdexcept>
+
 using namespace opal;
 
 StringAtomizer::StringAtomizer(size_t& current, std::vector<Token>& tokens) : AtomizerBase(current, tokens) {}
@@ -32,52 +35,68 @@ bool StringAtomizer::canHandle(TokenType type) const {
     return type == TokenType::STRING;
 }
 
-std::unique_ptr<NodeBase> StringAtomizer::atomize() {
-    if (this->_current >= this->_tokens.size()) {
+std::span<const TokenType> StringAtomizer::leadingTypes() const {
+    return LEADING_TYPES;
+}
+
+NodeBase* StringAtomizer::atomize() {
+    if (!this->hasToken(this->_current)) {
         throw std::runtime_error(ErrorUtil::errorMessage("Unexpected end of input while parsing string",
                                                          this->_tokens[this->_current - 1].line,
                                                          this->_tokens[this->_current - 1].column));
     }
 
-    std::unique_ptr<opal::StringNode> stringNode = NodeFactory::createStringNode();
-    parseStringContent(stringNode.get(), std::string(this->_tokens[this->_current].value));
+    this->_segments.clear();
+    parseStringContent(this->_tokens[this->_current].value);
+    StringNode* stringNode = NodeFactory::createStringNode(*this->_arena, this->_segments);
 
     this->advance();
     return stringNode;
 }
 
-void StringAtomizer::parseStringContent(StringNode* stringNode, const std::string& content) {
-    size_t pos     = 0;
-    size_t lastPos = 0;
-
-    while (pos < content.length()) {
-        if (isInterpolationStart(content, pos)) {
-            if (pos > lastPos) {
-                stringNode->addTextSegment(content.substr(lastPos, pos - lastPos));
-            }
-
-            size_t endPos = content.find('}', pos + 2);
-            if (endPos == std::string::npos) {
-                throw std::runtime_error(ErrorUtil::errorMessage("Unterminated string interpolation",
-                                                                 this->_tokens[this->_current].line,
-                                                                 this->_tokens[this->_current].column));
-            }
-
-            std::string varName = content.substr(pos + 2, endPos - (pos + 2));
-            stringNode->addVariableSegment(varName);
-
-            pos     = endPos + 1;
-            lastPos = pos;
-        } else {
-            pos++;
+void StringAtomizer::parseStringContent(std::string_view content) {
+    const char* data      = content.data();
+    size_t      length    = content.size();
+    size_t      pos       = 0;
+    size_t      textStart = 0;
+
+    // Jump between '$' candidates instead of testing every byte for "${"
+    while (pos < length) {
+        auto dollar = static_cast<const char*>(std::memchr(data + pos, '$', length - pos));
+        if (!dollar) {
+            break;
         }
+
+        size_t start = static_cast<size_t>(dollar - data);
+        if (!isInterpolationStart(content, start)) {
+            pos = start + 1;
+            continue;
+        }
+
+        auto close = static_cast<const char*>(std::memchr(data + start + 2, '}', length - (start + 2)));
+        if (!close) {
+            throw std::runtime_error(ErrorUtil::errorMessage("Unterminated string interpolation",
+                                                             this->_tokens[this->_current].line,
+                                                             this->_tokens[this->_current].column));
+        }
+
+        if (start > textStart) {
+            this->_segments.push_back({StringSegmentType::TEXT, content.substr(textStart, start - textStart)});
+        }
+
+        size_t           end     = static_cast<size_t>(close - data);
+        std::string_view varName = content.substr(start + 2, end - (start + 2));
+        this->_segments.push_back({StringSegmentType::VARIABLE, varName, this->symbolOf(varName)});
+
+        pos       = end + 1;
+        textStart = pos;
     }
 
-    if (lastPos < content.length()) {
-        stringNode->addTextSegment(content.substr(lastPos));
+    if (textStart < length) {
+        this->_segments.push_back({StringSegmentType::TEXT, content.substr(textStart)});
     }
 }
 
-bool StringAtomizer::isInterpolationStart(const std::string& content, size_t pos) const {
+bool StringAtomizer::isInterpolationStart(std::string_view content, size_t pos) const {
     return pos + 1 < content.length() && content[pos] == '$' && content[pos + 1] == '{';
-}
\ No newline at end of file
+}
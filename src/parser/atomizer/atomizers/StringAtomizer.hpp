@@ -26,7 +26,9 @@
 #include "opal/parser/node/nodes/StringNode.hpp"
 #include "opal/parser/node/NodeBase.hpp"
 
-#include <memory>
+#include <array>
+#include <span>
+#include <string_view>
 #include <vector>
 
 namespace opal {
@@ -36,6 +38,11 @@ namespace opal {
  * @brief Handles atomization of string literals, including interpolation. Empty strings will have no segments.
  */
 class StringAtomizer : public AtomizerBase {
+private:
+    static constexpr std::array<TokenType, 1> LEADING_TYPES = {TokenType::STRING};
+
+    std::vector<StringSegment> _segments;  ///< Scratch list of the segments of the string being parsed
+
 public:
     /**
      * @brief Construct a new String Atomizer
@@ -51,21 +58,31 @@ public:
      */
     bool canHandle(TokenType type) const override;
 
+    /**
+     * @brief Gets the token types a construct handled by this atomizer can start with
+     * @return std::span<const TokenType> The leading token types of the construct
+     */
+    std::span<const TokenType> leadingTypes() const override;
+
     /**
      * @brief Process a string token and create a StringNode
-     * @return std::unique_ptr<NodeBase> The created node
+     * @return NodeBase* The created node, owned by the arena of the atomizer
      * @throws std::runtime_error if unexpected end of input or unterminated interpolation
      */
-    std::unique_ptr<NodeBase> atomize() override;
+    NodeBase* atomize() override;
 
 private:
     /**
-     * @brief Parse string content for interpolation markers
-     * @param stringNode The node to populate with segments
-     * @param content The string content to parse
+     * @brief Parse string content for interpolation markers into the scratch segment list
+     *
+     * Only '$' bytes are candidates for a marker, so the content is searched
+     * for them with memchr and the text in between is never looked at.
+     *
+     * @param content The string content to parse, which the segments view into
+     * @throws std::runtime_error if an interpolation is not closed
      * @note For empty strings, no segments will be added
      */
-    void parseStringContent(StringNode* stringNode, const std::string& content);
+    void parseStringContent(std::string_view content);
 
     /**
      * @brief Check if a character at position is the start of interpolation
@@ -73,7 +90,7 @@ private:
      * @param pos Current position in the string
      * @return true if interpolation marker found
      */
-    bool isInterpolationStart(const std::string& content, size_t pos) const;
+    bool isInterpolationStart(std::string_view content, size_t pos) const;
 };
 
 }  // namespace opal
\ No newline at end of file
@@ -21,6 +21,7 @@
 
 #include "opal/parser/atomizer/atomizers/VariableAtomizer.hpp"
 
+#include "opal/lexer/TokenClass.hpp"
 #include "opal/parser/atomizer/VariableType.hpp"
 #include "opal/parser/atomizer/atomizers/OperationAtomizer.hpp"
 #include "opal/parser/atomizer/atomizers/StringAtomizer.hpp"
@@ -28,52 +29,59 @@
 #include "opal/util/ErrorUtil.hpp"
 
 #include <iostream>
-#include <memory>
 #include <stdexcept>
 #include <vector>
 
 using namespace opal;
 
-VariableAtomizer::VariableAtomizer(size_t& current, std::vector<Token>& tokens) : AtomizerBase(current, tokens) {}
+VariableAtomizer::VariableAtomizer(size_t& current, std::vector<Token>& tokens)
+    : AtomizerBase(current, tokens), _operationAtomizer(current, tokens), _stringAtomizer(current, tokens) {}
 
 bool VariableAtomizer::canHandle(TokenType type) const {
     if (type != TokenType::IDENTIFIER)
         return false;
 
     size_t nextIndex = this->_current + 1;
-    if (nextIndex < this->_tokens.size() && this->_tokens[nextIndex].type == TokenType::LEFT_PAREN) {
+    if (this->hasToken(nextIndex) && this->_tokens[nextIndex].type == TokenType::LEFT_PAREN) {
         return false;
     }
     return true;
 }
 
-std::unique_ptr<NodeBase> VariableAtomizer::atomize() {
-    std::string variableName = std::string(_tokens[_current].value);
+std::span<const TokenType> VariableAtomizer::leadingTypes() const {
+    return LEADING_TYPES;
+}
+
+NodeBase* VariableAtomizer::atomize() {
+    std::string_view variableName = _tokens[_current].value;
+    uint32_t         symbol       = this->symbolOf(_tokens[_current]);
     this->advance();
 
-    if (this->_current < this->_tokens.size() && this->_tokens[this->_current].type == TokenType::EQUAL) {
+    if (this->hasToken(this->_current) && this->_tokens[this->_current].type == TokenType::EQUAL) {
         Token equalToken = this->_tokens[this->_current];
         this->advance();
 
-        if (this->_current >= this->_tokens.size()) {
+        if (!this->hasToken(this->_current)) {
             throw std::runtime_error(ErrorUtil::errorMessage("No value provided after assignment operator",
                                                              equalToken.line,
                                                              equalToken.column));
         }
 
         bool isConst = (this->_current >= 3 && this->_tokens[this->_current - 3].type == TokenType::CONST);
-        std::unique_ptr<VariableNode> variableNode =
-            NodeFactory::createVariableNode(variableName, "", isConst, VariableType::UNKNOWN);
+        VariableNode* variableNode =
+            NodeFactory::createVariableNode(*this->_arena, variableName, "", isConst, VariableType::UNKNOWN);
+        variableNode->setSymbol(symbol);
 
-        return std::unique_ptr<NodeBase>(this->handleAssignment(variableNode).release());
+        return this->handleAssignment(variableNode);
     } else {
-        std::unique_ptr<VariableNode> variableNode =
-            NodeFactory::createVariableNode(variableName, "", false, VariableType::UNKNOWN);
-        return std::unique_ptr<NodeBase>(variableNode.release());
+        VariableNode* variableNode =
+            NodeFactory::createVariableNode(*this->_arena, variableName, "", false, VariableType::UNKNOWN);
+        variableNode->setSymbol(symbol);
+        return variableNode;
     }
 }
 
-std::unique_ptr<NodeBase> VariableAtomizer::handleAssignment(std::unique_ptr<VariableNode>& variableNode) {
+NodeBase* VariableAtomizer::handleAssignment(VariableNode* variableNode) {
     TokenType currentType = this->_tokens[this->_current].type;
 
     if (shouldHandleAsOperation(currentType)) {
@@ -82,23 +90,23 @@ std::unique_ptr<NodeBase> VariableAtomizer::handleAssignment(std::unique_ptr<Var
 
     setVariableValueAndType(variableNode, currentType);
     this->advance();
-    return std::unique_ptr<NodeBase>(variableNode.release());
+    return variableNode;
 }
 
-void VariableAtomizer::setVariableValueAndType(std::unique_ptr<VariableNode>& variableNode, TokenType type) {
+void VariableAtomizer::setVariableValueAndType(VariableNode* variableNode, TokenType type) {
     switch (type) {
         case TokenType::STRING: {
-            StringAtomizer              stringAtomizer(this->_current, this->_tokens);
-            std::unique_ptr<StringNode> stringNode =
-                std::unique_ptr<StringNode>(dynamic_cast<StringNode*>(stringAtomizer.atomize().release()));
+            this->_stringAtomizer.setStream(this->_stream);
+            this->_stringAtomizer.setSymbols(this->_symbols);
+            this->_stringAtomizer.setArena(this->_arena);
             variableNode->setValue("");
-            variableNode->setStringNode(std::move(stringNode));
+            variableNode->setStringNode(static_cast<StringNode*>(this->_stringAtomizer.atomize()));
             variableNode->setType(VariableType::STRING);
             break;
         }
         case TokenType::TRUE:
         case TokenType::FALSE:
-            variableNode->setValue(std::string(this->_tokens[this->_current].value));
+            variableNode->setValue(this->_tokens[this->_current].value);
             variableNode->setType(VariableType::BOOL);
             break;
         case TokenType::NIL:
@@ -106,11 +114,11 @@ void VariableAtomizer::setVariableValueAndType(std::unique_ptr<VariableNode>& va
             variableNode->setType(VariableType::NIL);
             break;
         case TokenType::NUMBER:
-            variableNode->setValue(std::string(this->_tokens[this->_current].value));
-            variableNode->setType(VariableType::INT);
+            variableNode->setValue(this->_tokens[this->_current].value);
+            this->setNumber(variableNode, this->_tokens[this->_current]);
             break;
         case TokenType::IDENTIFIER:
-            variableNode->setValue(std::string(this->_tokens[this->_current].value));
+            variableNode->setValue(this->_tokens[this->_current].value);
             variableNode->setType(VariableType::UNKNOWN);
             break;
         default:
@@ -121,46 +129,74 @@ void VariableAtomizer::setVariableValueAndType(std::unique_ptr<VariableNode>& va
 }
 
 bool VariableAtomizer::shouldHandleAsOperation(TokenType currentType) {
-    OperationAtomizer opAtomizer(this->_current, this->_tokens);
-    bool              hasOperator =
-        this->_current + 1 < this->_tokens.size()
-        && (opAtomizer.canHandle(this->_tokens[this->_current + 1].type) || currentType == TokenType::LEFT_PAREN);
+    if (isPrefixOperator(currentType)) {
+        return true;
+    }
+
+    bool hasOperator = this->hasToken(this->_current + 1)
+                       && (isOperationToken(this->_tokens[this->_current + 1].type)
+                           || isPostfixOperator(this->_tokens[this->_current + 1].type)
+                           || currentType == TokenType::LEFT_PAREN);
 
-    return ((currentType == TokenType::LEFT_PAREN || currentType == TokenType::NUMBER) && hasOperator)
-           || (currentType == TokenType::IDENTIFIER && hasOperator);
+    return (currentType == TokenType::LEFT_PAREN || isOperand(currentType)) && hasOperator;
 }
 
-std::unique_ptr<NodeBase> VariableAtomizer::handleOperation(std::unique_ptr<VariableNode>& variableNode) {
-    OperationAtomizer opAtomizer(this->_current, this->_tokens);
+NodeBase* VariableAtomizer::handleOperation(VariableNode* variableNode) {
+    OperationAtomizer& opAtomizer = this->_operationAtomizer;
+    opAtomizer.setStream(this->_stream);
+    opAtomizer.setArena(this->_arena);
 
-    if (canParseAsOperation(opAtomizer)) {
-        std::unique_ptr<OperationNode> opNode = parseOperation(opAtomizer);
+    if (canParseAsOperation()) {
+        OperationNode* opNode = parseOperation(opAtomizer);
         if (opNode) {
-            variableNode->setOperation(std::move(opNode));
-            variableNode->setType(VariableType::INT);
-            return std::unique_ptr<NodeBase>(variableNode.release());
+            variableNode->setType(this->operationType(*opNode));
+            variableNode->setOperation(opNode);
+            return variableNode;
         }
     }
 
     return handleAsSimpleValue(variableNode);
 }
 
-bool VariableAtomizer::canParseAsOperation(const OperationAtomizer& opAtomizer) const {
-    return this->_tokens[this->_current].type == TokenType::LEFT_PAREN
-           || this->_tokens[this->_current].type == TokenType::NUMBER
-           || (this->_current + 1 < this->_tokens.size()
-               && opAtomizer.canHandle(this->_tokens[this->_current + 1].type));
+bool VariableAtomizer::canParseAsOperation() const {
+    TokenType currentType = this->_tokens[this->_current].type;
+    return currentType == TokenType::LEFT_PAREN || currentType == TokenType::NUMBER || isPrefixOperator(currentType)
+           || (this->hasToken(this->_current + 1)
+               && (isOperationToken(this->_tokens[this->_current + 1].type)
+                   || isPostfixOperator(this->_tokens[this->_current + 1].type)));
 }
 
-std::unique_ptr<OperationNode> VariableAtomizer::parseOperation(OperationAtomizer& opAtomizer) {
-    return std::unique_ptr<OperationNode>(dynamic_cast<OperationNode*>(opAtomizer.atomize().release()));
+OperationNode* VariableAtomizer::parseOperation(OperationAtomizer& opAtomizer) {
+    return static_cast<OperationNode*>(opAtomizer.atomize());
 }
 
-std::unique_ptr<NodeBase> VariableAtomizer::handleAsSimpleValue(std::unique_ptr<VariableNode>& variableNode) {
-    std::string variableValue = std::string(this->_tokens[this->_current].value);
-    variableNode->setValue(variableValue);
-    variableNode->setType(this->_tokens[this->_current].type == TokenType::NUMBER ? VariableType::INT
-                                                                                  : VariableType::UNKNOWN);
+NodeBase* VariableAtomizer::handleAsSimpleValue(VariableNode* variableNode) {
+    variableNode->setValue(this->_tokens[this->_current].value);
+    if (this->_tokens[this->_current].type == TokenType::NUMBER) {
+        this->setNumber(variableNode, this->_tokens[this->_current]);
+    } else {
+        variableNode->setType(VariableType::UNKNOWN);
+    }
     this->advance();
-    return std::unique_ptr<NodeBase>(variableNode.release());
+    return variableNode;
+}
+
+void VariableAtomizer::setNumber(VariableNode* variableNode, const Token& token) {
+    NumericLiteral number = this->numberLiteral(token);
+    variableNode->setNumber(number);
+    variableNode->setType(number.kind == NumericKind::FLOAT ? VariableType::FLOAT : VariableType::INT);
+}
+
+VariableType VariableAtomizer::operationType(const OperationNode& opNode) const {
+    const NodeBase* expression = opNode.getExpression();
+    if (expression && expression->getNodeType() != NodeType::OPERAND && isBooleanOperator(expression->getTokenType())) {
+        return VariableType::BOOL;
+    }
+
+    for (const Token& token : opNode.getTokens()) {
+        if (token.type == TokenType::NUMBER && this->numberLiteral(token).kind == NumericKind::FLOAT) {
+            return VariableType::FLOAT;
+        }
+    }
+    return VariableType::INT;
 }
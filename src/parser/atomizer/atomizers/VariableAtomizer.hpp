@@ -27,7 +27,8 @@
 #include "opal/parser/node/NodeFactory.hpp"
 #include "opal/parser/node/nodes/VariableNode.hpp"
 
-#include <memory>
+#include <array>
+#include <span>
 #include <vector>
 
 namespace opal {
@@ -40,6 +41,12 @@ namespace opal {
  * assignments, and operations involving variables in the Opal language.
  */
 class VariableAtomizer : public AtomizerBase {
+private:
+    static constexpr std::array<TokenType, 1> LEADING_TYPES = {TokenType::IDENTIFIER};
+
+    OperationAtomizer _operationAtomizer;  ///< Parses operations on the right of assignments, kept to reuse its buffers
+    StringAtomizer    _stringAtomizer;     ///< Parses strings on the right of assignments, kept to reuse its buffers
+
 public:
     /**
      * @brief Constructs a new Variable Atomizer object
@@ -55,33 +62,39 @@ public:
      */
     bool canHandle(TokenType type) const override;
 
+    /**
+     * @brief Gets the token types a construct handled by this atomizer can start with
+     * @return std::span<const TokenType> The leading token types of the construct
+     */
+    std::span<const TokenType> leadingTypes() const override;
+
     /**
      * @brief Converts a sequence of tokens into a variable node
-     * @return std::unique_ptr<NodeBase> A unique pointer to the created variable node
+     * @return NodeBase* The created variable node, owned by the arena of the atomizer
      */
-    std::unique_ptr<NodeBase> atomize() override;
+    NodeBase* atomize() override;
 
 private:
     /**
      * @brief Handles variable assignment operations
-     * @param variableNode Reference to the variable node being processed
-     * @return std::unique_ptr<NodeBase> The processed node after assignment
+     * @param variableNode The variable node being processed
+     * @return NodeBase* The processed node after assignment
      */
-    std::unique_ptr<NodeBase> handleAssignment(std::unique_ptr<VariableNode>& variableNode);
+    NodeBase* handleAssignment(VariableNode* variableNode);
 
     /**
      * @brief Handles operations involving variables
-     * @param variableNode Reference to the variable node being processed
-     * @return std::unique_ptr<NodeBase> The processed node after operation
+     * @param variableNode The variable node being processed
+     * @return NodeBase* The processed node after operation
      */
-    std::unique_ptr<NodeBase> handleOperation(std::unique_ptr<VariableNode>& variableNode);
+    NodeBase* handleOperation(VariableNode* variableNode);
 
     /**
      * @brief Sets the value and type of a variable node based on the current token
-     * @param variableNode Reference to the variable node being processed
+     * @param variableNode The variable node being processed
      * @param type The type of the current token
      */
-    void setVariableValueAndType(std::unique_ptr<VariableNode>& variableNode, TokenType type);
+    void setVariableValueAndType(VariableNode* variableNode, TokenType type);
 
     /**
      * @brief Determines if the current token should be handled as part of an operation
@@ -92,24 +105,37 @@ private:
 
     /**
      * @brief Check if the current token sequence can be parsed as an operation
-     * @param opAtomizer The operation atomizer to use for checking
      * @return bool True if the sequence can be parsed as an operation
      */
-    bool canParseAsOperation(const OperationAtomizer& opAtomizer) const;
+    bool canParseAsOperation() const;
 
     /**
      * @brief Parse the current token sequence as an operation
      * @param opAtomizer The operation atomizer to use for parsing
-     * @return std::unique_ptr<OperationNode> The parsed operation node
+     * @return OperationNode* The parsed operation node
      */
-    std::unique_ptr<OperationNode> parseOperation(OperationAtomizer& opAtomizer);
+    OperationNode* parseOperation(OperationAtomizer& opAtomizer);
 
     /**
      * @brief Handle the current token as a simple value assignment
-     * @param variableNode Reference to the variable node being processed
-     * @return std::unique_ptr<NodeBase> The processed node
+     * @param variableNode The variable node being processed
+     * @return NodeBase* The processed node
+     */
+    NodeBase* handleAsSimpleValue(VariableNode* variableNode);
+
+    /**
+     * @brief Stores the decoded value of a NUMBER token and types the variable after it
+     * @param variableNode The variable node being processed
+     * @param token The NUMBER token
+     */
+    void setNumber(VariableNode* variableNode, const Token& token);
+
+    /**
+     * @brief Determines the type of an operation from its root operator and number literals
+     * @param opNode The operation node
+     * @return VariableType BOOL for comparisons and logical operators, FLOAT if any literal is a float, INT otherwise
      */
-    std::unique_ptr<NodeBase> handleAsSimpleValue(std::unique_ptr<VariableNode>& variableNode);
+    VariableType operationType(const OperationNode& opNode) const;
 };
 
 }  // namespace opal
@@ -0,0 +1,522 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/flat/AstImage.hpp"
+
+#include "opal/lexer/TokenType.hpp"
+#include "opal/util/FileUtil.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+constexpr char     MAGIC[8]        = {'O', 'P', 'A', 'L', 'A', 'S', 'T', '\0'};
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr size_t   ALIGNMENT       = 8;
+
+/**
+ * @brief Sections of an image, in file order
+ */
+enum Section : uint32_t {
+    NODES,
+    CHILDREN,
+    ROOTS,
+    VARIABLES,
+    TOKENS,
+    RANGES,
+    SEGMENTS,
+    PATHS,
+    FUNCTIONS,
+    PARAMETERS,
+    LITERALS,
+    SYMBOLS,
+    STRINGS,
+    SECTION_COUNT
+};
+
+constexpr size_t RECORD_SIZES[SECTION_COUNT] = {
+    sizeof(AstImage::NodeRecord),
+    sizeof(uint32_t),
+    sizeof(uint32_t),
+    sizeof(AstImage::VariableRecord),
+    sizeof(AstImage::TokenRecord),
+    sizeof(FlatRange),
+    sizeof(AstImage::SegmentRecord),
+    sizeof(AstImage::StringRef),
+    sizeof(AstImage::FunctionRecord),
+    sizeof(AstImage::StringRef),
+    sizeof(NumericLiteral),
+    sizeof(AstImage::StringRef),
+    sizeof(char),
+};
+
+static_assert(sizeof(AstImage::NodeRecord) == 16 && sizeof(AstImage::TokenRecord) == 24
+                  && sizeof(AstImage::SegmentRecord) == 16 && sizeof(AstImage::VariableRecord) == 40
+                  && sizeof(AstImage::FunctionRecord) == 32,
+              "AST image records must keep their size, bump AstImage::FORMAT_VERSION when changing them");
+static_assert(std::is_trivially_copyable_v<NumericLiteral> && std::is_trivially_copyable_v<FlatRange>);
+
+/**
+ * @struct SectionEntry
+ * @brief Location of a section, relative to the start of the image
+ */
+struct SectionEntry {
+    uint64_t offset;
+    uint64_t count;  ///< Number of records, or of bytes for the string table
+};
+
+/**
+ * @struct FileHeader
+ * @brief Fixed header at the start of every image
+ */
+struct FileHeader {
+    char         magic[8];
+    uint32_t     version;
+    uint32_t     byteOrder;
+    uint64_t     fileSize;
+    uint32_t     sectionCount;
+    uint32_t     reserved;
+    SectionEntry sections[SECTION_COUNT];
+};
+
+size_t align(size_t offset) {
+    return (offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+template <typename T>
+std::span<const T> sectionOf(std::string_view bytes, const FileHeader& header, Section section) {
+    const SectionEntry& entry = header.sections[section];
+    return std::span<const T>(reinterpret_cast<const T*>(bytes.data() + entry.offset), entry.count);
+}
+
+/**
+ * @class StringTableBuilder
+ * @brief Collects the strings of an image, storing each distinct string once
+ */
+class StringTableBuilder {
+private:
+    std::unordered_map<std::string_view, AstImage::StringRef> _index;
+    std::string                                               _bytes;
+
+public:
+    AstImage::StringRef add(std::string_view text) {
+        auto found = this->_index.find(text);
+        if (found != this->_index.end()) {
+            return found->second;
+        }
+        if (this->_bytes.size() + text.size() > UINT32_MAX) {
+            throw std::runtime_error("AST image string table exceeds 4 GiB");
+        }
+
+        AstImage::StringRef ref = {static_cast<uint32_t>(this->_bytes.size()), static_cast<uint32_t>(text.size())};
+        this->_bytes.append(text);
+        this->_index.emplace(text, ref);
+        return ref;
+    }
+
+    const std::string& bytes() const { return this->_bytes; }
+};
+
+bool isValidSymbol(uint32_t symbol, size_t symbolCount) {
+    return symbol == SymbolTable::NO_SYMBOL || symbol < symbolCount;
+}
+
+bool isValidRange(const FlatRange& range, size_t size) {
+    return range.first <= size && range.count <= size - range.first;
+}
+
+}  // namespace
+
+std::string AstImage::serialize(const FlatAst& ast, const LiteralTable* literals, const SymbolTable* symbols) {
+    StringTableBuilder strings;
+    size_t             symbolCount = symbols ? symbols->size() : 0;
+
+    std::vector<NodeRecord> nodes;
+    nodes.reserve(ast._nodes.size());
+    for (const FlatNode& node : ast._nodes) {
+        nodes.push_back(NodeRecord{static_cast<uint8_t>(node.kind),
+                                   static_cast<uint8_t>(node.token),
+                                   0,
+                                   node.payload,
+                                   node.firstChild,
+                                   node.childCount});
+    }
+
+    std::vector<VariableRecord> variables;
+    variables.reserve(ast._variables.size());
+    for (const FlatVariable& variable : ast._variables) {
+        variables.push_back(VariableRecord{strings.add(variable.name),
+                                           strings.add(variable.value),
+                                           symbols ? variable.symbol : SymbolTable::NO_SYMBOL,
+                                           static_cast<uint8_t>(variable.type),
+                                           static_cast<uint8_t>(variable.isConstant),
+                                           0,
+                                           variable.number});
+    }
+
+    // Payloads are only kept when the table they index into is stored with them
+    std::vector<TokenRecord> tokens;
+    tokens.reserve(ast._tokens.size());
+    for (const Token& token : ast._tokens) {
+        bool keepPayload = (token.type == TokenType::NUMBER && literals != nullptr)
+                           || (token.type == TokenType::IDENTIFIER && symbols != nullptr);
+        tokens.push_back(TokenRecord{static_cast<uint8_t>(token.type),
+                                     {},
+                                     keepPayload ? token.payload : Token::NO_PAYLOAD,
+                                     strings.add(token.value),
+                                     token.line,
+                                     token.column});
+    }
+
+    std::vector<SegmentRecord> segments;
+    segments.reserve(ast._segments.size());
+    for (const StringSegment& segment : ast._segments) {
+        segments.push_back(SegmentRecord{static_cast<uint8_t>(segment.type),
+                                         {},
+                                         symbols ? segment.symbol : SymbolTable::NO_SYMBOL,
+                                         strings.add(segment.content)});
+    }
+
+    std::vector<StringRef> paths;
+    paths.reserve(ast._paths.size());
+    for (std::string_view path : ast._paths) {
+        paths.push_back(strings.add(path));
+    }
+
+    std::vector<FunctionRecord> functions;
+    functions.reserve(ast._functions.size());
+    for (const FlatFunction& function : ast._functions) {
+        functions.push_back(FunctionRecord{strings.add(function.name),
+                                           symbols ? function.symbol : SymbolTable::NO_SYMBOL,
+                                           static_cast<uint8_t>(function.isParsed),
+                                           {},
+                                           function.parameters,
+                                           function.body});
+    }
+
+    std::vector<StringRef> parameters;
+    parameters.reserve(ast._parameters.size());
+    for (std::string_view parameter : ast._parameters) {
+        parameters.push_back(strings.add(parameter));
+    }
+
+    std::vector<StringRef> names;
+    names.reserve(symbolCount);
+    for (uint32_t id = 0; id < symbolCount; id++) {
+        names.push_back(strings.add(symbols->name(id)));
+    }
+
+    const void* data[SECTION_COUNT] = {nodes.data(),
+                                       ast._children.data(),
+                                       ast._roots.data(),
+                                       variables.data(),
+                                       tokens.data(),
+                                       ast._ranges.data(),
+                                       segments.data(),
+                                       paths.data(),
+                                       functions.data(),
+                                       parameters.data(),
+                                       literals ? literals->data() : nullptr,
+                                       names.data(),
+                                       strings.bytes().data()};
+    size_t      counts[SECTION_COUNT] = {nodes.size(),
+                                         ast._children.size(),
+                                         ast._roots.size(),
+                                         variables.size(),
+                                         tokens.size(),
+                                         ast._ranges.size(),
+                                         segments.size(),
+                                         paths.size(),
+                                         functions.size(),
+                                         parameters.size(),
+                                         literals ? literals->size() : 0,
+                                         names.size(),
+                                         strings.bytes().size()};
+
+    FileHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version      = FORMAT_VERSION;
+    header.byteOrder    = BYTE_ORDER_MARK;
+    header.sectionCount = SECTION_COUNT;
+
+    size_t offset = align(sizeof(FileHeader));
+    for (uint32_t section = 0; section < SECTION_COUNT; section++) {
+        if (counts[section] > UINT32_MAX) {
+            throw std::runtime_error("AST image section exceeds 32-bit indices");
+        }
+        header.sections[section] = SectionEntry{offset, counts[section]};
+        offset                   = align(offset + counts[section] * RECORD_SIZES[section]);
+    }
+    header.fileSize = offset;
+
+    std::string content(offset, '\0');
+    std::memcpy(content.data(), &header, sizeof(header));
+    for (uint32_t section = 0; section < SECTION_COUNT; section++) {
+        if (counts[section] > 0) {
+            std::memcpy(content.data() + header.sections[section].offset,
+                        data[section],
+                        counts[section] * RECORD_SIZES[section]);
+        }
+    }
+    return content;
+}
+
+void AstImage::write(const std::string&  path,
+                     const FlatAst&      ast,
+                     const LiteralTable* literals,
+                     const SymbolTable*  symbols) {
+    std::string content = serialize(ast, literals, symbols);
+    std::string temp    = path + ".tmp";
+
+    std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+    if (!file.is_open() || !file.write(content.data(), static_cast<std::streamsize>(content.size()))) {
+        throw std::runtime_error("Could not write AST image: " + temp);
+    }
+    file.close();
+
+    std::error_code error;
+    std::filesystem::rename(temp, path, error);
+    if (error) {
+        std::filesystem::remove(temp, error);
+        throw std::runtime_error("Could not write AST image: " + path);
+    }
+}
+
+std::string AstImage::validate(std::string_view bytes) {
+    if (bytes.size() < sizeof(FileHeader)) {
+        return "image is smaller than its header";
+    }
+    if (reinterpret_cast<uintptr_t>(bytes.data()) % ALIGNMENT != 0) {
+        return "image does not start at an 8-byte aligned address";
+    }
+
+    FileHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        return "not an AST image";
+    }
+    if (header.version != FORMAT_VERSION) {
+        return "unsupported format version " + std::to_string(header.version);
+    }
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        return "image was written with another byte order";
+    }
+    if (header.fileSize != bytes.size() || header.sectionCount != SECTION_COUNT) {
+        return "image size or section count does not match its header";
+    }
+
+    for (uint32_t section = 0; section < SECTION_COUNT; section++) {
+        const SectionEntry& entry = header.sections[section];
+        if (entry.offset % ALIGNMENT != 0 || entry.offset < sizeof(FileHeader) || entry.offset > bytes.size()
+            || entry.count > UINT32_MAX || entry.count > (bytes.size() - entry.offset) / RECORD_SIZES[section]) {
+            return "section " + std::to_string(section) + " lies outside the image";
+        }
+    }
+
+    auto nodes      = sectionOf<NodeRecord>(bytes, header, NODES);
+    auto children   = sectionOf<uint32_t>(bytes, header, CHILDREN);
+    auto roots      = sectionOf<uint32_t>(bytes, header, ROOTS);
+    auto variables  = sectionOf<VariableRecord>(bytes, header, VARIABLES);
+    auto tokens     = sectionOf<TokenRecord>(bytes, header, TOKENS);
+    auto ranges     = sectionOf<FlatRange>(bytes, header, RANGES);
+    auto segments   = sectionOf<SegmentRecord>(bytes, header, SEGMENTS);
+    auto paths      = sectionOf<StringRef>(bytes, header, PATHS);
+    auto functions  = sectionOf<FunctionRecord>(bytes, header, FUNCTIONS);
+    auto parameters = sectionOf<StringRef>(bytes, header, PARAMETERS);
+    auto literals   = sectionOf<NumericLiteral>(bytes, header, LITERALS);
+    auto symbols    = sectionOf<StringRef>(bytes, header, SYMBOLS);
+    auto strings    = header.sections[STRINGS].count;
+
+    auto fits = [strings](StringRef ref) { return ref.offset <= strings && ref.length <= strings - ref.offset; };
+
+    for (const StringRef& ref : paths) {
+        if (!fits(ref)) {
+            return "path lies outside the string table";
+        }
+    }
+    for (const StringRef& ref : parameters) {
+        if (!fits(ref)) {
+            return "parameter lies outside the string table";
+        }
+    }
+    for (const StringRef& ref : symbols) {
+        if (!fits(ref)) {
+            return "symbol lies outside the string table";
+        }
+    }
+    for (const NumericLiteral& literal : literals) {
+        if (literal.kind != NumericKind::INT && literal.kind != NumericKind::FLOAT) {
+            return "literal has an unknown kind";
+        }
+    }
+    for (const VariableRecord& variable : variables) {
+        if (!fits(variable.name) || !fits(variable.value)) {
+            return "variable lies outside the string table";
+        }
+        if (variable.type > static_cast<uint8_t>(VariableType::NIL) || variable.isConstant > 1
+            || !isValidSymbol(variable.symbol, symbols.size())
+            || (variable.number.kind != NumericKind::INT && variable.number.kind != NumericKind::FLOAT)) {
+            return "variable has an invalid type, flag or symbol";
+        }
+    }
+    for (const TokenRecord& token : tokens) {
+        auto type = static_cast<TokenType>(token.type);
+        if (token.type >= static_cast<uint8_t>(TokenType::ERROR) || !fits(token.value)) {
+            return "token has an unknown type or lies outside the string table";
+        }
+        bool validPayload = token.payload == Token::NO_PAYLOAD
+                            || (type == TokenType::NUMBER && token.payload < literals.size())
+                            || (type == TokenType::IDENTIFIER && token.payload < symbols.size());
+        if (!validPayload) {
+            return "token payload is out of range";
+        }
+    }
+    for (const FunctionRecord& function : functions) {
+        if (!fits(function.name) || function.isParsed > 1 || !isValidSymbol(function.symbol, symbols.size())
+            || !isValidRange(function.parameters, parameters.size()) || !isValidRange(function.body, tokens.size())) {
+            return "function is invalid";
+        }
+    }
+    for (const SegmentRecord& segment : segments) {
+        if (segment.type > static_cast<uint8_t>(StringSegmentType::VARIABLE) || !fits(segment.content)
+            || !isValidSymbol(segment.symbol, symbols.size())) {
+            return "string segment is invalid";
+        }
+    }
+
+    // Children always follow their parent, so a walk from the roots visits every node once and ends
+    std::vector<uint8_t> reached(nodes.size(), 0);
+    auto                 reach = [&reached](uint32_t id) {
+        if (id >= reached.size() || reached[id]) {
+            return false;
+        }
+        reached[id] = 1;
+        return true;
+    };
+
+    for (uint32_t root : roots) {
+        if (!reach(root)) {
+            return "root " + std::to_string(root) + " is out of range or reached twice";
+        }
+    }
+
+    for (uint32_t id = 0; id < nodes.size(); id++) {
+        const NodeRecord& node = nodes[id];
+        auto              at   = [id] { return "node " + std::to_string(id); };
+        if (node.kind > static_cast<uint8_t>(NodeType::CALL) || node.token > static_cast<uint8_t>(TokenType::ERROR)) {
+            return at() + " has an unknown kind or token type";
+        }
+        if (!reached[id]) {
+            return at() + " is not reachable from the roots";
+        }
+        if (!isValidRange(FlatRange{node.firstChild, node.childCount}, children.size())) {
+            return at() + " has children outside the child array";
+        }
+        for (uint32_t child : children.subspan(node.firstChild, node.childCount)) {
+            if (child <= id || !reach(child)) {
+                return at() + " has child " + std::to_string(child) + " out of order or reached twice";
+            }
+        }
+
+        bool validPayload = true;
+        switch (static_cast<NodeType>(node.kind)) {
+            case NodeType::VARIABLE:
+                validPayload = node.payload < variables.size();
+                break;
+            case NodeType::OPERATION:
+                validPayload = node.payload < ranges.size() && isValidRange(ranges[node.payload], tokens.size());
+                break;
+            case NodeType::OPERAND:
+                validPayload = node.payload < tokens.size();
+                break;
+            case NodeType::FUNCTION:
+                // Only a parsed body has statements
+                validPayload = node.payload < functions.size()
+                               && (functions[node.payload].isParsed == 1 || node.childCount == 0);
+                break;
+            case NodeType::UNARY:
+                validPayload = node.payload <= 1;
+                break;
+            case NodeType::STRING:
+                validPayload = node.payload < ranges.size() && isValidRange(ranges[node.payload], segments.size());
+                break;
+            case NodeType::BASE:
+                validPayload = node.token != static_cast<uint8_t>(TokenType::LOAD) || node.payload < paths.size();
+                break;
+            default:
+                break;
+        }
+        if (!validPayload) {
+            return at() + " has a payload out of range";
+        }
+    }
+
+    return "";
+}
+
+AstImage AstImage::open(const std::string& path) {
+    MappedFile  file  = FileUtil::mapFile(path);
+    std::string error = validate(file.view());
+    if (!error.empty()) {
+        throw std::runtime_error("Invalid AST image " + path + ": " + error);
+    }
+
+    AstImage image;
+    image._file  = std::move(file);
+    image._bytes = image._file.view();
+    image.attach();
+    return image;
+}
+
+AstImage::AstImage(std::string_view bytes) : _bytes(bytes) {
+    std::string error = validate(bytes);
+    if (!error.empty()) {
+        throw std::runtime_error("Invalid AST image: " + error);
+    }
+    this->attach();
+}
+
+void AstImage::attach() {
+    FileHeader header;
+    std::memcpy(&header, this->_bytes.data(), sizeof(header));
+
+    this->_nodes      = sectionOf<NodeRecord>(this->_bytes, header, NODES);
+    this->_children   = sectionOf<uint32_t>(this->_bytes, header, CHILDREN);
+    this->_roots      = sectionOf<uint32_t>(this->_bytes, header, ROOTS);
+    this->_variables  = sectionOf<VariableRecord>(this->_bytes, header, VARIABLES);
+    this->_tokens     = sectionOf<TokenRecord>(this->_bytes, header, TOKENS);
+    this->_ranges     = sectionOf<FlatRange>(this->_bytes, header, RANGES);
+    this->_segments   = sectionOf<SegmentRecord>(this->_bytes, header, SEGMENTS);
+    this->_paths      = sectionOf<StringRef>(this->_bytes, header, PATHS);
+    this->_functions  = sectionOf<FunctionRecord>(this->_bytes, header, FUNCTIONS);
+    this->_parameters = sectionOf<StringRef>(this->_bytes, header, PARAMETERS);
+    this->_literals   = sectionOf<NumericLiteral>(this->_bytes, header, LITERALS);
+    this->_symbols    = sectionOf<StringRef>(this->_bytes, header, SYMBOLS);
+    this->_strings    = this->_bytes.substr(header.sections[STRINGS].offset, header.sections[STRINGS].count);
+}
@@ -0,0 +1,372 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
+#include "opal/parser/flat/FlatAst.hpp"
+#include "opal/util/MappedFile.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace opal {
+
+/**
+ * @class AstImage
+ * @brief Binary image of a FlatAst that is used in place, straight from a memory mapping
+ *
+ * The image holds the arrays of a FlatAst as fixed-width records, each section
+ * aligned to 8 bytes and located through a table in the header. Strings are
+ * stored once in a string table and referred to by offset and length, and
+ * every other reference is an index into a section, so the image holds no
+ * pointers and can be mapped at any address. The literal and symbol tables the
+ * token payloads index into are stored along with the tree, so an image needs
+ * neither the source nor the lexer it came from.
+ *
+ * Opening an image validates every index and string reference once, after
+ * which the accessors read the mapping without further checks, like those of
+ * FlatAst. Nodes carry their kind and a payload index like FlatNode, so a new
+ * node kind only adds a section for its payload and bumps FORMAT_VERSION.
+ */
+class AstImage {
+public:
+    /**
+     * @brief Version of the file layout, bumped whenever it or the node payloads change
+     */
+    static constexpr uint32_t FORMAT_VERSION = 2;
+
+    /**
+     * @brief Extension of image files
+     */
+    static constexpr std::string_view EXTENSION = ".opast";
+
+    /**
+     * @struct StringRef
+     * @brief A string of the string table
+     */
+    struct StringRef {
+        uint32_t offset;  ///< Start of the string, relative to the string table
+        uint32_t length;
+    };
+
+    /**
+     * @struct NodeRecord
+     * @brief A node, with the payload and children of a FlatNode
+     */
+    struct NodeRecord {
+        uint8_t  kind;   ///< The NodeType of the node
+        uint8_t  token;  ///< The TokenType of the node
+        uint16_t reserved;
+        uint32_t payload;
+        uint32_t firstChild;
+        uint32_t childCount;
+    };
+
+    /**
+     * @struct VariableRecord
+     * @brief Payload of a VARIABLE node
+     */
+    struct VariableRecord {
+        StringRef      name;
+        StringRef      value;
+        uint32_t       symbol;
+        uint8_t        type;  ///< The VariableType of the variable
+        uint8_t        isConstant;
+        uint16_t       reserved;
+        NumericLiteral number;
+    };
+
+    /**
+     * @struct TokenRecord
+     * @brief A token of an operation, with its lexeme in the string table
+     */
+    struct TokenRecord {
+        uint8_t   type;  ///< The TokenType of the token
+        uint8_t   reserved[3];
+        uint32_t  payload;
+        StringRef value;
+        int32_t   line;
+        int32_t   column;
+    };
+
+    /**
+     * @struct SegmentRecord
+     * @brief A segment of a STRING node
+     */
+    struct SegmentRecord {
+        uint8_t   type;  ///< The StringSegmentType of the segment
+        uint8_t   reserved[3];
+        uint32_t  symbol;
+        StringRef content;
+    };
+
+    /**
+     * @struct FunctionRecord
+     * @brief Payload of a FUNCTION node
+     */
+    struct FunctionRecord {
+        StringRef name;
+        uint32_t  symbol;
+        uint8_t   isParsed;
+        uint8_t   reserved[3];
+        FlatRange parameters;  ///< Range of the parameter names in their section
+        FlatRange body;        ///< Range of the body tokens in the token section, ending with the closing brace
+    };
+
+private:
+    MappedFile                      _file;
+    std::string_view                _bytes;
+    std::span<const NodeRecord>     _nodes;
+    std::span<const uint32_t>       _children;
+    std::span<const uint32_t>       _roots;
+    std::span<const VariableRecord> _variables;
+    std::span<const TokenRecord>    _tokens;
+    std::span<const FlatRange>      _ranges;
+    std::span<const SegmentRecord>  _segments;
+    std::span<const StringRef>      _paths;
+    std::span<const FunctionRecord> _functions;
+    std::span<const StringRef>      _parameters;
+    std::span<const NumericLiteral> _literals;
+    std::span<const StringRef>      _symbols;
+    std::string_view                _strings;
+
+    /**
+     * @brief Points the sections at an image that passed validation
+     */
+    void attach();
+
+public:
+    /**
+     * @brief Serializes a tree into an image
+     * @param ast The tree
+     * @param literals The literals the payloads of NUMBER tokens index into, or nullptr to drop those payloads
+     * @param symbols The symbols the ids of the tree index into, or nullptr to drop the ids
+     * @return std::string The bytes of the image
+     * @throws std::runtime_error If a section or the string table outgrows 32-bit offsets
+     */
+    static std::string serialize(const FlatAst&      ast,
+                                 const LiteralTable* literals = nullptr,
+                                 const SymbolTable*  symbols  = nullptr);
+
+    /**
+     * @brief Writes the image of a tree to a file
+     *
+     * The file is written next to its final path and renamed over it, so
+     * concurrent readers never map a partial image.
+     *
+     * @param path The path of the image file
+     * @param ast The tree
+     * @param literals The literals the payloads of NUMBER tokens index into, or nullptr to drop those payloads
+     * @param symbols The symbols the ids of the tree index into, or nullptr to drop the ids
+     * @throws std::runtime_error If the file cannot be written
+     */
+    static void write(const std::string&  path,
+                      const FlatAst&      ast,
+                      const LiteralTable* literals = nullptr,
+                      const SymbolTable*  symbols  = nullptr);
+
+    /**
+     * @brief Checks that bytes hold a well-formed image of the current format version
+     *
+     * Beyond the header, checks that every section lies inside the bytes, that
+     * every index and string reference lies inside its section, and that every
+     * node is reached exactly once from the roots through children with higher
+     * ids, so walking the tree always ends.
+     *
+     * @param bytes The bytes, starting at an 8-byte aligned address
+     * @return std::string The first problem found, or an empty string for a valid image
+     */
+    static std::string validate(std::string_view bytes);
+
+    /**
+     * @brief Maps and validates an image file
+     * @param path The path of the image file
+     * @return AstImage The image, reading the mapping in place
+     * @throws std::runtime_error If the file cannot be mapped or is not a valid image
+     */
+    static AstImage open(const std::string& path);
+
+    /**
+     * @brief Constructs an empty AstImage object
+     */
+    AstImage() = default;
+
+    /**
+     * @brief Validates and views an image held in memory
+     * @param bytes The bytes of the image, which must outlive it and start at an 8-byte aligned address
+     * @throws std::runtime_error If the bytes are not a valid image
+     */
+    explicit AstImage(std::string_view bytes);
+
+    AstImage(const AstImage&)            = delete;
+    AstImage& operator=(const AstImage&) = delete;
+    AstImage(AstImage&&)                 = default;
+    AstImage& operator=(AstImage&&)      = default;
+
+    /**
+     * @brief Gets the number of nodes
+     * @return size_t The number of nodes of all the trees
+     */
+    size_t size() const { return this->_nodes.size(); }
+
+    /**
+     * @brief Gets the size of the image
+     * @return size_t The number of bytes
+     */
+    size_t bytesUsed() const { return this->_bytes.size(); }
+
+    /**
+     * @brief Gets a node
+     * @param id The index of the node
+     * @return const NodeRecord& The node
+     */
+    const NodeRecord& node(uint32_t id) const { return this->_nodes[id]; }
+
+    /**
+     * @brief Gets the kind of a node
+     * @param id The index of the node
+     * @return NodeType The kind
+     */
+    NodeType kind(uint32_t id) const { return static_cast<NodeType>(this->_nodes[id].kind); }
+
+    /**
+     * @brief Gets the top-level nodes in source order
+     * @return std::span<const uint32_t> The indices of the roots
+     */
+    std::span<const uint32_t> roots() const { return this->_roots; }
+
+    /**
+     * @brief Gets the children of a node
+     * @param id The index of the node
+     * @return std::span<const uint32_t> The indices of its children in order
+     */
+    std::span<const uint32_t> children(uint32_t id) const {
+        const NodeRecord& node = this->_nodes[id];
+        return this->_children.subspan(node.firstChild, node.childCount);
+    }
+
+    /**
+     * @brief Gets a string of the string table
+     * @param ref The reference to the string
+     * @return std::string_view The string, viewing the image
+     */
+    std::string_view string(StringRef ref) const { return this->_strings.substr(ref.offset, ref.length); }
+
+    /**
+     * @brief Gets the payload of a VARIABLE node
+     * @param id The index of the node
+     * @return const VariableRecord& Its name, value and type
+     */
+    const VariableRecord& variable(uint32_t id) const { return this->_variables[this->_nodes[id].payload]; }
+
+    /**
+     * @brief Gets the token of an OPERAND node
+     * @param id The index of the node
+     * @return const TokenRecord& The literal or identifier token
+     */
+    const TokenRecord& operand(uint32_t id) const { return this->_tokens[this->_nodes[id].payload]; }
+
+    /**
+     * @brief Gets the tokens of an OPERATION node
+     * @param id The index of the node
+     * @return std::span<const TokenRecord> The tokens in source order
+     */
+    std::span<const TokenRecord> tokens(uint32_t id) const {
+        const FlatRange& range = this->_ranges[this->_nodes[id].payload];
+        return this->_tokens.subspan(range.first, range.count);
+    }
+
+    /**
+     * @brief Gets the segments of a STRING node
+     * @param id The index of the node
+     * @return std::span<const SegmentRecord> The text and variable segments in order
+     */
+    std::span<const SegmentRecord> segments(uint32_t id) const {
+        const FlatRange& range = this->_ranges[this->_nodes[id].payload];
+        return this->_segments.subspan(range.first, range.count);
+    }
+
+    /**
+     * @brief Gets the path of a load node
+     * @param id The index of the node
+     * @return std::string_view The path of the loaded file
+     */
+    std::string_view path(uint32_t id) const { return this->string(this->_paths[this->_nodes[id].payload]); }
+
+    /**
+     * @brief Gets the payload of a FUNCTION node
+     * @param id The index of the node
+     * @return const FunctionRecord& Its name, parameters and body
+     */
+    const FunctionRecord& function(uint32_t id) const { return this->_functions[this->_nodes[id].payload]; }
+
+    /**
+     * @brief Gets the parameter names of a FUNCTION node
+     * @param id The index of the node
+     * @return std::span<const StringRef> The names in order
+     */
+    std::span<const StringRef> parameters(uint32_t id) const {
+        const FlatRange& range = this->function(id).parameters;
+        return this->_parameters.subspan(range.first, range.count);
+    }
+
+    /**
+     * @brief Gets the body tokens of a FUNCTION node
+     * @param id The index of the node
+     * @return std::span<const TokenRecord> The tokens after the opening brace, ending with the closing one
+     */
+    std::span<const TokenRecord> body(uint32_t id) const {
+        const FlatRange& range = this->function(id).body;
+        return this->_tokens.subspan(range.first, range.count);
+    }
+
+    /**
+     * @brief Checks if a UNARY node is a postfix operator
+     * @param id The index of the node
+     * @return bool True for postfix increment and decrement, false otherwise
+     */
+    bool isPostfix(uint32_t id) const { return this->_nodes[id].payload == 1; }
+
+    /**
+     * @brief Gets the literals the payloads of NUMBER tokens index into
+     * @return std::span<const NumericLiteral> The literals, empty if none were stored
+     */
+    std::span<const NumericLiteral> literals() const { return this->_literals; }
+
+    /**
+     * @brief Gets the name of a symbol
+     * @param id A symbol id of a variable, segment or IDENTIFIER token of the image
+     * @return std::string_view The name
+     */
+    std::string_view symbol(uint32_t id) const { return this->string(this->_symbols[id]); }
+
+    /**
+     * @brief Gets the number of symbols
+     * @return size_t The number of names the symbol ids index into
+     */
+    size_t symbolCount() const { return this->_symbols.size(); }
+};
+
+}  // namespace opal
@@ -0,0 +1,94 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/flat/FlatAst.hpp"
+
+#include "opal/parser/flat/FlatAstVisitor.hpp"
+
+#include <span>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+// Marks the stack entries of nodes whose children were all visited
+constexpr uint32_t LEAVE_BIT = 0x80000000u;
+
+template <typename T>
+size_t arrayBytes(const std::vector<T>& items) {
+    return items.size() * sizeof(T);
+}
+
+}  // namespace
+
+std::span<const Token> FlatAst::tokens(uint32_t id) const {
+    const FlatRange& range = this->_ranges[this->_nodes[id].payload];
+    return std::span<const Token>(this->_tokens).subspan(range.first, range.count);
+}
+
+std::span<const StringSegment> FlatAst::segments(uint32_t id) const {
+    const FlatRange& range = this->_ranges[this->_nodes[id].payload];
+    return std::span<const StringSegment>(this->_segments).subspan(range.first, range.count);
+}
+
+std::span<const std::string_view> FlatAst::parameters(uint32_t id) const {
+    const FlatRange& range = this->_functions[this->_nodes[id].payload].parameters;
+    return std::span<const std::string_view>(this->_parameters).subspan(range.first, range.count);
+}
+
+std::span<const Token> FlatAst::body(uint32_t id) const {
+    const FlatRange& range = this->_functions[this->_nodes[id].payload].body;
+    return std::span<const Token>(this->_tokens).subspan(range.first, range.count);
+}
+
+void FlatAst::walk(FlatAstVisitor& visitor) const {
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    for (size_t i = this->_roots.size(); i > 0; i--) {
+        stack.push_back(this->_roots[i - 1]);
+    }
+
+    while (!stack.empty()) {
+        uint32_t entry = stack.back();
+        stack.pop_back();
+
+        if (entry & LEAVE_BIT) {
+            visitor.leave(*this, entry & ~LEAVE_BIT);
+            continue;
+        }
+
+        stack.push_back(entry | LEAVE_BIT);
+        if (visitor.enter(*this, entry)) {
+            const FlatNode& node = this->_nodes[entry];
+            for (uint32_t i = node.childCount; i > 0; i--) {
+                stack.push_back(this->_children[node.firstChild + i - 1]);
+            }
+        }
+    }
+}
+
+size_t FlatAst::bytesUsed() const {
+    return arrayBytes(this->_nodes) + arrayBytes(this->_children) + arrayBytes(this->_roots)
+           + arrayBytes(this->_variables) + arrayBytes(this->_tokens) + arrayBytes(this->_ranges)
+           + arrayBytes(this->_segments) + arrayBytes(this->_paths) + arrayBytes(this->_functions)
+           + arrayBytes(this->_parameters) + this->_strings.bytesUsed();
+}
@@ -0,0 +1,248 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/AstArena.hpp"
+#include "opal/parser/atomizer/VariableType.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+#include "opal/parser/node/nodes/StringNode.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace opal {
+
+class FlatAstVisitor;
+
+/**
+ * @struct FlatNode
+ * @brief A node of a FlatAst, addressed by its index
+ *
+ * The meaning of the payload depends on the kind of the node:
+ * - VARIABLE: index of its FlatVariable, children are its operation and string nodes
+ * - OPERATION: index of the range of its tokens, the only child is its expression
+ * - FUNCTION: index of its FlatFunction, children are the statements of its body once parsed
+ * - OPERAND: index of its token
+ * - UNARY: 1 for a postfix operator and 0 for a prefix one, the only child is the operand
+ * - BINARY: unused, children are the left and right operands
+ * - CALL: unused, children are the callee followed by the arguments
+ * - STRING: index of the range of its segments
+ * - BASE with a LOAD token: index of its path
+ */
+struct FlatNode {
+    NodeType  kind;
+    TokenType token;
+    uint32_t  payload;
+    uint32_t  firstChild;  ///< Start of the children of the node in the child index array
+    uint32_t  childCount;
+};
+
+/**
+ * @struct FlatVariable
+ * @brief Payload of a VARIABLE node
+ */
+struct FlatVariable {
+    std::string_view name;
+    std::string_view value;
+    uint32_t         symbol;
+    VariableType     type;
+    bool             isConstant;
+    NumericLiteral   number;
+};
+
+/**
+ * @struct FlatRange
+ * @brief A range of entries in one of the side arrays of a FlatAst
+ */
+struct FlatRange {
+    uint32_t first;
+    uint32_t count;
+};
+
+/**
+ * @struct FlatFunction
+ * @brief Payload of a FUNCTION node
+ *
+ * The tokens of the body are kept whether it was parsed or not, so a function
+ * that was only pre-parsed can still be parsed from the flat tree.
+ */
+struct FlatFunction {
+    std::string_view name;
+    uint32_t         symbol;
+    FlatRange        parameters;  ///< Range of the parameter names
+    FlatRange        body;        ///< Range of the body tokens, ending with the closing brace
+    bool             isParsed;
+};
+
+/**
+ * @class FlatAst
+ * @brief Index-based representation of a parsed program
+ *
+ * Nodes live in one contiguous array in pre-order, so a whole program can be
+ * scanned linearly and every subtree is a node followed by its descendants.
+ * Children are stored as ranges of 32-bit indices and payloads in typed side
+ * arrays, so walking the tree follows no pointers. Names, values, segments and
+ * paths are copied into storage owned by the FlatAst, while the lexemes of
+ * tokens keep viewing the source like they do in the pointer tree.
+ * Built from a parsed tree by FlatAstConverter.
+ */
+class FlatAst {
+public:
+    static constexpr uint32_t NO_PAYLOAD = UINT32_MAX;
+
+private:
+    std::vector<FlatNode>         _nodes;
+    std::vector<uint32_t>         _children;
+    std::vector<uint32_t>         _roots;
+    std::vector<FlatVariable>     _variables;
+    std::vector<Token>            _tokens;
+    std::vector<FlatRange>        _ranges;
+    std::vector<StringSegment>    _segments;
+    std::vector<std::string_view> _paths;
+    std::vector<FlatFunction>     _functions;
+    std::vector<std::string_view> _parameters;
+    AstArena                      _strings;
+
+    friend class AstImage;
+    friend class FlatAstConverter;
+
+public:
+    /**
+     * @brief Gets the number of nodes
+     * @return size_t The number of nodes of all the trees
+     */
+    size_t size() const { return this->_nodes.size(); }
+
+    /**
+     * @brief Gets every node in pre-order
+     * @return std::span<const FlatNode> The nodes, indexed by their id
+     */
+    std::span<const FlatNode> nodes() const { return this->_nodes; }
+
+    /**
+     * @brief Gets a node
+     * @param id The index of the node
+     * @return const FlatNode& The node
+     */
+    const FlatNode& node(uint32_t id) const { return this->_nodes[id]; }
+
+    /**
+     * @brief Gets the top-level nodes in source order
+     * @return std::span<const uint32_t> The indices of the roots
+     */
+    std::span<const uint32_t> roots() const { return this->_roots; }
+
+    /**
+     * @brief Gets the children of a node
+     * @param id The index of the node
+     * @return std::span<const uint32_t> The indices of its children in order
+     */
+    std::span<const uint32_t> children(uint32_t id) const {
+        const FlatNode& node = this->_nodes[id];
+        return std::span<const uint32_t>(this->_children).subspan(node.firstChild, node.childCount);
+    }
+
+    /**
+     * @brief Gets the payload of a VARIABLE node
+     * @param id The index of the node
+     * @return const FlatVariable& Its name, value and type
+     */
+    const FlatVariable& variable(uint32_t id) const { return this->_variables[this->_nodes[id].payload]; }
+
+    /**
+     * @brief Gets the token of an OPERAND node
+     * @param id The index of the node
+     * @return const Token& The literal or identifier token
+     */
+    const Token& operand(uint32_t id) const { return this->_tokens[this->_nodes[id].payload]; }
+
+    /**
+     * @brief Gets the tokens of an OPERATION node
+     * @param id The index of the node
+     * @return std::span<const Token> The tokens in source order
+     */
+    std::span<const Token> tokens(uint32_t id) const;
+
+    /**
+     * @brief Gets the segments of a STRING node
+     * @param id The index of the node
+     * @return std::span<const StringSegment> The text and variable segments in order
+     */
+    std::span<const StringSegment> segments(uint32_t id) const;
+
+    /**
+     * @brief Gets the path of a load node
+     * @param id The index of the node
+     * @return std::string_view The path of the loaded file
+     */
+    std::string_view path(uint32_t id) const { return this->_paths[this->_nodes[id].payload]; }
+
+    /**
+     * @brief Gets the payload of a FUNCTION node
+     * @param id The index of the node
+     * @return const FlatFunction& Its name, parameters and body
+     */
+    const FlatFunction& function(uint32_t id) const { return this->_functions[this->_nodes[id].payload]; }
+
+    /**
+     * @brief Gets the parameter names of a FUNCTION node
+     * @param id The index of the node
+     * @return std::span<const std::string_view> The names in order
+     */
+    std::span<const std::string_view> parameters(uint32_t id) const;
+
+    /**
+     * @brief Gets the body tokens of a FUNCTION node
+     * @param id The index of the node
+     * @return std::span<const Token> The tokens after the opening brace, ending with the closing one
+     */
+    std::span<const Token> body(uint32_t id) const;
+
+    /**
+     * @brief Checks if a UNARY node is a postfix operator
+     * @param id The index of the node
+     * @return bool True for postfix increment and decrement, false otherwise
+     */
+    bool isPostfix(uint32_t id) const { return this->_nodes[id].payload == 1; }
+
+    /**
+     * @brief Walks every tree depth-first, in source order
+     *
+     * Uses an explicit stack, so deep trees do not grow the call stack.
+     *
+     * @param visitor The visitor notified when entering and leaving each node
+     */
+    void walk(FlatAstVisitor& visitor) const;
+
+    /**
+     * @brief Gets the memory taken by the representation
+     * @return size_t The bytes of the nodes, side arrays and copied strings, like AstArena::bytesUsed for the tree
+     */
+    size_t bytesUsed() const;
+};
+
+}  // namespace opal
@@ -0,0 +1,210 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/flat/FlatAstConverter.hpp"
+
+#include "opal/parser/node/nodes/BinaryNode.hpp"
+#include "opal/parser/node/nodes/CallNode.hpp"
+#include "opal/parser/node/nodes/FunctionNode.hpp"
+#include "opal/parser/node/nodes/LoadNode.hpp"
+#include "opal/parser/node/nodes/OperandNode.hpp"
+#include "opal/parser/node/nodes/OperationNode.hpp"
+#include "opal/parser/node/nodes/StringNode.hpp"
+#include "opal/parser/node/nodes/UnaryNode.hpp"
+#include "opal/parser/node/nodes/VariableNode.hpp"
+
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace opal;
+
+namespace {
+
+// Ids of the flat tree keep their top bit free for FlatAst::walk
+constexpr size_t MAX_NODES = 0x80000000u;
+
+// Slot of a root, whose id goes to the root list instead of a child range
+constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+}  // namespace
+
+FlatAst FlatAstConverter::convert(std::span<NodeBase* const> roots) {
+    FlatAst ast;
+    Context context;
+
+    ast._roots.reserve(roots.size());
+    for (const NodeBase* root : roots) {
+        ast._roots.push_back(convertTree(ast, root, context));
+    }
+    return ast;
+}
+
+uint32_t FlatAstConverter::convertTree(FlatAst& ast, const NodeBase* root, Context& context) {
+    std::vector<Pending>& pending = context.pending;
+    uint32_t              rootId  = static_cast<uint32_t>(ast._nodes.size());
+    pending.push_back(Pending{root, NO_SLOT});
+
+    while (!pending.empty()) {
+        Pending next = pending.back();
+        pending.pop_back();
+
+        if (ast._nodes.size() >= MAX_NODES) {
+            throw std::runtime_error("Too many nodes for a flat tree");
+        }
+
+        // Popping children in source order keeps ids, payloads and operand matching in pre-order
+        const NodeBase* node = next.node;
+        uint32_t        id   = static_cast<uint32_t>(ast._nodes.size());
+        ast._nodes.push_back(FlatNode{node->getNodeType(), node->getTokenType(), payloadOf(ast, node, context), 0, 0});
+        if (next.slot != NO_SLOT) {
+            ast._children[next.slot] = id;
+        }
+
+        childrenOf(node, context.children);
+        FlatNode& flat  = ast._nodes[id];
+        flat.firstChild = static_cast<uint32_t>(ast._children.size());
+        flat.childCount = static_cast<uint32_t>(context.children.size());
+        ast._children.resize(ast._children.size() + context.children.size());
+        for (size_t i = context.children.size(); i > 0; i--) {
+            pending.push_back(Pending{context.children[i - 1], flat.firstChild + static_cast<uint32_t>(i - 1)});
+        }
+    }
+    return rootId;
+}
+
+uint32_t FlatAstConverter::payloadOf(FlatAst& ast, const NodeBase* node, Context& context) {
+    switch (node->getNodeType()) {
+        case NodeType::VARIABLE: {
+            const auto* variable = static_cast<const VariableNode*>(node);
+            ast._variables.push_back(FlatVariable{ast._strings.copyString(variable->getName()),
+                                                  ast._strings.copyString(variable->getValue()),
+                                                  variable->getSymbol(),
+                                                  variable->getType(),
+                                                  variable->getIsConstant(),
+                                                  variable->getNumber()});
+            return static_cast<uint32_t>(ast._variables.size() - 1);
+        }
+        case NodeType::OPERATION: {
+            std::span<const Token> tokens = static_cast<const OperationNode*>(node)->getTokens();
+            ast._ranges.push_back(
+                FlatRange{static_cast<uint32_t>(ast._tokens.size()), static_cast<uint32_t>(tokens.size())});
+            ast._tokens.insert(ast._tokens.end(), tokens.begin(), tokens.end());
+            context.tokenCursor = ast._ranges.back().first;
+            context.tokenEnd    = static_cast<uint32_t>(ast._tokens.size());
+            return static_cast<uint32_t>(ast._ranges.size() - 1);
+        }
+        case NodeType::OPERAND: {
+            const Token& token = static_cast<const OperandNode*>(node)->getToken();
+            for (uint32_t i = context.tokenCursor; i < context.tokenEnd; i++) {
+                const Token& candidate = ast._tokens[i];
+                if (candidate.line == token.line && candidate.column == token.column && candidate.type == token.type) {
+                    context.tokenCursor = i + 1;
+                    return i;
+                }
+            }
+            ast._tokens.push_back(token);
+            return static_cast<uint32_t>(ast._tokens.size() - 1);
+        }
+        case NodeType::FUNCTION: {
+            const auto*                       function   = static_cast<const FunctionNode*>(node);
+            std::span<const std::string_view> parameters = function->getParameters();
+            std::span<const Token>            body       = function->getBody();
+            ast._functions.push_back(FlatFunction{ast._strings.copyString(function->getName()),
+                                                  function->getSymbol(),
+                                                  FlatRange{static_cast<uint32_t>(ast._parameters.size()),
+                                                            static_cast<uint32_t>(parameters.size())},
+                                                  FlatRange{static_cast<uint32_t>(ast._tokens.size()),
+                                                            static_cast<uint32_t>(body.size())},
+                                                  function->isParsed()});
+            for (std::string_view parameter : parameters) {
+                ast._parameters.push_back(ast._strings.copyString(parameter));
+            }
+            ast._tokens.insert(ast._tokens.end(), body.begin(), body.end());
+            return static_cast<uint32_t>(ast._functions.size() - 1);
+        }
+        case NodeType::UNARY:
+            return static_cast<const UnaryNode*>(node)->isPostfix() ? 1 : 0;
+        case NodeType::STRING: {
+            std::span<const StringSegment> segments = static_cast<const StringNode*>(node)->getSegments();
+            ast._ranges.push_back(
+                FlatRange{static_cast<uint32_t>(ast._segments.size()), static_cast<uint32_t>(segments.size())});
+            for (const StringSegment& segment : segments) {
+                ast._segments.push_back(
+                    StringSegment{segment.type, ast._strings.copyString(segment.content), segment.symbol});
+            }
+            return static_cast<uint32_t>(ast._ranges.size() - 1);
+        }
+        case NodeType::BASE:
+            if (node->getTokenType() == TokenType::LOAD) {
+                ast._paths.push_back(ast._strings.copyString(static_cast<const LoadNode*>(node)->getPath()));
+                return static_cast<uint32_t>(ast._paths.size() - 1);
+            }
+            return FlatAst::NO_PAYLOAD;
+        default:
+            return FlatAst::NO_PAYLOAD;
+    }
+}
+
+void FlatAstConverter::childrenOf(const NodeBase* node, std::vector<const NodeBase*>& children) {
+    children.clear();
+
+    switch (node->getNodeType()) {
+        case NodeType::VARIABLE: {
+            const auto* variable = static_cast<const VariableNode*>(node);
+            if (variable->getOperation()) {
+                children.push_back(variable->getOperation());
+            }
+            if (variable->getStringNode()) {
+                children.push_back(variable->getStringNode());
+            }
+            break;
+        }
+        case NodeType::OPERATION:
+            if (const NodeBase* expression = static_cast<const OperationNode*>(node)->getExpression()) {
+                children.push_back(expression);
+            }
+            break;
+        case NodeType::FUNCTION: {
+            std::span<NodeBase* const> statements = static_cast<const FunctionNode*>(node)->getStatements();
+            children.insert(children.end(), statements.begin(), statements.end());
+            break;
+        }
+        case NodeType::UNARY:
+            children.push_back(static_cast<const UnaryNode*>(node)->getOperand());
+            break;
+        case NodeType::BINARY: {
+            const auto* binary = static_cast<const BinaryNode*>(node);
+            children.push_back(binary->getLeft());
+            children.push_back(binary->getRight());
+            break;
+        }
+        case NodeType::CALL: {
+            const auto*                      call      = static_cast<const CallNode*>(node);
+            std::span<const NodeBase* const> arguments = call->getArguments();
+            children.push_back(call->getCallee());
+            children.insert(children.end(), arguments.begin(), arguments.end());
+            break;
+        }
+        default:
+            break;
+    }
+}
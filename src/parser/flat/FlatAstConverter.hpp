@@ -0,0 +1,112 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/parser/flat/FlatAst.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class FlatAstConverter
+ * @brief Converts the pointer tree built by the parser into a FlatAst
+ *
+ * Dispatches on NodeBase::getNodeType rather than on dynamic types, and
+ * copies the strings of the tree so the result outlives the parser.
+ * This class cannot be instantiated.
+ */
+class FlatAstConverter {
+private:
+    FlatAstConverter()                                   = delete;
+    ~FlatAstConverter()                                  = delete;
+    FlatAstConverter(const FlatAstConverter&)            = delete;
+    FlatAstConverter& operator=(const FlatAstConverter&) = delete;
+
+    /**
+     * @struct Pending
+     * @brief A node waiting to be converted
+     */
+    struct Pending {
+        const NodeBase* node;
+        uint32_t        slot;  ///< Entry of the child index array that receives the id of the node
+    };
+
+    /**
+     * @struct Context
+     * @brief State of one conversion
+     */
+    struct Context {
+        std::vector<Pending>         pending;          ///< Stack of nodes to convert, the next one on top
+        std::vector<const NodeBase*> children;         ///< Scratch list of the children of the current node
+        uint32_t                     tokenCursor = 0;  ///< Next token of the enclosing operation an operand can match
+        uint32_t                     tokenEnd    = 0;  ///< End of the tokens of the enclosing operation
+    };
+
+    /**
+     * @brief Appends a tree in pre-order
+     *
+     * Walks the tree with an explicit stack, so its depth is not bounded by the
+     * call stack, the same way FlatAst::walk visits the result.
+     *
+     * @param ast The tree being built
+     * @param root The root of the tree to convert
+     * @param context The state of the conversion
+     * @return uint32_t The id of the root
+     * @throws std::runtime_error If the tree has more nodes than ids can address
+     */
+    static uint32_t convertTree(FlatAst& ast, const NodeBase* root, Context& context);
+
+    /**
+     * @brief Fills the payload of a node from the fields of its kind
+     *
+     * Operands share the token stored for their enclosing operation, which
+     * they follow in source order, instead of storing a copy of their own.
+     *
+     * @param ast The tree being built
+     * @param node The node being converted
+     * @param context The state of the conversion
+     * @return uint32_t The payload of the node
+     */
+    static uint32_t payloadOf(FlatAst& ast, const NodeBase* node, Context& context);
+
+    /**
+     * @brief Lists the children of a node in source order
+     * @param node The node being converted
+     * @param children The list receiving the children, cleared first
+     */
+    static void childrenOf(const NodeBase* node, std::vector<const NodeBase*>& children);
+
+public:
+    /**
+     * @brief Converts parsed trees into a flat representation
+     * @param roots The top-level nodes, as returned by Parser::getNodes
+     * @return FlatAst The flat representation of the trees
+     * @throws std::runtime_error If the trees have more nodes than ids can address
+     */
+    static FlatAst convert(std::span<NodeBase* const> roots);
+};
+
+}  // namespace opal
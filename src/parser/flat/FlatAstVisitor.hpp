@@ -0,0 +1,63 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace opal {
+
+class FlatAst;
+
+/**
+ * @class FlatAstVisitor
+ * @brief Interface for walking a FlatAst with FlatAst::walk
+ *
+ * Nodes are identified by their index, and their kind, token type and
+ * payloads are read through the FlatAst passed along.
+ */
+class FlatAstVisitor {
+public:
+    /**
+     * @brief Virtual destructor for proper inheritance
+     */
+    virtual ~FlatAstVisitor() = default;
+
+    /**
+     * @brief Called before the children of a node are visited
+     * @param ast The tree being walked
+     * @param id The index of the node
+     * @return bool True to visit the children of the node, false to skip them
+     */
+    virtual bool enter(const FlatAst& ast, uint32_t id) = 0;
+
+    /**
+     * @brief Called after the children of a node are visited, or skipped
+     * @param ast The tree being walked
+     * @param id The index of the node
+     */
+    virtual void leave(const FlatAst& ast, uint32_t id) {
+        (void)ast;
+        (void)id;
+    }
+};
+
+}  // namespace opal
@@ -22,11 +22,17 @@
 #include "opal/parser/node/NodeBase.hpp"
 
 #include "opal/lexer/Token.hpp"
+#include "opal/parser/node/nodes/BinaryNode.hpp"
+#include "opal/parser/node/nodes/CallNode.hpp"
+#include "opal/parser/node/nodes/UnaryNode.hpp"
 
 #include <spdlog/spdlog.h>
 
 #include <iostream>
+#include <span>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace opal;
 
@@ -42,6 +48,16 @@ std::string nodeTypeToString(NodeType type) {
             return "FUNCTION";
         case NodeType::CLASS:
             return "CLASS";
+        case NodeType::STRING:
+            return "STRING";
+        case NodeType::OPERAND:
+            return "OPERAND";
+        case NodeType::UNARY:
+            return "UNARY";
+        case NodeType::BINARY:
+            return "BINARY";
+        case NodeType::CALL:
+            return "CALL";
         default:
             return "UNKNOWN";
     }
@@ -82,6 +98,45 @@ void NodeBase::printIndent(size_t indent) {
     }
 }
 
+void NodeBase::printTree(const NodeBase* root, size_t indent) {
+    std::vector<std::pair<const NodeBase*, size_t>> pending = {{root, indent}};
+
+    while (!pending.empty()) {
+        auto [node, level] = pending.back();
+        pending.pop_back();
+
+        // Children are pushed in reverse so that they pop in source order
+        switch (node->getNodeType()) {
+            case NodeType::BINARY: {
+                const auto* binary = static_cast<const BinaryNode*>(node);
+                binary->printHeader(level);
+                pending.emplace_back(binary->getRight(), level + 1);
+                pending.emplace_back(binary->getLeft(), level + 1);
+                break;
+            }
+            case NodeType::UNARY: {
+                const auto* unary = static_cast<const UnaryNode*>(node);
+                unary->printHeader(level);
+                pending.emplace_back(unary->getOperand(), level + 1);
+                break;
+            }
+            case NodeType::CALL: {
+                const auto*                      call      = static_cast<const CallNode*>(node);
+                std::span<const NodeBase* const> arguments = call->getArguments();
+                call->printHeader(level);
+                for (size_t i = arguments.size(); i > 0; i--) {
+                    pending.emplace_back(arguments[i - 1], level + 1);
+                }
+                pending.emplace_back(call->getCallee(), level + 1);
+                break;
+            }
+            default:
+                node->print(level);
+                break;
+        }
+    }
+}
+
 void NodeBase::print(size_t indent) const {
     this->printIndent(indent);
     spdlog::info("Node(type={}, token={})", nodeTypeToString(this->_nodeType), tokenTypeToString(this->_tokenType));
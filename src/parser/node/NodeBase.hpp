@@ -29,14 +29,16 @@ namespace opal {
  * @enum NodeType
  * @brief Enumerates the different types of AST nodes
  */
-enum class NodeType { BASE, VARIABLE, OPERATION, FUNCTION, CLASS, STRING };
+enum class NodeType { BASE, VARIABLE, OPERATION, FUNCTION, CLASS, STRING, OPERAND, UNARY, BINARY, CALL };
 
 /**
  * @class NodeBase
  * @brief Base class for all Abstract Syntax Tree nodes
  *
  * Provides common functionality and interface for all node types
- * in the Abstract Syntax Tree.
+ * in the Abstract Syntax Tree. Nodes are created in an AstArena, so every
+ * subclass must only hold trivially destructible members, with strings and
+ * arrays stored in the arena as well.
  */
 class NodeBase {
 protected:
@@ -52,9 +54,12 @@ public:
     NodeBase(TokenType tokenType, NodeType nodeType = NodeType::BASE);
 
     /**
-     * @brief Virtual destructor for proper inheritance
+     * @brief Trivial destructor, nodes live in an AstArena and are released with it
+     *
+     * Not virtual on purpose: nodes are never deleted through a base pointer,
+     * and a trivial destructor is what lets the arena skip destroying them.
      */
-    virtual ~NodeBase() = default;
+    ~NodeBase() = default;
 
     /**
      * @brief Gets the node type
@@ -79,6 +84,18 @@ public:
      * @param indent The number of spaces to indent
      */
     static void printIndent(size_t indent);
+
+    /**
+     * @brief Prints an expression tree with an explicit stack instead of recursion
+     *
+     * Binary, unary and call nodes are expanded in place, so chains as long as
+     * the parser accepts print without growing the call stack. Any other node
+     * is printed with its own print.
+     *
+     * @param root The root of the tree
+     * @param indent The indentation level of the root
+     */
+    static void printTree(const NodeBase* root, size_t indent);
 };
 
 }  // namespace opal
\ No newline at end of file
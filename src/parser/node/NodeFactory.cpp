@@ -29,18 +29,42 @@
 
 namespace opal {
 
-std::unique_ptr<NodeBase> NodeFactory::createNode(TokenType tokenType) {
-    return std::make_unique<NodeBase>(tokenType);
+NodeBase* NodeFactory::createNode(AstArena& arena, TokenType tokenType) {
+    return arena.create<NodeBase>(tokenType);
 }
 
-std::unique_ptr<OperationNode> NodeFactory::createOperationNode(const std::vector<Token>& tokens) {
+OperationNode* NodeFactory::createOperationNode(AstArena&              arena,
+                                                std::span<const Token> tokens,
+                                                NodeBase*              expression) {
     TokenType operationType = tokens.empty() ? TokenType::PLUS : tokens[0].type;
 
-    return std::make_unique<OperationNode>(operationType, tokens);
+    return arena.create<OperationNode>(operationType, arena.copyArray(tokens), expression);
 }
 
-std::unique_ptr<LoadNode> NodeFactory::createLoadNode(const std::string_view& path) {
-    return std::make_unique<LoadNode>(TokenType::LOAD, path);
+CallNode* NodeFactory::createCallNode(AstArena& arena, NodeBase* callee, std::span<NodeBase* const> arguments) {
+    return arena.create<CallNode>(callee, arena.copyArray(arguments));
+}
+
+FunctionNode* NodeFactory::createFunctionNode(AstArena&                         arena,
+                                              std::string_view                  name,
+                                              uint32_t                          symbol,
+                                              std::span<const std::string_view> parameters,
+                                              std::span<Token>                  body) {
+    return arena.create<FunctionNode>(name, symbol, arena.copyArray(parameters), body);
+}
+
+LoadNode* NodeFactory::createLoadNode(AstArena& arena, std::string_view path) {
+    return arena.create<LoadNode>(TokenType::LOAD, path);
+}
+
+StringNode* NodeFactory::createStringNode(AstArena& arena, std::span<const StringSegment> segments) {
+    StringNode* node = arena.create<StringNode>(TokenType::STRING);
+    if (segments.empty()) {
+        return node;
+    }
+
+    node->setSegments(arena.copyArray(segments));
+    return node;
 }
 
 }  // namespace opal
\ No newline at end of file
@@ -22,16 +22,21 @@
 #pragma once
 
 #include "opal/lexer/Token.hpp"
+#include "opal/parser/AstArena.hpp"
 #include "opal/parser/atomizer/VariableType.hpp"
 #include "opal/parser/node/NodeBase.hpp"
+#include "opal/parser/node/nodes/BinaryNode.hpp"
+#include "opal/parser/node/nodes/CallNode.hpp"
+#include "opal/parser/node/nodes/FunctionNode.hpp"
 #include "opal/parser/node/nodes/LoadNode.hpp"
+#include "opal/parser/node/nodes/OperandNode.hpp"
 #include "opal/parser/node/nodes/OperationNode.hpp"
 #include "opal/parser/node/nodes/StringNode.hpp"
+#include "opal/parser/node/nodes/UnaryNode.hpp"
 #include "opal/parser/node/nodes/VariableNode.hpp"
 
-#include <memory>
-#include <string>
-#include <vector>
+#include <span>
+#include <string_view>
 
 namespace opal {
 
@@ -41,51 +46,123 @@ namespace opal {
  *
  * Provides static methods to create different types of AST nodes,
  * encapsulating the creation logic and ensuring proper initialization.
+ * Nodes are created in the arena of the parse session, along with copies of
+ * the token and child arrays they refer to. Strings are not copied: names,
+ * values, paths and string segments are views into the source buffer the
+ * tokens were lexed from, which must outlive the nodes.
  */
 class NodeFactory {
 public:
     /**
      * @brief Creates a generic node based on token type
+     * @param arena The arena owning the node
      * @param type The token type to create a node for
-     * @return std::unique_ptr<NodeBase> A unique pointer to the created node
+     * @return NodeBase* The created node, owned by the arena
      */
-    static std::unique_ptr<NodeBase> createNode(TokenType type);
+    static NodeBase* createNode(AstArena& arena, TokenType type);
 
     /**
      * @brief Creates a variable node
-     * @param name The name of the variable
-     * @param value The initial value of the variable
+     * @param arena The arena owning the node
+     * @param name The name of the variable, viewed rather than copied
+     * @param value The initial value of the variable, viewed rather than copied
      * @param isConstant Whether the variable is constant (cannot be reassigned)
      * @param type The data type of the variable
-     * @return std::unique_ptr<VariableNode> A unique pointer to the created variable node
+     * @return VariableNode* The created variable node, owned by the arena
      */
-    static std::unique_ptr<VariableNode> createVariableNode(const std::string& name,
-                                                            const std::string& value,
-                                                            bool               isConstant = false,
-                                                            VariableType       type       = VariableType::UNKNOWN) {
-        return std::make_unique<VariableNode>(TokenType::IDENTIFIER, name, value, isConstant, type);
+    static VariableNode* createVariableNode(AstArena&        arena,
+                                            std::string_view name,
+                                            std::string_view value,
+                                            bool             isConstant = false,
+                                            VariableType     type       = VariableType::UNKNOWN) {
+        return arena.create<VariableNode>(TokenType::IDENTIFIER, name, value, isConstant, type);
     }
 
     /**
      * @brief Creates an operation node from a sequence of tokens
+     * @param arena The arena owning the node and the copy of its tokens
      * @param tokens The tokens representing the operation
-     * @return std::unique_ptr<OperationNode> A unique pointer to the created operation node
+     * @param expression The expression tree parsed from the tokens, already in the arena, or nullptr
+     * @return OperationNode* The created operation node, owned by the arena
      */
-    static std::unique_ptr<OperationNode> createOperationNode(const std::vector<Token>& tokens);
+    static OperationNode* createOperationNode(AstArena&              arena,
+                                              std::span<const Token> tokens,
+                                              NodeBase*              expression = nullptr);
+
+    /**
+     * @brief Creates an operand node, the leaf of an expression
+     * @param arena The arena owning the node
+     * @param token The literal or identifier token of the operand
+     * @return OperandNode* The created operand node, owned by the arena
+     */
+    static OperandNode* createOperandNode(AstArena& arena, const Token& token) {
+        return arena.create<OperandNode>(token);
+    }
+
+    /**
+     * @brief Creates a unary expression node
+     * @param arena The arena owning the node
+     * @param op The token type of the operator
+     * @param operand The operand, already in the arena
+     * @param postfix Whether the operator is written after the operand
+     * @return UnaryNode* The created unary node, owned by the arena
+     */
+    static UnaryNode* createUnaryNode(AstArena& arena, TokenType op, NodeBase* operand, bool postfix = false) {
+        return arena.create<UnaryNode>(op, operand, postfix);
+    }
+
+    /**
+     * @brief Creates a binary expression node
+     * @param arena The arena owning the node
+     * @param op The token type of the operator
+     * @param left The left operand, already in the arena
+     * @param right The right operand, already in the arena
+     * @return BinaryNode* The created binary node, owned by the arena
+     */
+    static BinaryNode* createBinaryNode(AstArena& arena, TokenType op, NodeBase* left, NodeBase* right) {
+        return arena.create<BinaryNode>(op, left, right);
+    }
+
+    /**
+     * @brief Creates a call node
+     * @param arena The arena owning the node and the copy of its argument list
+     * @param callee The called expression, already in the arena
+     * @param arguments The arguments of the call, already in the arena
+     * @return CallNode* The created call node, owned by the arena
+     */
+    static CallNode* createCallNode(AstArena& arena, NodeBase* callee, std::span<NodeBase* const> arguments);
+
+    /**
+     * @brief Creates a pre-parsed function node
+     * @param arena The arena owning the node and the copy of its parameter list
+     * @param name The name of the function, a view into the source
+     * @param symbol The interned id of the name, or SymbolTable::NO_SYMBOL
+     * @param parameters The parameter names in order, views into the source
+     * @param body The tokens of the body after the opening brace, ending with the closing one, which must outlive
+     * the arena
+     * @return FunctionNode* The created function node with an unparsed body, owned by the arena
+     */
+    static FunctionNode* createFunctionNode(AstArena&                         arena,
+                                            std::string_view                  name,
+                                            uint32_t                          symbol,
+                                            std::span<const std::string_view> parameters,
+                                            std::span<Token>                  body);
 
     /**
      * @brief Creates a load node for importing modules
-     * @param path The path to the module to load
-     * @return std::unique_ptr<LoadNode> A unique pointer to the created load node
+     * @param arena The arena owning the node
+     * @param path The path to the module to load, viewed rather than copied
+     * @return LoadNode* The created load node, owned by the arena
      */
-    static std::unique_ptr<LoadNode> createLoadNode(const std::string_view& path);
+    static LoadNode* createLoadNode(AstArena& arena, std::string_view path);
 
     /**
      * @brief Creates a string node
-     * @param text The initial text content of the string
-     * @return std::unique_ptr<StringNode> A unique pointer to the created string node
+     * @param arena The arena owning the node and the copy of its segment array
+     * @param segments The text and variable segments of the string, in order, whose contents are viewed
+     * @return StringNode* The created string node, owned by the arena
      */
-    static std::unique_ptr<StringNode> createStringNode() { return std::make_unique<StringNode>(TokenType::STRING); }
+    static StringNode* createStringNode(AstArena& arena, std::span<const StringSegment> segments);
 };
 
 }  // namespace opal
\ No newline at end of file
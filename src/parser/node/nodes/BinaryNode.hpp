@@ -0,0 +1,87 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+
+namespace opal {
+
+/**
+ * @class BinaryNode
+ * @brief AST node representing an operator applied to two operands
+ *
+ * The operator is the token type of the node. Precedence and associativity
+ * are already resolved by the shape of the tree, so no grouping node exists.
+ */
+class BinaryNode : public NodeBase {
+private:
+    NodeBase* _left;   ///< The left operand, owned by the same arena
+    NodeBase* _right;  ///< The right operand, owned by the same arena
+
+public:
+    /**
+     * @brief Constructs a new Binary Node object
+     * @param op The token type of the operator
+     * @param left The left operand
+     * @param right The right operand
+     */
+    BinaryNode(TokenType op, NodeBase* left, NodeBase* right);
+
+    /**
+     * @brief Gets the left operand
+     * @return const NodeBase* The left operand
+     */
+    const NodeBase* getLeft() const { return _left; }
+
+    /**
+     * @brief Gets the left operand for updating it in place
+     * @return NodeBase* The left operand
+     */
+    NodeBase* getLeft() { return _left; }
+
+    /**
+     * @brief Gets the right operand
+     * @return const NodeBase* The right operand
+     */
+    const NodeBase* getRight() const { return _right; }
+
+    /**
+     * @brief Gets the right operand for updating it in place
+     * @return NodeBase* The right operand
+     */
+    NodeBase* getRight() { return _right; }
+
+    /**
+     * @brief Prints the line of this node alone, without its operands
+     * @param indent The indentation level for pretty printing
+     */
+    void printHeader(size_t indent) const;
+
+    /**
+     * @brief Prints the node to standard output
+     * @param indent The indentation level for pretty printing
+     */
+    void print(size_t indent = 0) const override;
+};
+
+}  // namespace opal
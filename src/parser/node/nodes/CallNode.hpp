@@ -0,0 +1,85 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+
+#include <span>
+
+namespace opal {
+
+/**
+ * @class CallNode
+ * @brief AST node representing a function call inside an expression
+ */
+class CallNode : public NodeBase {
+private:
+    NodeBase*                  _callee;     ///< The called expression, owned by the same arena
+    std::span<NodeBase* const> _arguments;  ///< The arguments in order, stored in the same arena
+
+public:
+    /**
+     * @brief Constructs a new Call Node object
+     * @param callee The called expression
+     * @param arguments The arguments of the call, stored by view so they must outlive the node
+     */
+    CallNode(NodeBase* callee, std::span<NodeBase* const> arguments);
+
+    /**
+     * @brief Gets the called expression
+     * @return const NodeBase* The callee, an identifier or the result of another call
+     */
+    const NodeBase* getCallee() const { return _callee; }
+
+    /**
+     * @brief Gets the called expression for updating it in place
+     * @return NodeBase* The callee
+     */
+    NodeBase* getCallee() { return _callee; }
+
+    /**
+     * @brief Gets the arguments of the call
+     * @return std::span<const NodeBase* const> The arguments in order
+     */
+    std::span<const NodeBase* const> getArguments() const { return {_arguments.data(), _arguments.size()}; }
+
+    /**
+     * @brief Gets the arguments of the call for updating them in place
+     * @return std::span<NodeBase* const> The arguments in order
+     */
+    std::span<NodeBase* const> getArguments() { return _arguments; }
+
+    /**
+     * @brief Prints the line of this node alone, without its callee and arguments
+     * @param indent The indentation level for pretty printing
+     */
+    void printHeader(size_t indent) const;
+
+    /**
+     * @brief Prints the node to standard output
+     * @param indent The indentation level for pretty printing
+     */
+    void print(size_t indent = 0) const override;
+};
+
+}  // namespace opal
@@ -0,0 +1,54 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/node/nodes/FunctionNode.hpp"
+
+#include <iostream>
+
+using namespace opal;
+
+FunctionNode::FunctionNode(std::string_view                  name,
+                           uint32_t                          symbol,
+                           std::span<const std::string_view> parameters,
+                           std::span<Token>                  body)
+    : NodeBase(TokenType::FN, NodeType::FUNCTION), _name(name), _symbol(symbol), _parameters(parameters), _body(body) {}
+
+void FunctionNode::setStatements(std::span<NodeBase* const> statements) {
+    this->_statements = statements;
+    this->_parsed     = true;
+}
+
+void FunctionNode::print(size_t indent) const {
+    this->printIndent(indent);
+    std::cout << "Function(name: " << this->_name << ", parameters:";
+    for (std::string_view parameter : this->_parameters) {
+        std::cout << " " << parameter;
+    }
+
+    if (!this->_parsed) {
+        std::cout << ", body: " << this->_body.size() << " tokens, not parsed)" << std::endl;
+        return;
+    }
+    std::cout << ")" << std::endl;
+    for (const NodeBase* statement : this->_statements) {
+        statement->print(indent + 1);
+    }
+}
@@ -0,0 +1,128 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/SymbolTable.hpp"
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace opal {
+
+/**
+ * @class FunctionNode
+ * @brief AST node representing a function declaration whose body is parsed lazily
+ *
+ * The parser only pre-parses a function: it reads the name and parameters,
+ * checks that the braces of the body balance and keeps the tokens of the
+ * body, without building nodes for it. The statements of the body are set
+ * once Parser::parseFunctionBody parses it, typically when the function is
+ * first used, so functions that never run cost no nodes.
+ */
+class FunctionNode : public NodeBase {
+private:
+    std::string_view                  _name;                          ///< View into the parsed source
+    uint32_t                          _symbol = SymbolTable::NO_SYMBOL;
+    std::span<const std::string_view> _parameters;                    ///< Stored in the same arena
+    std::span<Token>                  _body;                          ///< Up to and including the closing brace
+    std::span<NodeBase* const>        _statements;
+    bool                              _parsed = false;
+
+public:
+    /**
+     * @brief Constructs a new Function Node object with an unparsed body
+     * @param name The name of the function
+     * @param symbol The interned id of the name, or SymbolTable::NO_SYMBOL
+     * @param parameters The parameter names in order, stored by view so they must outlive the node
+     * @param body The tokens of the body after the opening brace, ending with the closing one, which must outlive
+     * the node
+     */
+    FunctionNode(std::string_view                  name,
+                 uint32_t                          symbol,
+                 std::span<const std::string_view> parameters,
+                 std::span<Token>                  body);
+
+    /**
+     * @brief Gets the name of the function
+     * @return std::string_view The name, a view into the parsed source
+     */
+    std::string_view getName() const { return _name; }
+
+    /**
+     * @brief Gets the interned id of the name
+     * @return uint32_t The symbol id, or SymbolTable::NO_SYMBOL when parsed without a symbol table
+     */
+    uint32_t getSymbol() const { return _symbol; }
+
+    /**
+     * @brief Sets the interned id of the name
+     * @param symbol The id of the name in the parse symbol table
+     */
+    void setSymbol(uint32_t symbol) { _symbol = symbol; }
+
+    /**
+     * @brief Gets the parameter names
+     * @return std::span<const std::string_view> The names in order, views into the parsed source
+     */
+    std::span<const std::string_view> getParameters() const { return _parameters; }
+
+    /**
+     * @brief Gets the tokens of the body
+     * @return std::span<const Token> The tokens after the opening brace, ending with the closing one
+     */
+    std::span<const Token> getBody() const { return _body; }
+
+    /**
+     * @brief Gets the tokens of the body for updating them in place
+     * @return std::span<Token> The tokens after the opening brace, ending with the closing one
+     */
+    std::span<Token> getBody() { return _body; }
+
+    /**
+     * @brief Checks if the body has been parsed
+     * @return bool True once the statements are set, false while only pre-parsed
+     */
+    bool isParsed() const { return _parsed; }
+
+    /**
+     * @brief Gets the statements of the body
+     * @return std::span<NodeBase* const> The statements in order, empty until the body is parsed
+     */
+    std::span<NodeBase* const> getStatements() const { return _statements; }
+
+    /**
+     * @brief Sets the statements of the parsed body
+     * @param statements The statements in order, stored by view so they must outlive the node
+     */
+    void setStatements(std::span<NodeBase* const> statements);
+
+    /**
+     * @brief Prints the node to standard output
+     * @param indent The indentation level for pretty printing
+     */
+    void print(size_t indent = 0) const override;
+};
+
+}  // namespace opal
@@ -48,7 +48,7 @@ public:
 
     /**
      * @brief Gets the path of the file being loaded
-     * @return const std::string_view& The file path
+     * @return const std::string_view& The file path, a view into the parsed source
      */
     const std::string_view& getPath() const { return _path; }
 
@@ -0,0 +1,66 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+
+namespace opal {
+
+/**
+ * @class OperandNode
+ * @brief AST node representing a leaf of an expression
+ *
+ * Holds the literal or identifier token the operand was parsed from, so the
+ * payload set by the lexer (literal table index or symbol id) stays available.
+ */
+class OperandNode : public NodeBase {
+private:
+    Token _token;  ///< The literal or identifier token, whose lexeme is viewed in the source
+
+public:
+    /**
+     * @brief Constructs a new Operand Node object
+     * @param token The literal or identifier token of the operand
+     */
+    explicit OperandNode(const Token& token);
+
+    /**
+     * @brief Gets the token of the operand
+     * @return const Token& The literal or identifier token
+     */
+    const Token& getToken() const { return _token; }
+
+    /**
+     * @brief Gets the token of the operand for updating it in place
+     * @return Token& The literal or identifier token
+     */
+    Token& getToken() { return _token; }
+
+    /**
+     * @brief Prints the node to standard output
+     * @param indent The indentation level for pretty printing
+     */
+    void print(size_t indent = 0) const override;
+};
+
+}  // namespace opal
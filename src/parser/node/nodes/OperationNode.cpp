@@ -27,8 +27,8 @@
 
 using namespace opal;
 
-OperationNode::OperationNode(TokenType tokenType, const std::vector<Token>& tokens)
-    : NodeBase(tokenType, NodeType::OPERATION), _tokens(tokens) {}
+OperationNode::OperationNode(TokenType tokenType, std::span<Token> tokens, NodeBase* expression)
+    : NodeBase(tokenType, NodeType::OPERATION), _tokens(tokens), _expression(expression) {}
 
 void OperationNode::print(size_t indent) const {
     this->printIndent(indent);
@@ -41,4 +41,8 @@ void OperationNode::print(size_t indent) const {
                   << "'";
     }
     std::cout << ")" << std::endl;
+
+    if (this->_expression) {
+        this->_expression->print(indent + 1);
+    }
 }
@@ -24,7 +24,7 @@
 #include "opal/lexer/Token.hpp"
 #include "opal/parser/node/NodeBase.hpp"
 
-#include <vector>
+#include <span>
 
 namespace opal {
 
@@ -33,25 +33,46 @@ namespace opal {
  * @brief AST node representing an operation (expression)
  *
  * Represents an operation or expression in Opal, such as arithmetic
- * operations, function calls, or any other expression.
+ * operations, function calls, or any other expression. Keeps both the tokens
+ * of the operation in source order and the expression tree built from them.
  */
 class OperationNode : public NodeBase {
 private:
-    std::vector<Token> _tokens;  ///< The tokens that make up this operation
+    std::span<Token> _tokens;                ///< The tokens that make up this operation
+    NodeBase*        _expression = nullptr;  ///< The root of the expression tree, owned by the same arena
 
 public:
     /**
      * @brief Constructs a new Operation Node object
      * @param tokenType The token type associated with this node
-     * @param tokens The tokens that make up this operation
+     * @param tokens The tokens that make up this operation, stored by view so they must outlive the node
+     * @param expression The root of the expression tree, or nullptr when only the tokens are known
      */
-    OperationNode(TokenType tokenType, const std::vector<Token>& tokens);
+    OperationNode(TokenType tokenType, std::span<Token> tokens, NodeBase* expression = nullptr);
 
     /**
      * @brief Gets the tokens that make up this operation
-     * @return const std::vector<Token>& The tokens
+     * @return std::span<const Token> The tokens
      */
-    const std::vector<Token>& getTokens() const { return _tokens; }
+    std::span<const Token> getTokens() const { return _tokens; }
+
+    /**
+     * @brief Gets the tokens that make up this operation for updating them in place
+     * @return std::span<Token> The tokens
+     */
+    std::span<Token> getTokens() { return _tokens; }
+
+    /**
+     * @brief Gets the expression tree of this operation
+     * @return const NodeBase* The root of the tree, with operator precedence resolved, or nullptr
+     */
+    const NodeBase* getExpression() const { return _expression; }
+
+    /**
+     * @brief Gets the expression tree of this operation for updating it in place
+     * @return NodeBase* The root of the tree, or nullptr
+     */
+    NodeBase* getExpression() { return _expression; }
 
     /**
      * @brief Prints the node to standard output
@@ -29,12 +29,14 @@ using namespace opal;
 
 StringNode::StringNode(TokenType tokenType) : NodeBase(tokenType, NodeType::STRING) {}
 
-void StringNode::addTextSegment(const std::string& text) {
-    _segments.push_back({StringSegmentType::TEXT, text});
-}
-
-void StringNode::addVariableSegment(const std::string& variableName) {
-    _segments.push_back({StringSegmentType::VARIABLE, variableName});
+void StringNode::setSegments(std::span<StringSegment> segments) {
+    _segments     = segments;
+    _staticLength = 0;
+    for (const StringSegment& segment : segments) {
+        if (segment.type == StringSegmentType::TEXT) {
+            _staticLength += segment.content.size();
+        }
+    }
 }
 
 void StringNode::print(size_t indent) const {
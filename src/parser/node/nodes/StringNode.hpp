@@ -21,20 +21,24 @@
 
 #pragma once
 
+#include "opal/lexer/SymbolTable.hpp"
 #include "opal/lexer/Token.hpp"
 #include "opal/parser/node/NodeBase.hpp"
 
-#include <memory>
-#include <string>
-#include <vector>
+#include <span>
+#include <string_view>
 
 namespace opal {
 
 enum class StringSegmentType { TEXT, VARIABLE };
 
+/**
+ * @brief A run of literal text or an interpolated variable name, viewing its range of the source
+ */
 struct StringSegment {
     StringSegmentType type;
-    std::string       content;
+    std::string_view  content;
+    uint32_t          symbol = SymbolTable::NO_SYMBOL;  ///< Interned id of a VARIABLE segment name
 };
 
 /**
@@ -42,18 +46,34 @@ struct StringSegment {
  * @brief AST node representing a string literal, which may contain interpolation
  *
  * Represents a string in Opal, which can be either a simple string or
- * an interpolated string containing variables or expressions.
+ * an interpolated string containing variables or expressions. The total
+ * length of the literal text is computed once when the segments are set, so
+ * building the string later only has to add the lengths of the variables to
+ * allocate the result in one go.
  */
 class StringNode : public NodeBase {
 public:
     explicit StringNode(TokenType tokenType = TokenType::STRING);
-    void                              addTextSegment(const std::string& text);
-    void                              addVariableSegment(const std::string& variableName);
-    void                              print(size_t indent) const override;
-    const std::vector<StringSegment>& getSegments() const { return _segments; }
+    void                           setSegments(std::span<StringSegment> segments);
+    void                           print(size_t indent) const override;
+    std::span<const StringSegment> getSegments() const { return _segments; }
+
+    /**
+     * @brief Gets the number of bytes of literal text, excluding interpolated variables
+     * @return size_t The summed length of the TEXT segments
+     */
+    size_t getStaticLength() const { return _staticLength; }
+
+    /**
+     * @brief Sets the interned id of the name of a VARIABLE segment
+     * @param index The index of the segment
+     * @param symbol The symbol id
+     */
+    void setSegmentSymbol(size_t index, uint32_t symbol) { _segments[index].symbol = symbol; }
 
 private:
-    std::vector<StringSegment> _segments;
+    std::span<StringSegment> _segments;
+    size_t                   _staticLength = 0;
 };
 
 }  // namespace opal
\ No newline at end of file
@@ -0,0 +1,81 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/node/NodeBase.hpp"
+
+namespace opal {
+
+/**
+ * @class UnaryNode
+ * @brief AST node representing an operator applied to a single operand
+ *
+ * Covers prefix operators such as negation and logical or bitwise not, and the
+ * postfix increment and decrement. The operator is the token type of the node.
+ */
+class UnaryNode : public NodeBase {
+private:
+    NodeBase* _operand;  ///< The operand, owned by the same arena
+    bool      _postfix;  ///< Whether the operator is written after the operand
+
+public:
+    /**
+     * @brief Constructs a new Unary Node object
+     * @param op The token type of the operator
+     * @param operand The operand of the operator
+     * @param postfix Whether the operator is written after the operand
+     */
+    UnaryNode(TokenType op, NodeBase* operand, bool postfix);
+
+    /**
+     * @brief Gets the operand
+     * @return const NodeBase* The operand of the operator
+     */
+    const NodeBase* getOperand() const { return _operand; }
+
+    /**
+     * @brief Gets the operand for updating it in place
+     * @return NodeBase* The operand of the operator
+     */
+    NodeBase* getOperand() { return _operand; }
+
+    /**
+     * @brief Checks if the operator is written after the operand
+     * @return bool True for postfix increment and decrement, false otherwise
+     */
+    bool isPostfix() const { return _postfix; }
+
+    /**
+     * @brief Prints the line of this node alone, without its operands
+     * @param indent The indentation level for pretty printing
+     */
+    void printHeader(size_t indent) const;
+
+    /**
+     * @brief Prints the node to standard output
+     * @param indent The indentation level for pretty printing
+     */
+    void print(size_t indent = 0) const override;
+};
+
+}  // namespace opal
@@ -27,12 +27,17 @@
 
 using namespace opal;
 
-VariableNode::VariableNode(TokenType          tokenType,
-                           const std::string& name,
-                           const std::string& value,
-                           bool               isConstant,
-                           VariableType       type)
-    : NodeBase(tokenType), _name(name), _value(value), _isConstant(isConstant), _type(type) {}
+VariableNode::VariableNode(TokenType        tokenType,
+                           std::string_view name,
+                           std::string_view value,
+                           bool             isConstant,
+                           VariableType     type)
+    : NodeBase(tokenType, NodeType::VARIABLE),
+      _name(name),
+      _symbol(SymbolTable::NO_SYMBOL),
+      _value(value),
+      _isConstant(isConstant),
+      _type(type) {}
 
 void VariableNode::print(size_t indent) const {
     std::string typeStr;
@@ -40,6 +45,9 @@ void VariableNode::print(size_t indent) const {
         case VariableType::INT:
             typeStr = "INT";
             break;
+        case VariableType::FLOAT:
+            typeStr = "FLOAT";
+            break;
         case VariableType::STRING:
             typeStr = "STRING";
             break;
@@ -21,14 +21,15 @@
 
 #pragma once
 
+#include "opal/lexer/LiteralTable.hpp"
+#include "opal/lexer/SymbolTable.hpp"
 #include "opal/lexer/Token.hpp"
 #include "opal/parser/atomizer/VariableType.hpp"
 #include "opal/parser/node/NodeBase.hpp"
 #include "opal/parser/node/nodes/OperationNode.hpp"
 #include "opal/parser/node/nodes/StringNode.hpp"
 
-#include <memory>
-#include <string>
+#include <string_view>
 
 namespace opal {
 
@@ -42,39 +43,41 @@ namespace opal {
  */
 class VariableNode : public NodeBase {
 private:
-    std::string                    _name;        ///< The name of the variable
-    std::string                    _value;       ///< The value of the variable (as a string)
-    bool                           _isConstant;  ///< Whether the variable is constant (cannot be reassigned)
-    VariableType                   _type;        ///< The data type of the variable
-    std::unique_ptr<OperationNode> _operation;   ///< Optional operation for variable initialization
-    std::unique_ptr<StringNode>    _stringNode;  ///< Added for string interpolation support
+    std::string_view _name;                  ///< The name of the variable
+    uint32_t         _symbol;                ///< Interned id of the name
+    std::string_view _value;                 ///< The value of the variable (as a string)
+    bool             _isConstant;            ///< Whether the variable is constant (cannot be reassigned)
+    VariableType     _type;                  ///< The data type of the variable
+    NumericLiteral   _number;                ///< Decoded value when the variable holds a number literal
+    OperationNode*   _operation  = nullptr;  ///< Optional operation for variable initialization
+    StringNode*      _stringNode = nullptr;  ///< Added for string interpolation support
 
 public:
     /**
      * @brief Constructs a new Variable Node object
      * @param tokenType The token type associated with this node
-     * @param name The name of the variable
-     * @param value The initial value of the variable
+     * @param name The name of the variable, stored by view so it must outlive the node
+     * @param value The initial value of the variable, stored by view so it must outlive the node
      * @param isConstant Whether the variable is constant (cannot be reassigned)
      * @param type The data type of the variable
      */
-    VariableNode(TokenType          tokenType,
-                 const std::string& name,
-                 const std::string& value,
-                 bool               isConstant = false,
-                 VariableType       type       = VariableType::UNKNOWN);
+    VariableNode(TokenType        tokenType,
+                 std::string_view name,
+                 std::string_view value,
+                 bool             isConstant = false,
+                 VariableType     type       = VariableType::UNKNOWN);
 
     /**
      * @brief Sets the operation for variable initialization
-     * @param op The operation node
+     * @param op The operation node, allocated in the same arena
      */
-    void setOperation(std::unique_ptr<OperationNode> op) { _operation = std::move(op); }
+    void setOperation(OperationNode* op) { _operation = op; }
 
     /**
      * @brief Sets the value of the variable
-     * @param newValue The new value
+     * @param newValue The new value, stored by view so it must outlive the node
      */
-    void setValue(const std::string& newValue) { _value = newValue; }
+    void setValue(std::string_view newValue) { _value = newValue; }
 
     /**
      * @brief Sets the type of the variable
@@ -82,23 +85,45 @@ public:
      */
     void setType(VariableType newType) { _type = newType; }
 
+    /**
+     * @brief Sets the decoded value of a number literal
+     * @param number The value decoded by the lexer
+     */
+    void setNumber(const NumericLiteral& number) { _number = number; }
+
+    /**
+     * @brief Sets the interned id of the variable name
+     * @param symbol The id of the name in the parse symbol table
+     */
+    void setSymbol(uint32_t symbol) { _symbol = symbol; }
+
     /**
      * @brief Gets the operation for variable initialization
      * @return OperationNode* Pointer to the operation node, or nullptr if none
      */
-    OperationNode* getOperation() const { return _operation.get(); }
+    OperationNode* getOperation() const { return _operation; }
 
     /**
      * @brief Gets the name of the variable
-     * @return const std::string& The variable name
+     * @return std::string_view The variable name, a view into the parsed source
      */
-    const std::string& getName() const { return _name; }
+    std::string_view getName() const { return _name; }
+
+    /**
+     * @brief Gets the interned id of the variable name
+     *
+     * Two variables parsed with the same symbol table have the same name
+     * exactly when their ids are equal.
+     *
+     * @return uint32_t The symbol id, or SymbolTable::NO_SYMBOL if parsed without a symbol table
+     */
+    uint32_t getSymbol() const { return _symbol; }
 
     /**
      * @brief Gets the value of the variable
-     * @return const std::string& The variable value
+     * @return std::string_view The variable value, a view into the parsed source or a static literal
      */
-    const std::string& getValue() const { return _value; }
+    std::string_view getValue() const { return _value; }
 
     /**
      * @brief Gets the type of the variable
@@ -106,6 +131,15 @@ public:
      */
     VariableType getType() const { return _type; }
 
+    /**
+     * @brief Gets the decoded value of a number literal
+     *
+     * Only meaningful when the type is INT or FLOAT and no operation is set.
+     *
+     * @return const NumericLiteral& The decoded value
+     */
+    const NumericLiteral& getNumber() const { return _number; }
+
     /**
      * @brief Checks if the variable is constant
      * @return bool True if the variable is constant, false otherwise
@@ -114,15 +148,15 @@ public:
 
     /**
      * @brief Sets the string node for string interpolation
-     * @param node The string node containing segments
+     * @param node The string node containing segments, allocated in the same arena
      */
-    void setStringNode(std::unique_ptr<StringNode> node) { _stringNode = std::move(node); }
+    void setStringNode(StringNode* node) { _stringNode = node; }
 
     /**
      * @brief Gets the string node if this variable contains an interpolated string
      * @return StringNode* Pointer to the string node, or nullptr if not a string
      */
-    StringNode* getStringNode() const { return _stringNode.get(); }
+    StringNode* getStringNode() const { return _stringNode; }
 
     /**
      * @brief Prints the node to standard output
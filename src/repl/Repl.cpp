@@ -62,14 +62,15 @@ void Repl::run(const std::string& source) {
         }
     }
 
-    Lexer              lexer(source);
-    std::vector<Token> tokens = lexer.scanTokens();
+    Lexer lexer(source);
+    lexer.useSymbols(this->_symbols);
+    lexer.scanTokens();
 
     spdlog::info("Tokenizing source code");
     spdlog::info("----------------------------------------");
     lexer.printTokens();
     spdlog::info("----------------------------------------");
-    Parser parser(tokens);
+    Parser parser(lexer.releaseTokens(), &lexer.getLiterals(), &this->_symbols);
     parser.printAST();
     spdlog::info("----------------------------------------");
 }
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include "opal/lexer/SymbolTable.hpp"
 #include "opal/repl/signal/ReplSignalManager.hpp"
 
 #include <string>
@@ -36,6 +37,7 @@ namespace opal {
 class Repl {
 private:
     ReplSignalManager _signalManager;
+    SymbolTable       _symbols;  ///< Names interned across every line of the session
 
     /**
      * @brief Executes the provided source code
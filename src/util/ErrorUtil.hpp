@@ -21,6 +21,9 @@
 
 #pragma once
 
+#include "opal/lexer/LineIndex.hpp"
+
+#include <cstddef>
 #include <string>
 
 namespace opal {
@@ -50,6 +53,22 @@ public:
     static std::string errorMessage(const std::string& message, int line, int column) {
         return message + " at line " + std::to_string(line) + ", column " + std::to_string(column);
     }
+
+    /**
+     * @brief Creates a formatted error message located by a byte offset
+     *
+     * The line and column are only resolved here, so callers can carry plain
+     * offsets until an error is actually reported.
+     *
+     * @param message The error message
+     * @param lines The line index of the source the offset refers to
+     * @param offset The byte offset where the error occurred
+     * @return std::string A formatted error message with location information
+     */
+    static std::string errorMessage(const std::string& message, const LineIndex& lines, size_t offset) {
+        SourcePosition position = lines.resolve(offset);
+        return errorMessage(message, position.line, position.column);
+    }
 };
 
 }  // namespace opal
\ No newline at end of file
@@ -23,6 +23,11 @@
 
 #include <spdlog/spdlog.h>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -44,6 +49,38 @@ std::string FileUtil::readFile(const std::string& filepath) {
     return buffer.str();
 }
 
+MappedFile FileUtil::mapFile(const std::string& filepath) {
+    if (!std::filesystem::is_regular_file(filepath)) {
+        throw std::runtime_error("The specified path is not a regular file: " + filepath);
+    }
+
+    int descriptor = open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0) {
+        throw std::runtime_error("Could not open file: " + filepath);
+    }
+
+    struct stat info = {};
+    if (fstat(descriptor, &info) != 0) {
+        close(descriptor);
+        throw std::runtime_error("Could not read file size: " + filepath);
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    if (size == 0) {
+        close(descriptor);
+        return MappedFile();
+    }
+
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error("Could not map file: " + filepath);
+    }
+
+    madvise(data, size, MADV_SEQUENTIAL);
+    return MappedFile(static_cast<const char*>(data), size);
+}
+
 void FileUtil::writeFile(const std::string& filepath, const std::string& content) {
     std::ofstream file(filepath);
     if (!file.is_open()) {
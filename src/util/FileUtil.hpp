@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include "opal/util/MappedFile.hpp"
+
 #include <string>
 
 namespace opal {
@@ -48,6 +50,19 @@ public:
      */
     static std::string readFile(const std::string& filepath);
 
+    /**
+     * @brief Maps the entire content of a file into memory, read-only
+     *
+     * Avoids copying the file: the pages are loaded on first access and the
+     * kernel is told they will be read sequentially. Suited to large sources,
+     * which can then be lexed in place through Lexer(std::string_view).
+     *
+     * @param filepath Path to the file to map
+     * @return MappedFile The mapping, which must outlive any view of it
+     * @throws std::runtime_error If the file cannot be opened or mapped
+     */
+    static MappedFile mapFile(const std::string& filepath);
+
     /**
      * @brief Writes content to a file
      * @param filepath Path to the file to write
@@ -0,0 +1,81 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/util/HashUtil.hpp"
+
+#include <cstring>
+
+using namespace opal;
+
+uint64_t HashUtil::hash64(std::string_view data, uint64_t seed) {
+    constexpr uint64_t multiplier = 0xc6a4a7935bd1e995ULL;
+    constexpr int      shift      = 47;
+
+    const char* bytes  = data.data();
+    size_t      length = data.size();
+    uint64_t    hash   = seed ^ (length * multiplier);
+
+    size_t words = length / 8;
+    for (size_t i = 0; i < words; i++) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i * 8, sizeof(word));
+
+        word *= multiplier;
+        word ^= word >> shift;
+        word *= multiplier;
+
+        hash ^= word;
+        hash *= multiplier;
+    }
+
+    const unsigned char* tail = reinterpret_cast<const unsigned char*>(bytes + words * 8);
+    switch (length & 7) {
+        case 7:
+            hash ^= static_cast<uint64_t>(tail[6]) << 48;
+            [[fallthrough]];
+        case 6:
+            hash ^= static_cast<uint64_t>(tail[5]) << 40;
+            [[fallthrough]];
+        case 5:
+            hash ^= static_cast<uint64_t>(tail[4]) << 32;
+            [[fallthrough]];
+        case 4:
+            hash ^= static_cast<uint64_t>(tail[3]) << 24;
+            [[fallthrough]];
+        case 3:
+            hash ^= static_cast<uint64_t>(tail[2]) << 16;
+            [[fallthrough]];
+        case 2:
+            hash ^= static_cast<uint64_t>(tail[1]) << 8;
+            [[fallthrough]];
+        case 1:
+            hash ^= static_cast<uint64_t>(tail[0]);
+            hash *= multiplier;
+            break;
+        default:
+            break;
+    }
+
+    hash ^= hash >> shift;
+    hash *= multiplier;
+    hash ^= hash >> shift;
+    return hash;
+}
@@ -0,0 +1,57 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace opal {
+
+/**
+ * @class HashUtil
+ * @brief Fast non-cryptographic hashing of byte ranges
+ *
+ * Meant for content addressing, such as keying caches by source text, not
+ * for anything an adversary could exploit. This class cannot be instantiated.
+ */
+class HashUtil {
+private:
+    HashUtil()                           = delete;
+    ~HashUtil()                          = delete;
+    HashUtil(const HashUtil&)            = delete;
+    HashUtil& operator=(const HashUtil&) = delete;
+
+public:
+    /**
+     * @brief Hashes a byte range into 64 bits
+     *
+     * MurmurHash64A over 8-byte words, so the result depends on the byte
+     * order of the machine.
+     *
+     * @param data The bytes to hash
+     * @param seed Seed mixed into the hash
+     * @return uint64_t The hash value
+     */
+    static uint64_t hash64(std::string_view data, uint64_t seed = 0);
+};
+
+}  // namespace opal
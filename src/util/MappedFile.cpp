@@ -0,0 +1,48 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/util/MappedFile.hpp"
+
+#include <sys/mman.h>
+
+#include <utility>
+
+using namespace opal;
+
+MappedFile::~MappedFile() {
+    if (this->_data != nullptr) {
+        munmap(const_cast<char*>(this->_data), this->_size);
+    }
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        if (this->_data != nullptr) {
+            munmap(const_cast<char*>(this->_data), this->_size);
+        }
+        this->_data = std::exchange(other._data, nullptr);
+        this->_size = std::exchange(other._size, 0);
+    }
+    return *this;
+}
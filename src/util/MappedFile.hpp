@@ -0,0 +1,89 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace opal {
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file
+ *
+ * Owns the mapping and releases it on destruction. Views and tokens taken
+ * from the mapping are only valid while the MappedFile is alive. This class
+ * can be moved but not copied.
+ */
+class MappedFile {
+private:
+    const char* _data = nullptr;
+    size_t      _size = 0;
+
+public:
+    /**
+     * @brief Constructs an empty MappedFile object
+     */
+    MappedFile() = default;
+
+    /**
+     * @brief Takes ownership of an existing mapping
+     * @param data Start of the mapping, or nullptr for an empty file
+     * @param size Length of the mapping in bytes
+     */
+    MappedFile(const char* data, size_t size) : _data(data), _size(size) {}
+
+    /**
+     * @brief Unmaps the file
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Moves a mapping, leaving the source empty
+     * @param other The mapping to move from
+     */
+    MappedFile(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Releases the current mapping and takes over another one
+     * @param other The mapping to move from
+     * @return MappedFile& This mapping
+     */
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Gets the mapped content
+     * @return std::string_view View over the whole file
+     */
+    std::string_view view() const { return std::string_view(_data, _size); }
+
+    /**
+     * @brief Gets the size of the mapped file
+     * @return size_t The size in bytes
+     */
+    size_t size() const { return _size; }
+};
+
+}  // namespace opal
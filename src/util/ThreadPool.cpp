@@ -0,0 +1,68 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/util/ThreadPool.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+using namespace opal;
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    this->_workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        this->_workers.emplace_back([this]() { this->work(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(this->_mutex);
+        this->_stopping = true;
+    }
+    this->_available.notify_all();
+
+    for (std::thread& worker : this->_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::work() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+            this->_available.wait(lock, [this]() { return this->_stopping || !this->_tasks.empty(); });
+            if (this->_tasks.empty()) {
+                return;
+            }
+            task = std::move(this->_tasks.front());
+            this->_tasks.pop();
+        }
+        task();
+    }
+}
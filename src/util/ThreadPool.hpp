@@ -0,0 +1,95 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace opal {
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size pool of worker threads running submitted tasks in FIFO order
+ *
+ * Workers are started on construction and joined on destruction, after the
+ * tasks already queued have run. This class cannot be copied.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread>          _workers;
+    std::queue<std::function<void()>> _tasks;
+    std::mutex                        _mutex;
+    std::condition_variable           _available;
+    bool                              _stopping = false;
+
+    /**
+     * @brief Runs queued tasks until the pool is stopping and the queue is empty
+     */
+    void work();
+
+public:
+    /**
+     * @brief Constructs a new ThreadPool object
+     * @param threadCount Number of worker threads, 0 to use one per hardware thread
+     */
+    explicit ThreadPool(size_t threadCount = 0);
+
+    /**
+     * @brief Runs the remaining tasks and joins the workers
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queues a task for execution on a worker thread
+     * @param task The callable to run
+     * @return std::future Future holding the result or the exception of the task
+     */
+    template <typename Task>
+    std::future<std::invoke_result_t<Task>> submit(Task task) {
+        auto packaged = std::make_shared<std::packaged_task<std::invoke_result_t<Task>()>>(std::move(task));
+        std::future<std::invoke_result_t<Task>> result = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_tasks.emplace([packaged]() { (*packaged)(); });
+        }
+        this->_available.notify_one();
+        return result;
+    }
+
+    /**
+     * @brief Gets the number of worker threads
+     * @return size_t The worker count
+     */
+    size_t size() const { return this->_workers.size(); }
+};
+
+}  // namespace opal
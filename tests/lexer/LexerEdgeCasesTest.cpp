@@ -194,6 +194,13 @@ TEST_F(LexerEdgeCasesTest, UnicodeCharacters) {
     EXPECT_EQ(tokens[0].value, "Caractères Unicode: 你好, こんにちは, Привет");
 }
 
+TEST_F(LexerEdgeCasesTest, SourceOverTheSizeLimitIsRejected) {
+    // Rejected on its size alone, so the view is never read
+    std::string_view oversized("x", Lexer::MAX_SOURCE_SIZE + 1);
+
+    EXPECT_THROW({ Lexer lexer(oversized); }, std::runtime_error);
+}
+
 // TEST_F(LexerEdgeCasesTest, DecimalNumbersWithMultipleDots) {
 //     Lexer lexer("123.456.789");
 //     EXPECT_THROW({
@@ -0,0 +1,115 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/LexDiagnostics.hpp"
+#include "opal/lexer/Lexer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class LexerRecoveryTest : public ::testing::Test {
+protected:
+    static std::string thrownMessage(const std::string& source) {
+        try {
+            Lexer lexer(source);
+            lexer.scanTokens();
+        } catch (const std::runtime_error& e) {
+            return e.what();
+        }
+        return "";
+    }
+
+    static std::vector<Token> errorTokens(const std::vector<Token>& tokens) {
+        std::vector<Token> errors;
+        for (const Token& token : tokens) {
+            if (token.type == TokenType::ERROR) {
+                errors.push_back(token);
+            }
+        }
+        return errors;
+    }
+};
+
+TEST_F(LexerRecoveryTest, CollectsEveryError) {
+    Lexer lexer("x = 1 @@ y\nz = ` 2\nw = \"open");
+    lexer.setErrorMode(Lexer::ErrorMode::RECOVER);
+    std::vector<Token> tokens = lexer.scanTokens();
+
+    std::vector<Token> errors = errorTokens(tokens);
+    ASSERT_EQ(errors.size(), 3u);
+    ASSERT_EQ(lexer.getDiagnostics().size(), 3u);
+
+    EXPECT_EQ(errors[0].value, "@@");
+    EXPECT_EQ(errors[1].value, "`");
+    EXPECT_EQ(errors[2].value, "\"open");
+    EXPECT_EQ(lexer.getDiagnostics().get(errors[0].payload).kind, LexErrorKind::INVALID_CHARACTER);
+    EXPECT_EQ(lexer.getDiagnostics().get(errors[2].payload).kind, LexErrorKind::UNTERMINATED_STRING);
+
+    // Tokens after each error are still produced
+    EXPECT_EQ(tokens[4].value, "y");
+    EXPECT_EQ(tokens[5].value, "z");
+    EXPECT_EQ(tokens.back().type, TokenType::EOF_TOKEN);
+}
+
+TEST_F(LexerRecoveryTest, DiagnosticsMatchThrownMessages) {
+    for (const std::string source : {"x = 1\n  $", "a = \"open\nline", "b /* open /* nested */", "c = ?d"}) {
+        Lexer lexer(source);
+        lexer.setErrorMode(Lexer::ErrorMode::RECOVER);
+        lexer.scanTokens();
+
+        ASSERT_EQ(lexer.getDiagnostics().size(), 1u) << source;
+        EXPECT_EQ(lexer.formatDiagnostic(lexer.getDiagnostics().get(0)), thrownMessage(source)) << source;
+    }
+}
+
+TEST_F(LexerRecoveryTest, UnterminatedCommentRunsToTheEnd) {
+    Lexer lexer("a = 1 /* never closed\nb = 2");
+    lexer.setErrorMode(Lexer::ErrorMode::RECOVER);
+    std::vector<Token> tokens = lexer.scanTokens();
+
+    ASSERT_EQ(tokens.size(), 5u);
+    EXPECT_EQ(tokens[3].type, TokenType::ERROR);
+    EXPECT_EQ(tokens[3].value, "/* never closed\nb = 2");
+    EXPECT_EQ(lexer.getDiagnostics().get(tokens[3].payload).kind, LexErrorKind::UNTERMINATED_COMMENT);
+}
+
+TEST_F(LexerRecoveryTest, StreamingRecovers) {
+    Lexer lexer("a @ b");
+    lexer.setErrorMode(Lexer::ErrorMode::RECOVER);
+
+    EXPECT_EQ(lexer.next().value, "a");
+    EXPECT_EQ(lexer.next().type, TokenType::ERROR);
+    EXPECT_EQ(lexer.next().value, "b");
+    EXPECT_EQ(lexer.next().type, TokenType::EOF_TOKEN);
+    EXPECT_EQ(lexer.getDiagnostics().size(), 1u);
+}
+
+TEST_F(LexerRecoveryTest, ThrowsByDefault) {
+    Lexer lexer("x = @");
+    EXPECT_THROW(lexer.scanTokens(), std::runtime_error);
+}
+
+}  // namespace opal::Test
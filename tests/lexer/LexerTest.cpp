@@ -22,6 +22,8 @@
 #include "opal/lexer/Lexer.hpp"
 #include "opal/lexer/Token.hpp"
 #include "opal/lexer/TokenType.hpp"
+#include "opal/lexer/tokenizer/tokenizers/IdentifierTokenizer.hpp"
+#include "opal/lexer/tokenizer/tokenizers/OperatorTokenizer.hpp"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -534,3 +536,134 @@ TEST_F(LexerTest, ScanLoadStatements) {
     EXPECT_EQ(tokens[3].value, "math");
     EXPECT_EQ(tokens[4].type, TokenType::EOF_TOKEN);
 }
+
+TEST_F(LexerTest, TableDispatchMatchesLinearDispatch) {
+    const std::string source =
+        "const x = 10 / 2 // half\n"
+        "y = (x + 3.5) * -x % 4 ^ 2\n"
+        "/* outer /* nested */\n still comment */\n"
+        "s = \"multi\nline ${x}\" z <<= 1 >>= 2 a #= b && c || !d\n"
+        "for i in 0..10 { i++ j-- k != l == m <= n >= o < p > q }\n"
+        "arr[0], obj.field: value; ~mask & bits | flags";
+
+    Lexer              linearLexer(source, Lexer::DispatchMode::LINEAR);
+    Lexer              tableLexer(source, Lexer::DispatchMode::TABLE);
+    std::vector<Token> linear = linearLexer.scanTokens();
+    std::vector<Token> table  = tableLexer.scanTokens();
+
+    ASSERT_EQ(linear.size(), table.size());
+    for (size_t i = 0; i < linear.size(); i++) {
+        EXPECT_EQ(linear[i].type, table[i].type) << "token " << i;
+        EXPECT_EQ(linear[i].value, table[i].value) << "token " << i;
+        EXPECT_EQ(linear[i].line, table[i].line) << "token " << i;
+        EXPECT_EQ(linear[i].column, table[i].column) << "token " << i;
+    }
+}
+
+TEST_F(LexerTest, TableDispatchRejectsInvalidCharacters) {
+    for (const char* source : {"x = 1 @ 2", "a $ b", "`", "caf\xC3\xA9"}) {
+        Lexer linearLexer(source, Lexer::DispatchMode::LINEAR);
+        Lexer tableLexer(source, Lexer::DispatchMode::TABLE);
+
+        std::string linearError;
+        std::string tableError;
+        try {
+            linearLexer.scanTokens();
+        } catch (const std::runtime_error& e) {
+            linearError = e.what();
+        }
+        try {
+            tableLexer.scanTokens();
+        } catch (const std::runtime_error& e) {
+            tableError = e.what();
+        }
+
+        EXPECT_FALSE(tableError.empty()) << source;
+        EXPECT_EQ(linearError, tableError) << source;
+    }
+}
+
+static_assert(IdentifierTokenizer::lookupKeyword("continue") == TokenType::CONTINUE);
+static_assert(IdentifierTokenizer::lookupKeyword("classy") == TokenType::IDENTIFIER);
+static_assert(OperatorTokenizer::matchOperator('<', '<', '=').length == 3);
+static_assert(OperatorTokenizer::matchOperator('$', '\0', '\0').length == 0);
+
+TEST_F(LexerTest, ScanEveryKeyword) {
+    const std::vector<std::pair<std::string_view, TokenType>> keywords = {
+        {"class", TokenType::CLASS},     {"fn", TokenType::FN},           {"if", TokenType::IF},
+        {"elif", TokenType::ELIF},       {"else", TokenType::ELSE},       {"while", TokenType::WHILE},
+        {"for", TokenType::FOR},         {"foreach", TokenType::FOREACH}, {"in", TokenType::IN},
+        {"try", TokenType::TRY},         {"catch", TokenType::CATCH},     {"finally", TokenType::FINALLY},
+        {"ret", TokenType::RET},         {"this", TokenType::THIS},       {"true", TokenType::TRUE},
+        {"false", TokenType::FALSE},     {"nil", TokenType::NIL},         {"and", TokenType::AND},
+        {"or", TokenType::OR},           {"not", TokenType::NOT},         {"const", TokenType::CONST},
+        {"enum", TokenType::ENUM},       {"switch", TokenType::SWITCH},   {"case", TokenType::CASE},
+        {"default", TokenType::DEFAULT}, {"break", TokenType::BREAK},     {"continue", TokenType::CONTINUE},
+        {"load", TokenType::LOAD}};
+
+    for (const std::pair<std::string_view, TokenType>& keyword : keywords) {
+        EXPECT_EQ(IdentifierTokenizer::lookupKeyword(keyword.first), keyword.second) << keyword.first;
+    }
+
+    for (std::string_view word : {"f", "fo", "iff", "Class", "elsif", "thus", "constant", "continues", "_if", "x"}) {
+        EXPECT_EQ(IdentifierTokenizer::lookupKeyword(word), TokenType::IDENTIFIER) << word;
+    }
+}
+
+TEST_F(LexerTest, ScanOperatorsLongestMatch) {
+    Lexer              lexer("<<= << <= < >>= >> >= > ... .. . += ++ + -= -- - &= && & |= || | #= # ^= ^ != ! == = ~");
+    std::vector<Token> tokens = lexer.scanTokens();
+
+    const std::vector<TokenType> expected = {
+        TokenType::SHIFT_LEFT_EQUAL,  TokenType::SHIFT_LEFT,  TokenType::LESS_EQUAL,    TokenType::LESS,
+        TokenType::SHIFT_RIGHT_EQUAL, TokenType::SHIFT_RIGHT, TokenType::GREATER_EQUAL, TokenType::GREATER,
+        TokenType::RANGE,             TokenType::DOT,         TokenType::RANGE,         TokenType::DOT,
+        TokenType::PLUS_EQUAL,        TokenType::INCREMENT,   TokenType::PLUS,          TokenType::MINUS_EQUAL,
+        TokenType::DECREMENT,         TokenType::MINUS,       TokenType::AND_EQUAL,     TokenType::AND,
+        TokenType::BITWISE_AND,       TokenType::OR_EQUAL,    TokenType::OR,            TokenType::BITWISE_OR,
+        TokenType::XOR_EQUAL,         TokenType::BITWISE_XOR, TokenType::POWER_EQUAL,   TokenType::POWER,
+        TokenType::NOT_EQUAL,         TokenType::NOT,         TokenType::EQUAL_EQUAL,   TokenType::EQUAL,
+        TokenType::BITWISE_NOT,       TokenType::EOF_TOKEN};
+
+    ASSERT_EQ(tokens.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(tokens[i].type, expected[i]) << "token " << i << " '" << tokens[i].value << "'";
+    }
+    EXPECT_EQ(tokens[0].value, "<<=");
+    EXPECT_EQ(tokens[8].value, "..");
+}
+
+TEST_F(LexerTest, NextMatchesScanTokens) {
+    const std::string source =
+        "const x = 10 / 2 // half\n"
+        "/* block */ s = \"multi\nline {x}\" y = (x + 3.5) * -x\n"
+        "for i in 0..10 { i++ }";
+
+    Lexer              batchLexer(source);
+    std::vector<Token> expected = batchLexer.scanTokens();
+
+    Lexer streamingLexer(source);
+    for (size_t i = 0; i < expected.size(); i++) {
+        Token token = streamingLexer.next();
+        EXPECT_EQ(token.type, expected[i].type) << "token " << i;
+        EXPECT_EQ(token.value, expected[i].value) << "token " << i;
+        EXPECT_EQ(token.line, expected[i].line) << "token " << i;
+        EXPECT_EQ(token.column, expected[i].column) << "token " << i;
+    }
+
+    EXPECT_EQ(streamingLexer.next().type, TokenType::EOF_TOKEN);
+    EXPECT_EQ(streamingLexer.next().type, TokenType::EOF_TOKEN);
+}
+
+TEST_F(LexerTest, ReleaseTokensHandsOverTheArray) {
+    Lexer                     lexer("x = 1 + y");
+    const std::vector<Token>& scanned = lexer.scanTokens();
+    const Token*              data    = scanned.data();
+    size_t                    count   = scanned.size();
+
+    std::vector<Token> released = lexer.releaseTokens();
+
+    EXPECT_EQ(released.data(), data);
+    EXPECT_EQ(released.size(), count);
+    EXPECT_EQ(released.back().type, TokenType::EOF_TOKEN);
+}
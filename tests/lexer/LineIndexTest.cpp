@@ -0,0 +1,129 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/LineIndex.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/util/ErrorUtil.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opal::Test {
+
+class LineIndexTest : public ::testing::Test {
+protected:
+    static SourcePosition naivePosition(const std::string& source, size_t offset) {
+        SourcePosition position = {1, 1};
+        for (size_t i = 0; i < offset; i++) {
+            if (source[i] == '\n') {
+                position.line++;
+                position.column = 1;
+            } else {
+                position.column++;
+            }
+        }
+        return position;
+    }
+
+    static std::string errorOf(const std::string& source) {
+        try {
+            Lexer lexer(source);
+            lexer.scanTokens();
+        } catch (const std::runtime_error& e) {
+            return e.what();
+        }
+        return "";
+    }
+};
+
+TEST_F(LineIndexTest, ResolvesEveryOffset) {
+    const std::string source = "first\n\nthird line\r\n  \tfourth\nlast";
+    LineIndex         lines(source);
+    LineIndex::Cursor cursor(lines);
+
+    EXPECT_EQ(lines.lineCount(), 5u);
+    for (size_t offset = 0; offset <= source.size(); offset++) {
+        SourcePosition expected = naivePosition(source, offset);
+        SourcePosition resolved = lines.resolve(offset);
+        SourcePosition forward  = cursor.resolve(offset);
+
+        EXPECT_EQ(resolved.line, expected.line) << "offset " << offset;
+        EXPECT_EQ(resolved.column, expected.column) << "offset " << offset;
+        EXPECT_EQ(forward.line, expected.line) << "offset " << offset;
+        EXPECT_EQ(forward.column, expected.column) << "offset " << offset;
+    }
+}
+
+TEST_F(LineIndexTest, CursorMovesBackwards) {
+    const std::string source = "a\nb\nc\nd";
+    LineIndex         lines(source);
+    LineIndex::Cursor cursor(lines);
+
+    EXPECT_EQ(cursor.resolve(6).line, 4);
+    EXPECT_EQ(cursor.resolve(2).line, 2);
+    EXPECT_EQ(cursor.resolve(4).line, 3);
+    EXPECT_EQ(cursor.resolve(0).line, 1);
+}
+
+TEST_F(LineIndexTest, EmptySourceHasOneLine) {
+    LineIndex lines("");
+
+    EXPECT_EQ(lines.lineCount(), 1u);
+    EXPECT_EQ(lines.resolve(0).line, 1);
+    EXPECT_EQ(lines.resolve(0).column, 1);
+
+    LineIndex unmapped{std::string_view()};
+    EXPECT_EQ(unmapped.lineCount(), 1u);
+}
+
+TEST_F(LineIndexTest, TokensAfterMultiLineLexemesHaveExactColumns) {
+    Lexer              lexer("/* a\nbc */ x \"s\nt\" y");
+    std::vector<Token> tokens = lexer.scanTokens();
+
+    ASSERT_EQ(tokens.size(), 5u);
+    EXPECT_EQ(tokens[1].value, "x");
+    EXPECT_EQ(tokens[1].line, 2);
+    EXPECT_EQ(tokens[1].column, 7);
+    EXPECT_EQ(tokens[2].type, TokenType::STRING);
+    EXPECT_EQ(tokens[2].line, 2);
+    EXPECT_EQ(tokens[2].column, 9);
+    EXPECT_EQ(tokens[3].value, "y");
+    EXPECT_EQ(tokens[3].line, 3);
+    EXPECT_EQ(tokens[3].column, 4);
+}
+
+TEST_F(LineIndexTest, LexerErrorsAreLocatedFromOffsets) {
+    EXPECT_EQ(errorOf("x = 1\n  y @ 2"), "Invalid character '@' at line 2, column 5");
+    EXPECT_EQ(errorOf("a\n  \"open\nstring"), "Unterminated string at line 2, column 3");
+    EXPECT_EQ(errorOf("a /* open\ncomment"), "Unterminated multi-line comment at line 1, column 3");
+}
+
+TEST_F(LineIndexTest, ErrorUtilResolvesOffsets) {
+    LineIndex lines("ab\ncd");
+    EXPECT_EQ(ErrorUtil::errorMessage("Oops", lines, 4), "Oops at line 2, column 2");
+}
+
+}  // namespace opal::Test
@@ -0,0 +1,102 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/LiteralTable.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class LiteralTableTest : public ::testing::Test {};
+
+TEST_F(LiteralTableTest, DecodesIntegers) {
+    NumericLiteral literal;
+    ASSERT_TRUE(LiteralTable::decode("0", literal));
+    EXPECT_EQ(literal.kind, NumericKind::INT);
+    EXPECT_EQ(literal.integer, 0);
+
+    ASSERT_TRUE(LiteralTable::decode("9223372036854775807", literal));
+    EXPECT_EQ(literal.kind, NumericKind::INT);
+    EXPECT_EQ(literal.integer, INT64_MAX);
+}
+
+TEST_F(LiteralTableTest, DecodesFloats) {
+    NumericLiteral literal;
+    ASSERT_TRUE(LiteralTable::decode("3.14", literal));
+    EXPECT_EQ(literal.kind, NumericKind::FLOAT);
+    EXPECT_DOUBLE_EQ(literal.floating, 3.14);
+
+    ASSERT_TRUE(LiteralTable::decode("10.0", literal));
+    EXPECT_EQ(literal.kind, NumericKind::FLOAT);
+    EXPECT_DOUBLE_EQ(literal.floating, 10.0);
+}
+
+TEST_F(LiteralTableTest, RejectsOutOfRangeAndMalformedLexemes) {
+    NumericLiteral literal;
+    EXPECT_FALSE(LiteralTable::decode("9223372036854775808", literal));
+    EXPECT_FALSE(LiteralTable::decode("12ab", literal));
+    EXPECT_FALSE(LiteralTable::decode("", literal));
+}
+
+TEST_F(LiteralTableTest, LexerStoresDecodedValues) {
+    Lexer              lexer("x = 42 + 2.5\ny = x");
+    std::vector<Token> tokens = lexer.scanTokens();
+
+    ASSERT_EQ(lexer.getLiterals().size(), 2u);
+    for (const Token& token : tokens) {
+        bool decoded = token.type == TokenType::NUMBER || token.type == TokenType::IDENTIFIER;
+        EXPECT_EQ(token.hasPayload(), decoded) << token.value;
+    }
+
+    const NumericLiteral& integer = lexer.getLiterals().get(tokens[2].payload);
+    EXPECT_EQ(integer.kind, NumericKind::INT);
+    EXPECT_EQ(integer.integer, 42);
+
+    const NumericLiteral& floating = lexer.getLiterals().get(tokens[4].payload);
+    EXPECT_EQ(floating.kind, NumericKind::FLOAT);
+    EXPECT_DOUBLE_EQ(floating.floating, 2.5);
+}
+
+TEST_F(LiteralTableTest, TokenBufferKeepsPayloads) {
+    Lexer       lexer("x = 7 * 1.5");
+    TokenBuffer buffer = lexer.scanTokenBuffer();
+
+    ASSERT_EQ(buffer.literals(), &lexer.getLiterals());
+    EXPECT_EQ(buffer.literals()->get(buffer.payload(2)).integer, 7);
+    EXPECT_DOUBLE_EQ(buffer.literals()->get(buffer.toToken(4).payload).floating, 1.5);
+    EXPECT_EQ(buffer.payload(1), Token::NO_PAYLOAD);
+}
+
+TEST_F(LiteralTableTest, LexerLeavesOutOfRangeLiteralsUndecoded) {
+    Lexer              lexer("x = 99999999999999999999");
+    std::vector<Token> tokens = lexer.scanTokens();
+
+    ASSERT_EQ(tokens[2].type, TokenType::NUMBER);
+    EXPECT_FALSE(tokens[2].hasPayload());
+    EXPECT_EQ(lexer.getLiterals().size(), 0u);
+}
+
+}  // namespace opal::Test
@@ -0,0 +1,158 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/ParallelLexer.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class ParallelLexerTest : public ::testing::Test {
+protected:
+    static std::string generateSource(int statements) {
+        std::string source;
+        for (int i = 0; i < statements; i++) {
+            std::string index = std::to_string(i);
+            source += "value_" + index + " = (" + index + " * 3.14) + other_" + index + "\n";
+            if (i % 97 == 0) {
+                // Block comments and strings spanning many lines, with lines that would not lex on their own
+                source += "/* outer " + index + "\n /* nested @ */\n\"not a string\n";
+                for (int line = 0; line < 40; line++) {
+                    source += "   still $ inside the comment\n";
+                }
+                source += "*/ after_" + index + " = 1\n";
+                source += "text_" + index + " = \"first line\n";
+                for (int line = 0; line < 40; line++) {
+                    source += "  /* not a comment ` \n";
+                }
+                source += "last line\" tail_" + index + "\n";
+            }
+        }
+        return source;
+    }
+
+    static void expectSameAsSequential(const std::string& source, size_t threadCount) {
+        Lexer              sequential(source);
+        std::vector<Token> expected = sequential.scanTokens();
+
+        ParallelLexer      parallel(source, threadCount);
+        std::vector<Token> actual = parallel.scanTokens();
+
+        ASSERT_EQ(actual.size(), expected.size()) << threadCount << " threads";
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(actual[i].type, expected[i].type) << "token " << i;
+            ASSERT_EQ(actual[i].value, expected[i].value) << "token " << i;
+            ASSERT_EQ(actual[i].line, expected[i].line) << "token " << i;
+            ASSERT_EQ(actual[i].column, expected[i].column) << "token " << i;
+            ASSERT_EQ(actual[i].hasPayload(), expected[i].hasPayload()) << "token " << i;
+            if (expected[i].type == TokenType::IDENTIFIER) {
+                ASSERT_EQ(parallel.getSymbols().name(actual[i].payload),
+                          sequential.getSymbols().name(expected[i].payload))
+                    << "token " << i;
+            } else if (expected[i].hasPayload()) {
+                const NumericLiteral& want = sequential.getLiterals().get(expected[i].payload);
+                const NumericLiteral& got  = parallel.getLiterals().get(actual[i].payload);
+                ASSERT_EQ(got.kind, want.kind) << "token " << i;
+                ASSERT_EQ(got.integer, want.integer) << "token " << i;
+            }
+        }
+        EXPECT_EQ(parallel.getLiterals().size(), sequential.getLiterals().size());
+        EXPECT_EQ(parallel.getSymbols().size(), sequential.getSymbols().size());
+    }
+
+    static std::string errorOf(const std::string& source, size_t threadCount) {
+        try {
+            if (threadCount == 0) {
+                Lexer lexer(source);
+                lexer.scanTokens();
+            } else {
+                ParallelLexer lexer(source, threadCount);
+                lexer.scanTokens();
+            }
+        } catch (const std::runtime_error& e) {
+            return e.what();
+        }
+        return "";
+    }
+};
+
+TEST_F(ParallelLexerTest, SmallSourceMatchesSequential) {
+    expectSameAsSequential("x = 1\ny = \"two\nlines\" /* c */ z", 4);
+    expectSameAsSequential("", 4);
+}
+
+TEST_F(ParallelLexerTest, LargeSourceMatchesSequential) {
+    const std::string source = generateSource(4000);
+    ASSERT_GT(source.size(), 8u * 16 * 1024);
+
+    for (size_t threadCount : {1, 2, 3, 4, 8}) {
+        expectSameAsSequential(source, threadCount);
+    }
+}
+
+TEST_F(ParallelLexerTest, ReportsTheFirstErrorInSourceOrder) {
+    const std::string source =
+        generateSource(2000) + "bad @ here\n" + generateSource(1000) + "worse ` here\n" + generateSource(1000);
+
+    std::string expected = errorOf(source, 0);
+    ASSERT_FALSE(expected.empty());
+    for (size_t threadCount : {1, 2, 4, 8}) {
+        EXPECT_EQ(errorOf(source, threadCount), expected) << threadCount << " threads";
+    }
+}
+
+TEST_F(ParallelLexerTest, ReportsUnterminatedLexemes) {
+    std::string source = generateSource(4000);
+
+    EXPECT_EQ(errorOf(source + "s = \"open\n" + source, 4), errorOf(source + "s = \"open\n" + source, 0));
+    EXPECT_EQ(errorOf(source + "/* open\n" + source, 4), errorOf(source + "/* open\n" + source, 0));
+}
+
+TEST_F(ParallelLexerTest, RecoversLikeTheSequentialLexer) {
+    const std::string source = generateSource(2000) + "bad @@ here\n" + generateSource(1000) + "worse ` here\n"
+                               + generateSource(1000) + "s = \"open\n";
+
+    Lexer sequential(source);
+    sequential.setErrorMode(Lexer::ErrorMode::RECOVER);
+    std::vector<Token> expected = sequential.scanTokens();
+    ASSERT_EQ(sequential.getDiagnostics().size(), 3u);
+
+    for (size_t threadCount : {1, 2, 4, 8}) {
+        ParallelLexer parallel(source, threadCount);
+        parallel.setErrorMode(Lexer::ErrorMode::RECOVER);
+        std::vector<Token> actual = parallel.scanTokens();
+
+        ASSERT_EQ(actual.size(), expected.size()) << threadCount << " threads";
+        ASSERT_EQ(parallel.getDiagnostics().size(), 3u) << threadCount << " threads";
+        for (size_t i = 0; i < 3; i++) {
+            EXPECT_EQ(parallel.formatDiagnostic(parallel.getDiagnostics().get(static_cast<uint32_t>(i))),
+                      sequential.formatDiagnostic(sequential.getDiagnostics().get(static_cast<uint32_t>(i))));
+        }
+    }
+}
+
+}  // namespace opal::Test
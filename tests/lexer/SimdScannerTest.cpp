@@ -0,0 +1,126 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/SimdScanner.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace opal;
+
+class SimdScannerTest : public ::testing::Test {
+protected:
+    void TearDown() override { SimdScanner::setLevel(SimdScanner::detectLevel()); }
+
+    static std::string randomText(std::mt19937& rng, size_t length, const std::string& alphabet) {
+        std::uniform_int_distribution<size_t> pick(0, alphabet.size() - 1);
+        std::string                           text(length, ' ');
+        for (char& c : text) {
+            c = alphabet[pick(rng)];
+        }
+        return text;
+    }
+
+    static size_t referenceRun(const std::string& text, size_t begin, bool (*accept)(char)) {
+        size_t i = begin;
+        while (i < text.size() && accept(text[i])) {
+            i++;
+        }
+        return i - begin;
+    }
+};
+
+TEST_F(SimdScannerTest, KernelsMatchScalarReference) {
+    const std::string alphabet = std::string("  \t\r\n\"_azAZ09$-.") + "\xC3\xA9";
+    std::mt19937      rng(42);
+
+    for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2}) {
+        SimdScanner::setLevel(level);
+
+        for (size_t length : {0, 1, 15, 16, 17, 31, 32, 33, 100, 257}) {
+            for (int round = 0; round < 20; round++) {
+                std::string text  = randomText(rng, length, alphabet);
+                size_t      begin = length == 0 ? 0 : rng() % length;
+
+                const char* data      = text.data() + begin;
+                size_t      remaining = text.size() - begin;
+
+                EXPECT_EQ(SimdScanner::skipWhitespace(data, remaining),
+                          referenceRun(text, begin, [](char c) { return c == ' ' || c == '\t' || c == '\r'; }));
+                EXPECT_EQ(SimdScanner::scanIdentifier(data, remaining),
+                          referenceRun(text, begin, [](char c) {
+                              return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')
+                                     || c == '_';
+                          }));
+                EXPECT_EQ(SimdScanner::findStringDelimiter(data, remaining),
+                          referenceRun(text, begin, [](char c) { return c != '"' && c != '\n'; }));
+                EXPECT_EQ(SimdScanner::countNewlines(data, remaining),
+                          static_cast<size_t>(std::count(text.begin() + begin, text.end(), '\n')));
+            }
+        }
+    }
+}
+
+TEST_F(SimdScannerTest, LongRunsAreScannedToTheEnd) {
+    std::string identifier(1000, 'a');
+    identifier += '+';
+    std::string whitespace(1000, '\t');
+    whitespace += 'x';
+    std::string body(1000, 'z');
+    body += '"';
+
+    EXPECT_EQ(SimdScanner::scanIdentifier(identifier.data(), identifier.size()), 1000u);
+    EXPECT_EQ(SimdScanner::skipWhitespace(whitespace.data(), whitespace.size()), 1000u);
+    EXPECT_EQ(SimdScanner::findStringDelimiter(body.data(), body.size()), 1000u);
+
+    // Enough 32-byte blocks to overflow the per-byte counters if they were never flushed
+    std::string newlines(40000, '\n');
+    for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2}) {
+        SimdScanner::setLevel(level);
+        EXPECT_EQ(SimdScanner::countNewlines(newlines.data(), newlines.size()), 40000u);
+    }
+}
+
+TEST_F(SimdScannerTest, LexerOutputDoesNotDependOnLevel) {
+    const std::string source = "        very_long_identifier_name_that_spans_kernels = \"a long string literal body that "
+                               "is wider than one vector\nand spans a line\" next\n\t\t  other";
+
+    SimdScanner::setLevel(SimdLevel::SCALAR);
+    Lexer              scalarLexer(source);
+    std::vector<Token> expected = scalarLexer.scanTokens();
+
+    SimdScanner::setLevel(SimdScanner::detectLevel());
+    Lexer              vectorLexer(source);
+    std::vector<Token> actual = vectorLexer.scanTokens();
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].type, actual[i].type);
+        EXPECT_EQ(expected[i].value, actual[i].value);
+        EXPECT_EQ(expected[i].line, actual[i].line);
+        EXPECT_EQ(expected[i].column, actual[i].column);
+    }
+}
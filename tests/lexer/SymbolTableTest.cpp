@@ -0,0 +1,96 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/SymbolTable.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class SymbolTableTest : public ::testing::Test {};
+
+TEST_F(SymbolTableTest, InternsEachNameOnce) {
+    SymbolTable symbols;
+    uint32_t    first  = symbols.intern("alpha");
+    uint32_t    second = symbols.intern("beta");
+
+    EXPECT_EQ(first, 0u);
+    EXPECT_EQ(second, 1u);
+    EXPECT_EQ(symbols.intern(std::string("alpha")), first);
+    EXPECT_EQ(symbols.size(), 2u);
+    EXPECT_EQ(symbols.name(second), "beta");
+    EXPECT_EQ(symbols.find("beta"), second);
+    EXPECT_EQ(symbols.find("gamma"), SymbolTable::NO_SYMBOL);
+}
+
+TEST_F(SymbolTableTest, NamesSurviveGrowthAndMoves) {
+    SymbolTable      symbols;
+    std::string      oversized(40 * 1024, 'x');
+    uint32_t         first = symbols.intern("first");
+    std::string_view name  = symbols.name(first);
+
+    for (int i = 0; i < 20000; i++) {
+        symbols.intern("name_" + std::to_string(i));
+    }
+    uint32_t big = symbols.intern(oversized);
+    symbols.intern("after_oversized");
+
+    SymbolTable moved = std::move(symbols);
+    EXPECT_EQ(name.data(), moved.name(first).data());
+    EXPECT_EQ(moved.name(first), "first");
+    EXPECT_EQ(moved.name(big), oversized);
+    EXPECT_EQ(moved.find("name_19999"), first + 20000);
+    EXPECT_EQ(moved.name(moved.find("after_oversized")), "after_oversized");
+}
+
+TEST_F(SymbolTableTest, LexerTagsIdentifiersWithSymbolIds) {
+    Lexer              lexer("count = count + total\nif total");
+    std::vector<Token> tokens = lexer.scanTokens();
+
+    EXPECT_EQ(tokens[0].payload, tokens[2].payload);
+    EXPECT_NE(tokens[0].payload, tokens[4].payload);
+    EXPECT_EQ(tokens[4].payload, tokens[6].payload);
+    EXPECT_EQ(lexer.getSymbols().name(tokens[4].payload), "total");
+    EXPECT_FALSE(tokens[5].hasPayload());
+    EXPECT_EQ(lexer.getSymbols().size(), 2u);
+}
+
+TEST_F(SymbolTableTest, LexersShareATable) {
+    SymbolTable symbols;
+
+    Lexer first("x = 1");
+    first.useSymbols(symbols);
+    std::vector<Token> firstTokens = first.scanTokens();
+
+    Lexer second("y = x");
+    second.useSymbols(symbols);
+    std::vector<Token> secondTokens = second.scanTokens();
+
+    EXPECT_EQ(secondTokens[2].payload, firstTokens[0].payload);
+    EXPECT_EQ(symbols.size(), 2u);
+}
+
+}  // namespace opal::Test
@@ -0,0 +1,88 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/TokenBuffer.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/LineIndex.hpp"
+#include "opal/lexer/Token.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class TokenBufferTest : public ::testing::Test {
+protected:
+    const std::string source = "const x = 10 / 2 // half\n"
+                               "s = \"multi\nline {x}\" y = (x + 3.5) * -x\n"
+                               "for i in 0..10 { i++ }";
+};
+
+TEST_F(TokenBufferTest, MatchesScanTokens) {
+    Lexer              vectorLexer(source);
+    std::vector<Token> tokens = vectorLexer.scanTokens();
+
+    Lexer       bufferLexer(source);
+    TokenBuffer buffer = bufferLexer.scanTokenBuffer();
+
+    ASSERT_EQ(buffer.size(), tokens.size());
+    for (size_t i = 0; i < tokens.size(); i++) {
+        TokenView view = buffer[i];
+        EXPECT_EQ(view.type(), tokens[i].type) << "token " << i;
+        EXPECT_EQ(view.value(), tokens[i].value) << "token " << i;
+        EXPECT_EQ(view.line(), tokens[i].line) << "token " << i;
+        EXPECT_EQ(view.column(), tokens[i].column) << "token " << i;
+    }
+    EXPECT_EQ(buffer.type(buffer.size() - 1), TokenType::EOF_TOKEN);
+    EXPECT_EQ(buffer.value(buffer.size() - 1), "EOF");
+}
+
+TEST_F(TokenBufferTest, UsesLessMemoryThanTokenVector) {
+    Lexer       lexer(source);
+    TokenBuffer buffer = lexer.scanTokenBuffer();
+
+    EXPECT_LT(buffer.memoryUsage(), buffer.size() * sizeof(Token));
+}
+
+TEST_F(TokenBufferTest, CursorYieldsTokensThenEof) {
+    Lexer       lexer("x = 1");
+    TokenBuffer buffer = lexer.scanTokenBuffer();
+
+    TokenBuffer::Cursor cursor(buffer);
+    EXPECT_EQ(cursor.next().type, TokenType::IDENTIFIER);
+    EXPECT_EQ(cursor.next().type, TokenType::EQUAL);
+    EXPECT_EQ(cursor.next().value, "1");
+    EXPECT_EQ(cursor.next().type, TokenType::EOF_TOKEN);
+    EXPECT_EQ(cursor.next().type, TokenType::EOF_TOKEN);
+}
+
+TEST_F(TokenBufferTest, RejectsForeignTokenValues) {
+    LineIndex   lines(source);
+    TokenBuffer buffer(source, lines);
+    EXPECT_THROW(buffer.push(Token(TokenType::IDENTIFIER, "elsewhere", 1, 1)), std::runtime_error);
+    EXPECT_NO_THROW(buffer.push(Token(TokenType::EOF_TOKEN, "EOF", 1, 1)));
+}
+
+}  // namespace opal::Test
@@ -0,0 +1,150 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/TokenCache.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/LineIndex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class TokenCacheTest : public ::testing::Test {
+protected:
+    const std::string directory = "token_cache_test";
+    const std::string source    = "x = 42\ny = x * 2.5\n/* note */\nmsg = \"hi ${y}\"\nz = x\n";
+
+    void SetUp() override { std::filesystem::remove_all(directory); }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    void expectSameAsLexer(const TokenCache::Entry& entry) const {
+        Lexer              lexer(source);
+        std::vector<Token> expected = lexer.scanTokens();
+
+        ASSERT_EQ(entry.tokens.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            Token actual = entry.tokens.toToken(i);
+            EXPECT_EQ(actual.type, expected[i].type) << "token " << i;
+            EXPECT_EQ(actual.value, expected[i].value) << "token " << i;
+            EXPECT_EQ(actual.line, expected[i].line) << "token " << i;
+            EXPECT_EQ(actual.column, expected[i].column) << "token " << i;
+            EXPECT_EQ(actual.payload, expected[i].payload) << "token " << i;
+        }
+        EXPECT_EQ(entry.symbols.size(), lexer.getSymbols().size());
+        EXPECT_EQ(entry.literals.size(), lexer.getLiterals().size());
+        EXPECT_DOUBLE_EQ(entry.literals.get(1).floating, 2.5);
+    }
+
+    void patchFile(const std::string& path, size_t offset, const void* bytes, size_t size) const {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+    }
+};
+
+TEST_F(TokenCacheTest, MissStoresAndHitLoads) {
+    LineIndex  lines(source);
+    TokenCache cache(directory);
+
+    EXPECT_EQ(cache.load(source, lines), nullptr);
+
+    std::unique_ptr<TokenCache::Entry> cold = cache.scan(source, lines);
+    ASSERT_NE(cold, nullptr);
+    expectSameAsLexer(*cold);
+    ASSERT_TRUE(std::filesystem::exists(cache.pathFor(source)));
+
+    std::unique_ptr<TokenCache::Entry> warm = cache.load(source, lines);
+    ASSERT_NE(warm, nullptr);
+    expectSameAsLexer(*warm);
+    EXPECT_EQ(warm->tokens.symbols(), &warm->symbols);
+}
+
+TEST_F(TokenCacheTest, EntriesAreKeyedByContent) {
+    TokenCache  cache(directory);
+    std::string edited = source + "w = 1\n";
+    LineIndex   lines(source);
+    LineIndex   editedLines(edited);
+
+    cache.scan(source, lines);
+    EXPECT_NE(cache.pathFor(edited), cache.pathFor(source));
+    EXPECT_EQ(cache.load(edited, editedLines), nullptr);
+    EXPECT_NE(cache.load(source, lines), nullptr);
+}
+
+TEST_F(TokenCacheTest, RejectsOtherFormatVersions) {
+    LineIndex  lines(source);
+    TokenCache cache(directory);
+    cache.scan(source, lines);
+
+    uint32_t version = TokenCache::FORMAT_VERSION + 1;
+    patchFile(cache.pathFor(source), 8, &version, sizeof(version));
+    EXPECT_EQ(cache.load(source, lines), nullptr);
+
+    // A scan replaces the stale entry
+    cache.scan(source, lines);
+    EXPECT_NE(cache.load(source, lines), nullptr);
+}
+
+TEST_F(TokenCacheTest, RejectsDamagedEntries) {
+    LineIndex  lines(source);
+    TokenCache cache(directory);
+    cache.scan(source, lines);
+
+    std::string path = cache.pathFor(source);
+    std::string intact;
+    {
+        std::ifstream file(path, std::ios::binary);
+        intact.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    std::filesystem::resize_file(path, intact.size() - 1);
+    EXPECT_EQ(cache.load(source, lines), nullptr);
+
+    // Point the first token offset past the end of the source, the offsets follow the 56-byte header and the types
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(intact.data(), intact.size());
+    uint32_t tokenCount = 0;
+    std::memcpy(&tokenCount, intact.data() + 32, sizeof(tokenCount));
+    size_t   offsets = (56 + tokenCount + 7) / 8 * 8;
+    uint32_t outside = static_cast<uint32_t>(source.size() + 1);
+    patchFile(path, offsets, &outside, sizeof(outside));
+    EXPECT_EQ(cache.load(source, lines), nullptr);
+
+    // Give the first literal a kind that does not exist, the literals follow the lengths and payloads
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(intact.data(), intact.size());
+    ASSERT_NE(cache.load(source, lines), nullptr);
+    size_t  lengths  = (offsets + tokenCount * 4 + 7) / 8 * 8;
+    size_t  payloads = (lengths + tokenCount * 4 + 7) / 8 * 8;
+    size_t  literals = (payloads + tokenCount * 4 + 7) / 8 * 8;
+    uint8_t unknown  = 7;
+    patchFile(path, literals, &unknown, sizeof(unknown));
+    EXPECT_EQ(cache.load(source, lines), nullptr);
+}
+
+}  // namespace opal::Test
@@ -0,0 +1,128 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/AstArena.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/node/NodeFactory.hpp"
+#include "opal/parser/node/nodes/LoadNode.hpp"
+#include "opal/parser/node/nodes/StringNode.hpp"
+#include "opal/parser/node/nodes/VariableNode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opal::Test {
+
+class AstArenaTest : public ::testing::Test {};
+
+TEST_F(AstArenaTest, AlignsAllocations) {
+    AstArena arena;
+    arena.allocate(1, 1);
+    void* aligned = arena.allocate(sizeof(uint64_t), alignof(uint64_t));
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % alignof(uint64_t), 0u);
+    EXPECT_EQ(arena.bytesUsed(), 1u + sizeof(uint64_t));
+    EXPECT_EQ(arena.blockCount(), 1u);
+}
+
+TEST_F(AstArenaTest, CopiesSurviveGrowthAndMoves) {
+    AstArena         arena;
+    std::string      text  = "first";
+    std::string_view first = arena.copyString(text);
+    text[0]                = 'F';
+
+    std::vector<Token>     large(10000, Token(TokenType::NUMBER, "1", 1, 1));
+    std::span<const Token> copied = arena.copyArray(std::span<const Token>(large));
+    for (int i = 0; i < 10000; i++) {
+        arena.copyString("name_" + std::to_string(i));
+    }
+
+    AstArena moved = std::move(arena);
+    EXPECT_EQ(first, "first");
+    ASSERT_EQ(copied.size(), large.size());
+    EXPECT_NE(copied.data(), large.data());
+    EXPECT_EQ(copied.back().value, "1");
+    EXPECT_GT(moved.blockCount(), 2u);
+}
+
+TEST_F(AstArenaTest, EmptyCopiesAllocateNothing) {
+    AstArena arena;
+
+    EXPECT_TRUE(arena.copyString("").empty());
+    EXPECT_TRUE(arena.copyArray(std::span<const Token>()).empty());
+    EXPECT_EQ(arena.blockCount(), 0u);
+}
+
+TEST_F(AstArenaTest, ClearReleasesEveryBlock) {
+    AstArena arena;
+    NodeFactory::createVariableNode(arena, "x", "42");
+    arena.clear();
+
+    EXPECT_EQ(arena.bytesUsed(), 0u);
+    EXPECT_EQ(arena.blockCount(), 0u);
+}
+
+TEST_F(AstArenaTest, NodeStringsViewTheSource) {
+    std::string source = "const x = 1\ny = x\nload \"module.op\"\nz = \"a ${x} b\"\n";
+    Lexer       lexer{std::string_view(source)};
+    Parser      parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    auto        inSource = [&](std::string_view text) {
+        return text.data() >= source.data() && text.data() + text.size() <= source.data() + source.size();
+    };
+
+    ASSERT_EQ(parser.getNodes().size(), 4u);
+    const auto* x    = dynamic_cast<const VariableNode*>(parser.getNodes()[0]);
+    const auto* y    = dynamic_cast<const VariableNode*>(parser.getNodes()[1]);
+    const auto* load = dynamic_cast<const LoadNode*>(parser.getNodes()[2]);
+    const auto* z    = dynamic_cast<const VariableNode*>(parser.getNodes()[3]);
+    ASSERT_NE(x, nullptr);
+    ASSERT_NE(y, nullptr);
+    ASSERT_NE(load, nullptr);
+    ASSERT_NE(z, nullptr);
+    EXPECT_TRUE(inSource(x->getName()));
+    EXPECT_TRUE(inSource(x->getValue()));
+    EXPECT_TRUE(inSource(y->getValue()));
+    EXPECT_TRUE(inSource(load->getPath()));
+
+    ASSERT_NE(z->getStringNode(), nullptr);
+    std::span<const StringSegment> segments = z->getStringNode()->getSegments();
+    ASSERT_EQ(segments.size(), 3u);
+    for (const StringSegment& segment : segments) {
+        EXPECT_TRUE(inSource(segment.content));
+    }
+}
+
+TEST_F(AstArenaTest, ParserKeepsNodesInItsArena) {
+    Lexer  lexer("x = 1\ny = (x + 2) * 3\nz = \"${x} and ${y}\"\n");
+    Parser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+
+    ASSERT_EQ(parser.getNodes().size(), 3u);
+    EXPECT_GT(parser.getArena().bytesUsed(), 3 * sizeof(VariableNode));
+    EXPECT_EQ(parser.getArena().blockCount(), 1u);
+}
+
+}  // namespace opal::Test
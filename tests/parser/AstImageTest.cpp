@@ -0,0 +1,314 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/flat/AstImage.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/flat/FlatAst.hpp"
+#include "opal/parser/flat/FlatAstConverter.hpp"
+#include "opal/parser/node/nodes/FunctionNode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace opal::Test {
+
+class AstImageTest : public ::testing::Test {
+protected:
+    const std::string source = "const x = 42\n"
+                               "y = (x + 2.5) * -x\n"
+                               "load \"lib/module.op\"\n"
+                               "z = f(x, y)++\n"
+                               "msg = \"value ${y} of ${x}\"\n";
+
+    // Describes a node, the FlatAst and the image giving the same description for the same node
+    static std::string describe(const FlatAst& ast, uint32_t id) {
+        const FlatNode& node = ast.node(id);
+        std::string     out  = std::to_string(static_cast<int>(node.kind)) + "/";
+        out += std::to_string(static_cast<int>(node.token));
+        switch (node.kind) {
+            case NodeType::VARIABLE: {
+                const FlatVariable& variable = ast.variable(id);
+                return out + " " + std::string(variable.name) + "=" + std::string(variable.value)
+                       + (variable.isConstant ? " const" : "") + " " + std::to_string(static_cast<int>(variable.type));
+            }
+            case NodeType::OPERATION:
+                for (const Token& token : ast.tokens(id)) {
+                    out += " " + std::string(token.value) + "@" + std::to_string(token.line) + ":"
+                           + std::to_string(token.column);
+                }
+                return out;
+            case NodeType::FUNCTION: {
+                const FlatFunction& function = ast.function(id);
+                out += " " + std::string(function.name) + (function.isParsed ? " parsed" : "") + " (";
+                for (std::string_view parameter : ast.parameters(id)) {
+                    out += " " + std::string(parameter);
+                }
+                out += " )";
+                for (const Token& token : ast.body(id)) {
+                    out += " " + std::string(token.value);
+                }
+                return out;
+            }
+            case NodeType::OPERAND:
+                return out + " " + std::string(ast.operand(id).value);
+            case NodeType::UNARY:
+                return out + (ast.isPostfix(id) ? " postfix" : " prefix");
+            case NodeType::STRING:
+                for (const StringSegment& segment : ast.segments(id)) {
+                    out += " " + std::to_string(static_cast<int>(segment.type)) + ":" + std::string(segment.content);
+                }
+                return out;
+            default:
+                return node.token == TokenType::LOAD ? out + " " + std::string(ast.path(id)) : out;
+        }
+    }
+
+    static std::string describe(const AstImage& image, uint32_t id) {
+        const AstImage::NodeRecord& node = image.node(id);
+        std::string                 out  = std::to_string(node.kind) + "/" + std::to_string(node.token);
+        switch (image.kind(id)) {
+            case NodeType::VARIABLE: {
+                const AstImage::VariableRecord& variable = image.variable(id);
+                return out + " " + std::string(image.string(variable.name)) + "="
+                       + std::string(image.string(variable.value)) + (variable.isConstant ? " const" : "") + " "
+                       + std::to_string(variable.type);
+            }
+            case NodeType::OPERATION:
+                for (const AstImage::TokenRecord& token : image.tokens(id)) {
+                    out += " " + std::string(image.string(token.value)) + "@" + std::to_string(token.line) + ":"
+                           + std::to_string(token.column);
+                }
+                return out;
+            case NodeType::FUNCTION: {
+                const AstImage::FunctionRecord& function = image.function(id);
+                out += " " + std::string(image.string(function.name)) + (function.isParsed ? " parsed" : "") + " (";
+                for (AstImage::StringRef parameter : image.parameters(id)) {
+                    out += " " + std::string(image.string(parameter));
+                }
+                out += " )";
+                for (const AstImage::TokenRecord& token : image.body(id)) {
+                    out += " " + std::string(image.string(token.value));
+                }
+                return out;
+            }
+            case NodeType::OPERAND:
+                return out + " " + std::string(image.string(image.operand(id).value));
+            case NodeType::UNARY:
+                return out + (image.isPostfix(id) ? " postfix" : " prefix");
+            case NodeType::STRING:
+                for (const AstImage::SegmentRecord& segment : image.segments(id)) {
+                    out += " " + std::to_string(segment.type) + ":" + std::string(image.string(segment.content));
+                }
+                return out;
+            default:
+                return node.token == static_cast<uint8_t>(TokenType::LOAD) ? out + " " + std::string(image.path(id))
+                                                                          : out;
+        }
+    }
+
+    static std::string renderAst(const FlatAst& ast) {
+        std::string out;
+        for (uint32_t id = 0; id < ast.size(); id++) {
+            out += describe(ast, id) + " [";
+            for (uint32_t child : ast.children(id)) {
+                out += std::to_string(child) + " ";
+            }
+            out += "]\n";
+        }
+        return out;
+    }
+
+    static std::string renderImage(const AstImage& image) {
+        std::string out;
+        for (uint32_t id = 0; id < image.size(); id++) {
+            out += describe(image, id) + " [";
+            for (uint32_t child : image.children(id)) {
+                out += std::to_string(child) + " ";
+            }
+            out += "]\n";
+        }
+        return out;
+    }
+
+    // Serializes the tree of a source along with its literal and symbol tables
+    static std::string imageOf(const std::string& text, std::string* rendered = nullptr) {
+        Lexer   lexer(text);
+        Parser  parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+        FlatAst ast = FlatAstConverter::convert(parser.getNodes());
+        if (rendered != nullptr) {
+            *rendered = renderAst(ast);
+        }
+        return AstImage::serialize(ast, &lexer.getLiterals(), &lexer.getSymbols());
+    }
+
+    static void patch(std::string& bytes, size_t offset, uint32_t value) {
+        std::memcpy(bytes.data() + offset, &value, sizeof(value));
+    }
+
+    static uint64_t sectionOffset(const std::string& bytes, size_t section) {
+        uint64_t offset = 0;
+        std::memcpy(&offset, bytes.data() + 32 + section * 16, sizeof(offset));
+        return offset;
+    }
+};
+
+TEST_F(AstImageTest, MatchesFlatAst) {
+    std::string expected;
+    std::string bytes = imageOf(source, &expected);
+
+    EXPECT_EQ(AstImage::validate(bytes), "");
+    AstImage image(bytes);
+    EXPECT_EQ(renderImage(image), expected);
+    EXPECT_EQ(image.roots().size(), 5u);
+    EXPECT_EQ(image.bytesUsed(), bytes.size());
+}
+
+TEST_F(AstImageTest, KeepsFunctions) {
+    Lexer  lexer("fn add(a, b) {\n    sum = a + b\n}\nfn idle() {\n}\nx = add(1, 2)\n");
+    Parser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    parser.parseFunctionBody(*static_cast<FunctionNode*>(parser.getNodes()[0]));
+
+    FlatAst     ast   = FlatAstConverter::convert(parser.getNodes());
+    std::string bytes = AstImage::serialize(ast, &lexer.getLiterals(), &lexer.getSymbols());
+    AstImage    image(bytes);
+    EXPECT_EQ(renderImage(image), renderAst(ast));
+
+    uint32_t add = image.roots()[0];
+    ASSERT_EQ(image.kind(add), NodeType::FUNCTION);
+    EXPECT_EQ(image.symbol(image.function(add).symbol), "add");
+    EXPECT_EQ(image.function(add).isParsed, 1);
+    EXPECT_EQ(image.parameters(add).size(), 2u);
+    ASSERT_EQ(image.children(add).size(), 1u);
+    EXPECT_EQ(image.kind(image.children(add)[0]), NodeType::VARIABLE);
+
+    // An unparsed body keeps its tokens, so it can still be parsed from the image
+    uint32_t idle = image.roots()[1];
+    EXPECT_EQ(image.function(idle).isParsed, 0);
+    EXPECT_TRUE(image.children(idle).empty());
+    ASSERT_EQ(image.body(idle).size(), 1u);
+    EXPECT_EQ(image.string(image.body(idle)[0].value), "}");
+}
+
+TEST_F(AstImageTest, KeepsLiteralsAndSymbols) {
+    std::string bytes = imageOf(source);
+    AstImage    image(bytes);
+
+    const AstImage::VariableRecord& x = image.variable(image.roots()[0]);
+    EXPECT_EQ(image.symbol(x.symbol), "x");
+
+    bool sawFloat = false;
+    for (uint32_t id = 0; id < image.size(); id++) {
+        if (image.kind(id) != NodeType::OPERATION) {
+            continue;
+        }
+        for (const AstImage::TokenRecord& token : image.tokens(id)) {
+            if (static_cast<TokenType>(token.type) == TokenType::IDENTIFIER) {
+                EXPECT_EQ(image.symbol(token.payload), image.string(token.value));
+            } else if (static_cast<TokenType>(token.type) == TokenType::NUMBER && image.string(token.value) == "2.5") {
+                EXPECT_DOUBLE_EQ(image.literals()[token.payload].floating, 2.5);
+                sawFloat = true;
+            }
+        }
+    }
+    EXPECT_TRUE(sawFloat);
+}
+
+TEST_F(AstImageTest, DropsPayloadsWithoutTables) {
+    Lexer       lexer(source);
+    Parser      parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    std::string bytes = AstImage::serialize(FlatAstConverter::convert(parser.getNodes()));
+    AstImage    image(bytes);
+
+    EXPECT_EQ(image.symbolCount(), 0u);
+    EXPECT_TRUE(image.literals().empty());
+    EXPECT_EQ(image.variable(image.roots()[0]).symbol, SymbolTable::NO_SYMBOL);
+    for (uint32_t id = 0; id < image.size(); id++) {
+        if (image.kind(id) == NodeType::OPERAND) {
+            EXPECT_EQ(image.operand(id).payload, Token::NO_PAYLOAD);
+        }
+    }
+}
+
+TEST_F(AstImageTest, WritesAndMapsFiles) {
+    const std::string path = "ast_image_test" + std::string(AstImage::EXTENSION);
+    std::string       expected;
+    {
+        Lexer   lexer(source);
+        Parser  parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+        FlatAst ast = FlatAstConverter::convert(parser.getNodes());
+        expected    = renderAst(ast);
+        AstImage::write(path, ast, &lexer.getLiterals(), &lexer.getSymbols());
+    }
+
+    // The image is used in place, with the source, lexer and parser gone
+    AstImage image = AstImage::open(path);
+    EXPECT_EQ(renderImage(image), expected);
+    EXPECT_EQ(image.path(image.roots()[2]), "lib/module.op");
+
+    AstImage moved = std::move(image);
+    EXPECT_EQ(renderImage(moved), expected);
+    std::filesystem::remove(path);
+}
+
+TEST_F(AstImageTest, RejectsDamagedImages) {
+    const std::string intact = imageOf(source);
+
+    std::string truncated = intact.substr(0, intact.size() - 8);
+    EXPECT_NE(AstImage::validate(truncated), "");
+
+    std::string magic = intact;
+    magic[0]          = 'X';
+    EXPECT_EQ(AstImage::validate(magic), "not an AST image");
+
+    std::string version = intact;
+    patch(version, 8, AstImage::FORMAT_VERSION + 1);
+    EXPECT_NE(AstImage::validate(version), "");
+
+    // The child array is section 1, the first child of the first node must follow it
+    std::string child = intact;
+    patch(child, sectionOffset(child, 1), 0);
+    EXPECT_NE(AstImage::validate(child), "");
+
+    // The variables are section 3, their first field is the string table offset of the name
+    std::string name = intact;
+    patch(name, sectionOffset(name, 3), UINT32_MAX);
+    EXPECT_NE(AstImage::validate(name), "");
+
+    EXPECT_THROW(AstImage image(name), std::runtime_error);
+    EXPECT_THROW(AstImage::open("ast_image_missing.opast"), std::runtime_error);
+}
+
+TEST_F(AstImageTest, SerializesEmptyProgram) {
+    std::string bytes = imageOf("");
+    AstImage    image(bytes);
+
+    EXPECT_EQ(image.size(), 0u);
+    EXPECT_TRUE(image.roots().empty());
+}
+
+}  // namespace opal::Test
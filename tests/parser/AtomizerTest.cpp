@@ -20,6 +20,8 @@
  */
 
 #include "opal/lexer/Token.hpp"
+#include "opal/lexer/TokenClass.hpp"
+#include "opal/parser/atomizer/AtomizerFactory.hpp"
 #include "opal/parser/atomizer/atomizers/OperationAtomizer.hpp"
 #include "opal/parser/atomizer/atomizers/VariableAtomizer.hpp"
 #include "opal/parser/node/nodes/OperationNode.hpp"
@@ -27,6 +29,8 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+
 namespace opal::Test {
 
 class AtomizerTest : public ::testing::Test {
@@ -49,10 +53,10 @@ TEST_F(AtomizerTest, VariableAtomizerSimpleAssignment) {
     VariableAtomizer atomizer(current, tokens);
     EXPECT_TRUE(atomizer.canHandle(tokens[current].type));
 
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    NodeBase* node = atomizer.atomize();
     ASSERT_NE(node, nullptr);
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_EQ(varNode->getName(), "x");
     EXPECT_EQ(varNode->getValue(), "42");
@@ -60,6 +64,39 @@ TEST_F(AtomizerTest, VariableAtomizerSimpleAssignment) {
     EXPECT_FALSE(varNode->getIsConstant());
 }
 
+TEST_F(AtomizerTest, VariableAtomizerFloatAssignment) {
+    // Testing: x = 3.14
+    tokens.emplace_back(TokenType::IDENTIFIER, "x", 1, 1);
+    tokens.emplace_back(TokenType::EQUAL, "=", 1, 3);
+    tokens.emplace_back(TokenType::NUMBER, "3.14", 1, 5);
+
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
+
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
+    ASSERT_NE(varNode, nullptr);
+    EXPECT_EQ(varNode->getValue(), "3.14");
+    EXPECT_EQ(varNode->getType(), VariableType::FLOAT);
+    EXPECT_DOUBLE_EQ(varNode->getNumber().floating, 3.14);
+}
+
+TEST_F(AtomizerTest, VariableAtomizerFloatOperation) {
+    // Testing: x = 2 * 1.5
+    tokens.emplace_back(TokenType::IDENTIFIER, "x", 1, 1);
+    tokens.emplace_back(TokenType::EQUAL, "=", 1, 3);
+    tokens.emplace_back(TokenType::NUMBER, "2", 1, 5);
+    tokens.emplace_back(TokenType::MULTIPLY, "*", 1, 7);
+    tokens.emplace_back(TokenType::NUMBER, "1.5", 1, 9);
+
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
+
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
+    ASSERT_NE(varNode, nullptr);
+    ASSERT_NE(varNode->getOperation(), nullptr);
+    EXPECT_EQ(varNode->getType(), VariableType::FLOAT);
+}
+
 TEST_F(AtomizerTest, VariableAtomizerConstAssignment) {
     // Testing: const x = 42
     tokens.emplace_back(TokenType::CONST, "const", 1, 1);
@@ -70,10 +107,10 @@ TEST_F(AtomizerTest, VariableAtomizerConstAssignment) {
     VariableAtomizer atomizer(current, tokens);
     EXPECT_TRUE(atomizer.canHandle(tokens[1].type));
 
-    current                        = 1;
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    current        = 1;
+    NodeBase* node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_TRUE(varNode->getIsConstant());
     EXPECT_EQ(varNode->getValue(), "42");
@@ -86,15 +123,15 @@ TEST_F(AtomizerTest, VariableAtomizerStringAssignment) {
     tokens.emplace_back(TokenType::EQUAL, "=", 1, 9);
     tokens.emplace_back(TokenType::STRING, "hello", 1, 11);
 
-    VariableAtomizer          atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_EQ(varNode->getType(), VariableType::STRING);
     const opal::StringNode* const& stringNode = varNode->getStringNode();
     ASSERT_NE(stringNode, nullptr);
-    const std::vector<StringSegment>& segments = stringNode->getSegments();
+    std::span<const StringSegment> segments = stringNode->getSegments();
     ASSERT_EQ(segments.size(), 1);
     EXPECT_EQ(segments[0].type, StringSegmentType::TEXT);
     EXPECT_EQ(segments[0].content, "hello");
@@ -106,10 +143,10 @@ TEST_F(AtomizerTest, VariableAtomizerBoolAssignment) {
     tokens.emplace_back(TokenType::EQUAL, "=", 1, 6);
     tokens.emplace_back(TokenType::TRUE, "true", 1, 8);
 
-    VariableAtomizer          atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_EQ(varNode->getType(), VariableType::BOOL);
     EXPECT_EQ(varNode->getValue(), "true");
@@ -123,10 +160,10 @@ TEST_F(AtomizerTest, VariableWithOperation) {
     tokens.emplace_back(TokenType::PLUS, "+", 1, 12);
     tokens.emplace_back(TokenType::NUMBER, "3", 1, 14);
 
-    VariableAtomizer          atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_EQ(varNode->getName(), "result");
     EXPECT_EQ(varNode->getType(), VariableType::INT);
@@ -134,7 +171,7 @@ TEST_F(AtomizerTest, VariableWithOperation) {
     opal::OperationNode* opNode = varNode->getOperation();
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 3);
     EXPECT_EQ(opTokens[0].type, TokenType::NUMBER);
     EXPECT_EQ(opTokens[0].value, "5");
@@ -152,11 +189,11 @@ TEST_F(AtomizerTest, BasicOperation) {
     OperationAtomizer atomizer(current, tokens);
     EXPECT_TRUE(atomizer.canHandle(tokens[1].type));
 
-    std::unique_ptr<NodeBase> node   = atomizer.atomize();
-    opal::OperationNode*      opNode = dynamic_cast<opal::OperationNode*>(node.get());
+    NodeBase*            node   = atomizer.atomize();
+    opal::OperationNode* opNode = dynamic_cast<opal::OperationNode*>(node);
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 3);
     EXPECT_EQ(opTokens[0].type, TokenType::NUMBER);
     EXPECT_EQ(opTokens[0].value, "2");
@@ -171,13 +208,13 @@ TEST_F(AtomizerTest, OperationWithIdentifiers) {
     tokens.emplace_back(TokenType::PLUS, "+", 1, 3);
     tokens.emplace_back(TokenType::IDENTIFIER, "y", 1, 5);
 
-    OperationAtomizer         atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    OperationAtomizer atomizer(current, tokens);
+    NodeBase*         node = atomizer.atomize();
 
-    opal::OperationNode* opNode = dynamic_cast<opal::OperationNode*>(node.get());
+    opal::OperationNode* opNode = dynamic_cast<opal::OperationNode*>(node);
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 3);
     EXPECT_EQ(opTokens[0].type, TokenType::IDENTIFIER);
     EXPECT_EQ(opTokens[0].value, "x");
@@ -192,10 +229,10 @@ TEST_F(AtomizerTest, NilAssignment) {
     tokens.emplace_back(TokenType::EQUAL, "=", 1, 3);
     tokens.emplace_back(TokenType::NIL, "nil", 1, 5);
 
-    VariableAtomizer          atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_EQ(varNode->getType(), VariableType::NIL);
     EXPECT_EQ(varNode->getValue(), "nil");
@@ -229,10 +266,10 @@ TEST_F(AtomizerTest, MultipleArithmeticOperations) {
     tokens.emplace_back(TokenType::MINUS, "-", 1, 16);
     tokens.emplace_back(TokenType::NUMBER, "2", 1, 18);
 
-    VariableAtomizer          atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_EQ(varNode->getName(), "result");
     EXPECT_EQ(varNode->getType(), VariableType::INT);
@@ -240,7 +277,7 @@ TEST_F(AtomizerTest, MultipleArithmeticOperations) {
     opal::OperationNode* opNode = varNode->getOperation();
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 5);
     EXPECT_EQ(opTokens[0].value, "5");
     EXPECT_EQ(opTokens[1].type, TokenType::PLUS);
@@ -255,10 +292,10 @@ TEST_F(AtomizerTest, VariableReassignment) {
     tokens.emplace_back(TokenType::EQUAL, "=", 1, 3);
     tokens.emplace_back(TokenType::IDENTIFIER, "y", 1, 5);
 
-    VariableAtomizer          atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_EQ(varNode->getName(), "x");
     EXPECT_EQ(varNode->getValue(), "y");
@@ -274,13 +311,13 @@ TEST_F(AtomizerTest, MultipleOperationsWithIdentifiers) {
     tokens.emplace_back(TokenType::PLUS, "+", 1, 7);
     tokens.emplace_back(TokenType::IDENTIFIER, "z", 1, 9);
 
-    OperationAtomizer         atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    OperationAtomizer atomizer(current, tokens);
+    NodeBase*         node = atomizer.atomize();
 
-    opal::OperationNode* opNode = dynamic_cast<opal::OperationNode*>(node.get());
+    opal::OperationNode* opNode = dynamic_cast<opal::OperationNode*>(node);
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 5);
     EXPECT_EQ(opTokens[0].type, TokenType::IDENTIFIER);
     EXPECT_EQ(opTokens[0].value, "x");
@@ -302,10 +339,10 @@ TEST_F(AtomizerTest, MixedOperations) {
     tokens.emplace_back(TokenType::PLUS, "+", 1, 17);
     tokens.emplace_back(TokenType::IDENTIFIER, "y", 1, 19);
 
-    VariableAtomizer          atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_EQ(varNode->getName(), "result");
     EXPECT_EQ(varNode->getType(), VariableType::INT);
@@ -313,7 +350,7 @@ TEST_F(AtomizerTest, MixedOperations) {
     opal::OperationNode* opNode = varNode->getOperation();
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 5);
     EXPECT_EQ(opTokens[0].value, "42");
     EXPECT_EQ(opTokens[1].type, TokenType::MULTIPLY);
@@ -332,16 +369,16 @@ TEST_F(AtomizerTest, ConstStringAssignment) {
     VariableAtomizer atomizer(current, tokens);
     EXPECT_TRUE(atomizer.canHandle(tokens[1].type));
 
-    current                        = 1;
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    current        = 1;
+    NodeBase* node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_TRUE(varNode->getIsConstant());
     EXPECT_EQ(varNode->getType(), VariableType::STRING);
     const opal::StringNode* const& stringNode = varNode->getStringNode();
     ASSERT_NE(stringNode, nullptr);
-    const std::vector<StringSegment>& segments = stringNode->getSegments();
+    std::span<const StringSegment> segments = stringNode->getSegments();
     ASSERT_EQ(segments.size(), 1);
     EXPECT_EQ(segments[0].type, StringSegmentType::TEXT);
     EXPECT_EQ(segments[0].content, "hello world");
@@ -353,15 +390,15 @@ TEST_F(AtomizerTest, EmptyString) {
     tokens.emplace_back(TokenType::EQUAL, "=", 1, 6);
     tokens.emplace_back(TokenType::STRING, "", 1, 8);
 
-    VariableAtomizer          atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
     EXPECT_EQ(varNode->getType(), VariableType::STRING);
     const opal::StringNode* const& stringNode = varNode->getStringNode();
     ASSERT_NE(stringNode, nullptr);
-    const std::vector<StringSegment>& segments = stringNode->getSegments();
+    std::span<const StringSegment> segments = stringNode->getSegments();
     ASSERT_EQ(segments.size(), 0);
 }
 
@@ -373,16 +410,16 @@ TEST_F(AtomizerTest, DivisionOperation) {
     tokens.emplace_back(TokenType::DIVIDE, "/", 1, 12);
     tokens.emplace_back(TokenType::NUMBER, "2", 1, 14);
 
-    VariableAtomizer          atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node = atomizer.atomize();
+    VariableAtomizer atomizer(current, tokens);
+    NodeBase*        node = atomizer.atomize();
 
-    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node.get());
+    opal::VariableNode* varNode = dynamic_cast<opal::VariableNode*>(node);
     ASSERT_NE(varNode, nullptr);
 
     opal::OperationNode* opNode = varNode->getOperation();
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 3);
     EXPECT_EQ(opTokens[0].value, "x");
     EXPECT_EQ(opTokens[1].type, TokenType::DIVIDE);
@@ -397,12 +434,12 @@ TEST_F(AtomizerTest, OperationAtomizerComplex) {
     tokens.emplace_back(TokenType::PLUS, "+", 1, 7);
     tokens.emplace_back(TokenType::NUMBER, "5", 1, 9);
 
-    OperationAtomizer         atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node   = atomizer.atomize();
-    opal::OperationNode*      opNode = dynamic_cast<opal::OperationNode*>(node.get());
+    OperationAtomizer    atomizer(current, tokens);
+    NodeBase*            node   = atomizer.atomize();
+    opal::OperationNode* opNode = dynamic_cast<opal::OperationNode*>(node);
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 5);
     EXPECT_EQ(opTokens[0].value, "2");
     EXPECT_EQ(opTokens[1].type, TokenType::MULTIPLY);
@@ -421,12 +458,12 @@ TEST_F(AtomizerTest, ParenthesizedOperation) {
     tokens.emplace_back(TokenType::MULTIPLY, "*", 1, 9);
     tokens.emplace_back(TokenType::NUMBER, "3", 1, 11);
 
-    OperationAtomizer         atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node   = atomizer.atomize();
-    opal::OperationNode*      opNode = dynamic_cast<opal::OperationNode*>(node.get());
+    OperationAtomizer    atomizer(current, tokens);
+    NodeBase*            node   = atomizer.atomize();
+    opal::OperationNode* opNode = dynamic_cast<opal::OperationNode*>(node);
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 7);
     EXPECT_EQ(opTokens[0].type, TokenType::LEFT_PAREN);
     EXPECT_EQ(opTokens[1].value, "2");
@@ -449,12 +486,12 @@ TEST_F(AtomizerTest, NestedParentheses) {
     tokens.emplace_back(TokenType::NUMBER, "4", 1, 12);
     tokens.emplace_back(TokenType::RIGHT_PAREN, ")", 1, 13);
 
-    OperationAtomizer         atomizer(current, tokens);
-    std::unique_ptr<NodeBase> node   = atomizer.atomize();
-    opal::OperationNode*      opNode = dynamic_cast<opal::OperationNode*>(node.get());
+    OperationAtomizer    atomizer(current, tokens);
+    NodeBase*            node   = atomizer.atomize();
+    opal::OperationNode* opNode = dynamic_cast<opal::OperationNode*>(node);
     ASSERT_NE(opNode, nullptr);
 
-    const std::vector<Token>& opTokens = opNode->getTokens();
+    std::span<const Token> opTokens = opNode->getTokens();
     ASSERT_EQ(opTokens.size(), 9);
     EXPECT_EQ(opTokens[0].type, TokenType::LEFT_PAREN);
     EXPECT_EQ(opTokens[1].type, TokenType::LEFT_PAREN);
@@ -504,4 +541,36 @@ TEST_F(AtomizerTest, EmptyParentheses) {
     EXPECT_THROW(atomizer.atomize(), std::runtime_error);
 }
 
-}  // namespace opal::Test
\ No newline at end of file
+TEST_F(AtomizerTest, FactoryAtomizersClaimDistinctLeadingTypes) {
+    std::array<int, TOKEN_TYPE_COUNT> claims{};
+
+    for (const std::unique_ptr<AtomizerBase>& atomizer : AtomizerFactory::createAtomizers(current, tokens)) {
+        for (TokenType type : atomizer->leadingTypes()) {
+            EXPECT_TRUE(atomizer->canHandle(type) || type == TokenType::IDENTIFIER);
+            claims[static_cast<size_t>(type)]++;
+        }
+    }
+
+    EXPECT_EQ(claims[static_cast<size_t>(TokenType::IDENTIFIER)], 1);
+    EXPECT_EQ(claims[static_cast<size_t>(TokenType::LOAD)], 1);
+    for (int count : claims) {
+        EXPECT_LE(count, 1);
+    }
+}
+
+TEST_F(AtomizerTest, ClassifiesOperationTokens) {
+    static_assert(isArithmeticOperator(TokenType::MODULO));
+    static_assert(!isArithmeticOperator(TokenType::POWER));
+    static_assert(isOperationToken(TokenType::LEFT_PAREN));
+    static_assert(!isOperationToken(TokenType::RIGHT_PAREN));
+    static_assert(isOperand(TokenType::NUMBER) && isOperand(TokenType::IDENTIFIER));
+    static_assert(!isOperand(TokenType::STRING));
+
+    OperationAtomizer atomizer(current, tokens);
+    for (size_t i = 0; i < TOKEN_TYPE_COUNT; i++) {
+        TokenType type = static_cast<TokenType>(i);
+        EXPECT_EQ(atomizer.canHandle(type), isOperationToken(type));
+    }
+}
+
+}  // namespace opal::Test
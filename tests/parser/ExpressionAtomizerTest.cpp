@@ -0,0 +1,243 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/atomizer/atomizers/ExpressionAtomizer.hpp"
+#include "opal/parser/node/nodes/BinaryNode.hpp"
+#include "opal/parser/node/nodes/CallNode.hpp"
+#include "opal/parser/node/nodes/OperandNode.hpp"
+#include "opal/parser/node/nodes/OperationNode.hpp"
+#include "opal/parser/node/nodes/UnaryNode.hpp"
+#include "opal/parser/node/nodes/VariableNode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opal::Test {
+
+class ExpressionAtomizerTest : public ::testing::Test {
+protected:
+    std::string        source;
+    std::vector<Token> tokens;
+    size_t             current = 0;
+
+    // Lexes the source and renders the expression parsed from it as an s-expression
+    std::string parse(std::string_view text) {
+        source = text;
+        Lexer lexer{std::string_view(source)};
+        lexer.scanTokens();
+        tokens  = lexer.releaseTokens();
+        current = 0;
+
+        ExpressionAtomizer atomizer(current, tokens);
+        return render(atomizer.atomize());
+    }
+
+    static std::string op(TokenType type) {
+        switch (type) {
+            case TokenType::PLUS:
+                return "+";
+            case TokenType::MINUS:
+                return "-";
+            case TokenType::MULTIPLY:
+                return "*";
+            case TokenType::DIVIDE:
+                return "/";
+            case TokenType::MODULO:
+                return "%";
+            case TokenType::POWER:
+                return "^";
+            case TokenType::EQUAL_EQUAL:
+                return "==";
+            case TokenType::LESS:
+                return "<";
+            case TokenType::AND:
+                return "and";
+            case TokenType::OR:
+                return "or";
+            case TokenType::NOT:
+                return "not";
+            case TokenType::RANGE:
+                return "..";
+            case TokenType::BITWISE_AND:
+                return "&";
+            case TokenType::BITWISE_OR:
+                return "|";
+            case TokenType::BITWISE_XOR:
+                return "#";
+            case TokenType::BITWISE_NOT:
+                return "~";
+            case TokenType::SHIFT_LEFT:
+                return "<<";
+            case TokenType::INCREMENT:
+                return "++";
+            default:
+                return "?";
+        }
+    }
+
+    static std::string render(const NodeBase* node) {
+        if (const auto* operand = dynamic_cast<const OperandNode*>(node)) {
+            return std::string(operand->getToken().value);
+        }
+        if (const auto* unary = dynamic_cast<const UnaryNode*>(node)) {
+            return unary->isPostfix() ? "(" + render(unary->getOperand()) + " " + op(unary->getTokenType()) + ")"
+                                      : "(" + op(unary->getTokenType()) + " " + render(unary->getOperand()) + ")";
+        }
+        if (const auto* binary = dynamic_cast<const BinaryNode*>(node)) {
+            return "(" + op(binary->getTokenType()) + " " + render(binary->getLeft()) + " "
+                   + render(binary->getRight()) + ")";
+        }
+        if (const auto* call = dynamic_cast<const CallNode*>(node)) {
+            std::string text = "(call " + render(call->getCallee());
+            for (const NodeBase* argument : call->getArguments()) {
+                text += " " + render(argument);
+            }
+            return text + ")";
+        }
+        return "<unknown>";
+    }
+};
+
+TEST_F(ExpressionAtomizerTest, ArithmeticPrecedence) {
+    EXPECT_EQ(parse("1 + 2 * 3 - 4 / 2 % 3"), "(- (+ 1 (* 2 3)) (% (/ 4 2) 3))");
+}
+
+TEST_F(ExpressionAtomizerTest, PowerIsRightAssociative) {
+    EXPECT_EQ(parse("2 ^ 3 ^ 2"), "(^ 2 (^ 3 2))");
+    EXPECT_EQ(parse("2 - 3 - 4"), "(- (- 2 3) 4)");
+}
+
+TEST_F(ExpressionAtomizerTest, PrefixOperatorsBindLooserThanPower) {
+    EXPECT_EQ(parse("-2 ^ 2"), "(- (^ 2 2))");
+    EXPECT_EQ(parse("-a * ~b"), "(* (- a) (~ b))");
+}
+
+TEST_F(ExpressionAtomizerTest, ComparisonAndLogicalOperators) {
+    EXPECT_EQ(parse("a < b + 1 and not c or d == e"), "(or (and (< a (+ b 1)) (not c)) (== d e))");
+}
+
+TEST_F(ExpressionAtomizerTest, BitwiseShiftAndRangeOperators) {
+    EXPECT_EQ(parse("a | b # c & d << 2"), "(| a (# b (& c (<< d 2))))");
+    EXPECT_EQ(parse("0 .. n + 1"), "(.. 0 (+ n 1))");
+}
+
+TEST_F(ExpressionAtomizerTest, GroupsAndCalls) {
+    EXPECT_EQ(parse("(1 + 2) * 3"), "(* (+ 1 2) 3)");
+    EXPECT_EQ(parse("fibonacci(i % 5) + pick(a, b)(c)"), "(+ (call fibonacci (% i 5)) (call (call pick a b) c))");
+    EXPECT_EQ(parse("now()"), "(call now)");
+}
+
+TEST_F(ExpressionAtomizerTest, PostfixOperators) {
+    EXPECT_EQ(parse("i++ * 2"), "(* (i ++) 2)");
+}
+
+TEST_F(ExpressionAtomizerTest, ParsesBenchmarkExpression) {
+    EXPECT_EQ(parse("(7 * 3.14159) ^ 2 + fibonacci(7 % 5)"), "(+ (^ (* 7 3.14159) 2) (call fibonacci (% 7 5)))");
+}
+
+TEST_F(ExpressionAtomizerTest, StopsBeforeTokenThatCannotContinue) {
+    EXPECT_EQ(parse("a + b = c"), "(+ a b)");
+    EXPECT_EQ(tokens[current].type, TokenType::EQUAL);
+}
+
+TEST_F(ExpressionAtomizerTest, ReportsMalformedExpressions) {
+    EXPECT_THROW(parse("(1 + 2"), std::runtime_error);
+    EXPECT_THROW(parse("1 + 2)"), std::runtime_error);
+    EXPECT_THROW(parse("() + 2"), std::runtime_error);
+    EXPECT_THROW(parse("f(1, 2"), std::runtime_error);
+    EXPECT_THROW(parse("1 * = 2"), std::runtime_error);
+    EXPECT_THROW(parse(std::string(1000, '(') + "1" + std::string(1000, ')')), std::runtime_error);
+}
+
+TEST_F(ExpressionAtomizerTest, DeepRightAssociativeChainsAreRejected) {
+    std::string shallow = "2";
+    for (int i = 0; i < 100; i++) {
+        shallow += " ^ 2";
+    }
+    EXPECT_NO_THROW(parse(shallow));
+
+    std::string deep = "x = 1";
+    for (int i = 0; i < 200000; i++) {
+        deep += " ^ 1";
+    }
+    Lexer lexer(deep);
+    EXPECT_THROW(Parser(lexer.scanTokens()), std::runtime_error);
+}
+
+TEST_F(ExpressionAtomizerTest, DeepChainsPrintWithoutRecursion) {
+    constexpr size_t terms = 2000;
+
+    source = "1";
+    for (size_t i = 1; i < terms; i++) {
+        source += " + 1";
+    }
+    Lexer lexer{std::string_view(source)};
+    lexer.scanTokens();
+    tokens  = lexer.releaseTokens();
+    current = 0;
+
+    ExpressionAtomizer atomizer(current, tokens);
+    NodeBase*          expression = atomizer.atomize();
+
+    testing::internal::CaptureStdout();
+    expression->print();
+    std::string printed = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(std::count(printed.begin(), printed.end(), '\n'), static_cast<std::ptrdiff_t>(2 * terms - 1));
+    EXPECT_EQ(printed.rfind("Binary", 0), 0u);
+}
+
+TEST_F(ExpressionAtomizerTest, AssignmentsKeepTokensAndTree) {
+    Lexer  lexer("flag = a < b + 1\nneg = -x\ntotal = sum(a, b) * 2\n");
+    Parser parser(lexer.scanTokens());
+
+    const std::vector<NodeBase*>& nodes = parser.getNodes();
+    ASSERT_EQ(nodes.size(), 3u);
+
+    const auto* flag = dynamic_cast<const VariableNode*>(nodes[0]);
+    ASSERT_NE(flag, nullptr);
+    ASSERT_NE(flag->getOperation(), nullptr);
+    EXPECT_EQ(flag->getType(), VariableType::BOOL);
+    EXPECT_EQ(flag->getOperation()->getTokens().size(), 5u);
+    EXPECT_EQ(render(flag->getOperation()->getExpression()), "(< a (+ b 1))");
+
+    const auto* neg = dynamic_cast<const VariableNode*>(nodes[1]);
+    ASSERT_NE(neg, nullptr);
+    ASSERT_NE(neg->getOperation(), nullptr);
+    EXPECT_EQ(render(neg->getOperation()->getExpression()), "(- x)");
+
+    const auto* total = dynamic_cast<const VariableNode*>(nodes[2]);
+    ASSERT_NE(total, nullptr);
+    ASSERT_NE(total->getOperation(), nullptr);
+    EXPECT_EQ(total->getType(), VariableType::INT);
+    EXPECT_EQ(render(total->getOperation()->getExpression()), "(* (call sum a b) 2)");
+}
+
+}  // namespace opal::Test
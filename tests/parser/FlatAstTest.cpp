@@ -0,0 +1,295 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/flat/FlatAst.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/flat/FlatAstConverter.hpp"
+#include "opal/parser/flat/FlatAstVisitor.hpp"
+#include "opal/parser/node/nodes/BinaryNode.hpp"
+#include "opal/parser/node/nodes/CallNode.hpp"
+#include "opal/parser/node/nodes/LoadNode.hpp"
+#include "opal/parser/node/nodes/OperandNode.hpp"
+#include "opal/parser/node/nodes/OperationNode.hpp"
+#include "opal/parser/node/nodes/UnaryNode.hpp"
+#include "opal/parser/node/nodes/VariableNode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class FlatAstTest : public ::testing::Test {
+protected:
+    // Renders a pointer tree in pre-order, one entry per node
+    static void describeTree(const NodeBase* node, std::string& out) {
+        out += std::to_string(static_cast<int>(node->getNodeType())) + "/"
+               + std::to_string(static_cast<int>(node->getTokenType())) + " ";
+
+        switch (node->getNodeType()) {
+            case NodeType::VARIABLE: {
+                const auto* variable = static_cast<const VariableNode*>(node);
+                out += std::string(variable->getName()) + "=" + std::string(variable->getValue()) + " ";
+                if (variable->getOperation()) {
+                    describeTree(variable->getOperation(), out);
+                }
+                if (variable->getStringNode()) {
+                    describeTree(variable->getStringNode(), out);
+                }
+                break;
+            }
+            case NodeType::OPERATION:
+                out += std::to_string(static_cast<const OperationNode*>(node)->getTokens().size()) + " ";
+                if (static_cast<const OperationNode*>(node)->getExpression()) {
+                    describeTree(static_cast<const OperationNode*>(node)->getExpression(), out);
+                }
+                break;
+            case NodeType::OPERAND:
+                out += std::string(static_cast<const OperandNode*>(node)->getToken().value) + " ";
+                break;
+            case NodeType::UNARY:
+                describeTree(static_cast<const UnaryNode*>(node)->getOperand(), out);
+                break;
+            case NodeType::BINARY:
+                describeTree(static_cast<const BinaryNode*>(node)->getLeft(), out);
+                describeTree(static_cast<const BinaryNode*>(node)->getRight(), out);
+                break;
+            case NodeType::CALL:
+                describeTree(static_cast<const CallNode*>(node)->getCallee(), out);
+                for (const NodeBase* argument : static_cast<const CallNode*>(node)->getArguments()) {
+                    describeTree(argument, out);
+                }
+                break;
+            case NodeType::STRING:
+                for (const StringSegment& segment : static_cast<const StringNode*>(node)->getSegments()) {
+                    out += std::string(segment.content) + "|";
+                }
+                out += " ";
+                break;
+            default:
+                if (node->getTokenType() == TokenType::LOAD) {
+                    out += std::string(static_cast<const LoadNode*>(node)->getPath()) + " ";
+                }
+                break;
+        }
+    }
+
+    // Renders a flat tree with the same format as describeTree
+    class Describer : public FlatAstVisitor {
+    public:
+        std::string out;
+        size_t      left = 0;
+
+        bool enter(const FlatAst& ast, uint32_t id) override {
+            const FlatNode& node = ast.node(id);
+            out += std::to_string(static_cast<int>(node.kind)) + "/" + std::to_string(static_cast<int>(node.token))
+                   + " ";
+
+            switch (node.kind) {
+                case NodeType::VARIABLE:
+                    out += std::string(ast.variable(id).name) + "=" + std::string(ast.variable(id).value) + " ";
+                    break;
+                case NodeType::OPERATION:
+                    out += std::to_string(ast.tokens(id).size()) + " ";
+                    break;
+                case NodeType::OPERAND:
+                    out += std::string(ast.operand(id).value) + " ";
+                    break;
+                case NodeType::STRING:
+                    for (const StringSegment& segment : ast.segments(id)) {
+                        out += std::string(segment.content) + "|";
+                    }
+                    out += " ";
+                    break;
+                default:
+                    if (node.token == TokenType::LOAD) {
+                        out += std::string(ast.path(id)) + " ";
+                    }
+                    break;
+            }
+            return true;
+        }
+
+        void leave(const FlatAst&, uint32_t) override { left++; }
+    };
+};
+
+TEST_F(FlatAstTest, ConvertsNodesInPreOrder) {
+    Lexer   lexer("const x = 42\ny = (x + 1) * 2\nload \"module.op\"\n");
+    Parser  parser(lexer.scanTokens());
+    FlatAst ast = FlatAstConverter::convert(parser.getNodes());
+
+    ASSERT_EQ(ast.roots().size(), 3u);
+    EXPECT_EQ(ast.roots()[0], 0u);
+
+    const FlatVariable& x = ast.variable(ast.roots()[0]);
+    EXPECT_EQ(x.name, "x");
+    EXPECT_EQ(x.value, "42");
+    EXPECT_TRUE(x.isConstant);
+    EXPECT_EQ(x.type, VariableType::INT);
+    EXPECT_EQ(x.number.integer, 42);
+
+    uint32_t y = ast.roots()[1];
+    ASSERT_EQ(ast.children(y).size(), 1u);
+    uint32_t operation = ast.children(y)[0];
+    EXPECT_EQ(operation, y + 1);
+    EXPECT_EQ(ast.node(operation).kind, NodeType::OPERATION);
+    EXPECT_EQ(ast.tokens(operation).size(), 7u);
+
+    uint32_t product = ast.children(operation)[0];
+    EXPECT_EQ(ast.node(product).kind, NodeType::BINARY);
+    EXPECT_EQ(ast.node(product).token, TokenType::MULTIPLY);
+    ASSERT_EQ(ast.children(product).size(), 2u);
+    EXPECT_EQ(ast.operand(ast.children(product)[1]).value, "2");
+
+    uint32_t load = ast.roots()[2];
+    EXPECT_EQ(ast.path(load), "module.op");
+    EXPECT_EQ(load + 1, ast.size());
+}
+
+TEST_F(FlatAstTest, MatchesPointerTree) {
+    std::string source;
+    for (int i = 0; i < 50; i++) {
+        std::string n = std::to_string(i);
+        source += "const c" + n + " = " + n + ".5\n";
+        source += "v" + n + " = -(c" + n + " + 3) * pick(v" + n + ", 2) ^ 2 - i++\n";
+        source += "flag" + n + " = v" + n + " < 10 and not done\n";
+        source += "load \"module_" + n + ".op\"\n";
+    }
+    source += "s = \"total ${v1} of ${v2}\"\n";
+
+    Lexer   lexer(source);
+    Parser  parser(lexer.scanTokens());
+    FlatAst ast = FlatAstConverter::convert(parser.getNodes());
+
+    std::string expected;
+    for (const NodeBase* node : parser.getNodes()) {
+        describeTree(node, expected);
+    }
+
+    Describer describer;
+    ast.walk(describer);
+    EXPECT_EQ(describer.out, expected);
+    EXPECT_EQ(describer.left, ast.size());
+}
+
+TEST_F(FlatAstTest, OperandsShareOperationTokens) {
+    Lexer   lexer("a = (b + 1) * c\n");
+    Parser  parser(lexer.scanTokens());
+    FlatAst ast = FlatAstConverter::convert(parser.getNodes());
+
+    uint32_t               operation = ast.children(ast.roots()[0])[0];
+    std::span<const Token> tokens    = ast.tokens(operation);
+    ASSERT_EQ(tokens.size(), 7u);
+
+    std::vector<const Token*> operands;
+    for (uint32_t id = operation; id < ast.size(); id++) {
+        if (ast.node(id).kind == NodeType::OPERAND) {
+            operands.push_back(&ast.operand(id));
+        }
+    }
+    ASSERT_EQ(operands.size(), 3u);
+    EXPECT_EQ(operands[0], &tokens[1]);
+    EXPECT_EQ(operands[1], &tokens[3]);
+    EXPECT_EQ(operands[2], &tokens[6]);
+}
+
+TEST_F(FlatAstTest, VisitorCanSkipChildren) {
+    class OperationSkipper : public FlatAstVisitor {
+    public:
+        size_t entered = 0;
+        size_t left    = 0;
+
+        bool enter(const FlatAst& ast, uint32_t id) override {
+            entered++;
+            return ast.node(id).kind != NodeType::OPERATION;
+        }
+
+        void leave(const FlatAst&, uint32_t) override { left++; }
+    };
+
+    Lexer   lexer("a = (1 + 2) * 3\nb = 4\n");
+    Parser  parser(lexer.scanTokens());
+    FlatAst ast = FlatAstConverter::convert(parser.getNodes());
+
+    OperationSkipper skipper;
+    ast.walk(skipper);
+    EXPECT_EQ(skipper.entered, 3u);
+    EXPECT_EQ(skipper.left, 3u);
+    EXPECT_GT(ast.size(), 3u);
+}
+
+TEST_F(FlatAstTest, OutlivesParser) {
+    Lexer   lexer("name = \"hello ${who}\"\n");
+    FlatAst ast = [&] {
+        Parser parser(lexer.scanTokens());
+        return FlatAstConverter::convert(parser.getNodes());
+    }();
+
+    ASSERT_EQ(ast.roots().size(), 1u);
+    EXPECT_EQ(ast.variable(ast.roots()[0]).name, "name");
+
+    uint32_t string = ast.children(ast.roots()[0])[0];
+    ASSERT_EQ(ast.segments(string).size(), 2u);
+    EXPECT_EQ(ast.segments(string)[0].content, "hello ");
+    EXPECT_EQ(ast.segments(string)[1].content, "who");
+    EXPECT_GT(ast.bytesUsed(), 0u);
+}
+
+TEST_F(FlatAstTest, ConvertsVeryDeepChains) {
+    constexpr size_t terms = 100000;
+
+    std::string source = "x = 1";
+    for (size_t i = 1; i < terms; i++) {
+        source += " + 1";
+    }
+    Lexer   lexer(source);
+    Parser  parser(lexer.scanTokens());
+    FlatAst ast = FlatAstConverter::convert(parser.getNodes());
+
+    // The variable, its operation, then terms - 1 binary nodes and terms operands
+    ASSERT_EQ(ast.size(), 2 * terms + 1);
+    uint32_t deepest = ast.children(ast.roots()[0])[0];
+    while (ast.node(deepest).childCount > 0) {
+        deepest = ast.children(deepest)[0];
+    }
+    EXPECT_EQ(ast.node(deepest).kind, NodeType::OPERAND);
+    EXPECT_EQ(deepest, terms + 1);
+
+    Describer describer;
+    ast.walk(describer);
+    EXPECT_EQ(describer.left, ast.size());
+}
+
+TEST_F(FlatAstTest, ConvertsEmptyProgram) {
+    FlatAst ast = FlatAstConverter::convert({});
+    EXPECT_EQ(ast.size(), 0u);
+    EXPECT_TRUE(ast.roots().empty());
+
+    Describer describer;
+    ast.walk(describer);
+    EXPECT_TRUE(describer.out.empty());
+}
+
+}  // namespace opal::Test
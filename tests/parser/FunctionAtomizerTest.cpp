@@ -0,0 +1,167 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/atomizer/atomizers/FunctionAtomizer.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/lexer/Token.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/node/nodes/FunctionNode.hpp"
+#include "opal/parser/node/nodes/VariableNode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class FunctionAtomizerTest : public ::testing::Test {
+protected:
+    const std::string source = "fn add(a, b) {\n"
+                               "    total = a + b\n"
+                               "    fn twice(x) {\n"
+                               "        doubled = x * 2\n"
+                               "    }\n"
+                               "    if total > 1 { total = 1 }\n"
+                               "}\n"
+                               "result = add(1, 2)\n";
+
+    static FunctionNode* functionAt(std::span<NodeBase* const> nodes, size_t index) {
+        return index < nodes.size() ? dynamic_cast<FunctionNode*>(nodes[index]) : nullptr;
+    }
+};
+
+TEST_F(FunctionAtomizerTest, PreparsesSignatureAndBody) {
+    std::vector<Token> tokens;
+    size_t             current = 0;
+    // fn f(x) { y = x }
+    tokens.emplace_back(TokenType::FN, "fn", 1, 1);
+    tokens.emplace_back(TokenType::IDENTIFIER, "f", 1, 4);
+    tokens.emplace_back(TokenType::LEFT_PAREN, "(", 1, 5);
+    tokens.emplace_back(TokenType::IDENTIFIER, "x", 1, 6);
+    tokens.emplace_back(TokenType::RIGHT_PAREN, ")", 1, 7);
+    tokens.emplace_back(TokenType::LEFT_BRACE, "{", 1, 9);
+    tokens.emplace_back(TokenType::IDENTIFIER, "y", 1, 11);
+    tokens.emplace_back(TokenType::EQUAL, "=", 1, 13);
+    tokens.emplace_back(TokenType::IDENTIFIER, "x", 1, 15);
+    tokens.emplace_back(TokenType::RIGHT_BRACE, "}", 1, 17);
+
+    FunctionAtomizer atomizer(current, tokens);
+    EXPECT_TRUE(atomizer.canHandle(tokens[current].type));
+
+    auto* function = dynamic_cast<FunctionNode*>(atomizer.atomize());
+    ASSERT_NE(function, nullptr);
+    EXPECT_EQ(function->getName(), "f");
+    ASSERT_EQ(function->getParameters().size(), 1u);
+    EXPECT_EQ(function->getParameters()[0], "x");
+    EXPECT_FALSE(function->isParsed());
+    ASSERT_EQ(function->getBody().size(), 4u);
+    EXPECT_EQ(function->getBody().back().type, TokenType::RIGHT_BRACE);
+    EXPECT_EQ(current, tokens.size());
+}
+
+TEST_F(FunctionAtomizerTest, ParserLeavesBodiesUnparsed) {
+    Lexer  lexer(source);
+    Parser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+
+    ASSERT_EQ(parser.getNodes().size(), 2u);
+    FunctionNode* add = functionAt(parser.getNodes(), 0);
+    ASSERT_NE(add, nullptr);
+    EXPECT_EQ(add->getName(), "add");
+    EXPECT_EQ(lexer.getSymbols().name(add->getSymbol()), "add");
+    EXPECT_EQ(add->getParameters().size(), 2u);
+    EXPECT_FALSE(add->isParsed());
+    EXPECT_TRUE(add->getStatements().empty());
+
+    auto* result = dynamic_cast<VariableNode*>(parser.getNodes()[1]);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->getName(), "result");
+}
+
+TEST_F(FunctionAtomizerTest, ParsesBodyOnDemand) {
+    Lexer  lexer(source);
+    Parser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+
+    FunctionNode*              add        = functionAt(parser.getNodes(), 0);
+    std::span<NodeBase* const> statements = parser.parseFunctionBody(*add);
+    EXPECT_TRUE(add->isParsed());
+    ASSERT_GE(statements.size(), 2u);
+
+    auto* total = dynamic_cast<VariableNode*>(statements[0]);
+    ASSERT_NE(total, nullptr);
+    EXPECT_EQ(total->getName(), "total");
+    EXPECT_EQ(total->getOperation()->getTokens().front().line, 2);
+
+    FunctionNode* twice = functionAt(statements, 1);
+    ASSERT_NE(twice, nullptr);
+    EXPECT_FALSE(twice->isParsed());
+
+    // Parsing again returns the same statements
+    EXPECT_EQ(parser.parseFunctionBody(*add).data(), statements.data());
+}
+
+TEST_F(FunctionAtomizerTest, ParsesAllBodies) {
+    Lexer  lexer(source);
+    Parser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+
+    EXPECT_EQ(parser.parseFunctionBodies(), 2u);
+    EXPECT_EQ(parser.parseFunctionBodies(), 0u);
+
+    FunctionNode* twice = functionAt(functionAt(parser.getNodes(), 0)->getStatements(), 1);
+    ASSERT_NE(twice, nullptr);
+    ASSERT_TRUE(twice->isParsed());
+    ASSERT_EQ(twice->getStatements().size(), 1u);
+    EXPECT_EQ(dynamic_cast<VariableNode*>(twice->getStatements()[0])->getName(), "doubled");
+}
+
+TEST_F(FunctionAtomizerTest, ParsesBodiesOfStreamedTokens) {
+    Lexer       lexer(source);
+    TokenBuffer buffer = lexer.scanTokenBuffer();
+    Parser      parser(buffer);
+
+    FunctionNode* add = functionAt(parser.getNodes(), 0);
+    ASSERT_NE(add, nullptr);
+    std::span<NodeBase* const> statements = parser.parseFunctionBody(*add);
+    ASSERT_FALSE(statements.empty());
+    EXPECT_EQ(dynamic_cast<VariableNode*>(statements[0])->getName(), "total");
+}
+
+TEST_F(FunctionAtomizerTest, RejectsMalformedDeclarations) {
+    for (const char* text : {"fn (a) { }", "fn f a { }", "fn f(a, ) { }", "fn f(a) x = 1", "fn f(a) { x = { 1 }\n"}) {
+        Lexer lexer(text);
+        EXPECT_THROW(Parser parser(lexer.scanTokens()), std::runtime_error) << text;
+    }
+}
+
+TEST_F(FunctionAtomizerTest, ReportsBodyErrorsOnFirstUse) {
+    Lexer  lexer("fn broken() {\n    x = (1 +\n}\ny = 2\n");
+    Parser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+
+    ASSERT_EQ(parser.getNodes().size(), 2u);
+    FunctionNode* broken = functionAt(parser.getNodes(), 0);
+    EXPECT_THROW(parser.parseFunctionBody(*broken), std::runtime_error);
+    EXPECT_FALSE(broken->isParsed());
+}
+
+}  // namespace opal::Test
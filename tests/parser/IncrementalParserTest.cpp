@@ -0,0 +1,319 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/IncrementalParser.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/flat/FlatAst.hpp"
+#include "opal/parser/flat/FlatAstConverter.hpp"
+#include "opal/parser/node/nodes/FunctionNode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class IncrementalParserTest : public ::testing::Test {
+protected:
+    static std::string generateSource(int statements) {
+        std::string source;
+        for (int i = 0; i < statements; i++) {
+            std::string index = std::to_string(i);
+            source += "// Statement " + index + "\n";
+            source += "value_" + index + " = (" + index + " * 3.14) + other_" + index + "\n";
+            source += "const limit_" + index + " = -value_" + index + " / 2\n";
+            source += "text_" + index + " = \"${value_" + index + "} of ${limit_" + index + "}\"\n";
+            source += "load \"module_" + index + ".op\"\n";
+            source += "result_" + index + " = f_" + index + "(value_" + index + ", 1)\n";
+        }
+        return source;
+    }
+
+    // Renders the nodes in pre-order through a FlatAst, with token positions and symbol names
+    static std::string render(const std::vector<NodeBase*>& nodes, const SymbolTable& symbols) {
+        FlatAst     ast = FlatAstConverter::convert(nodes);
+        std::string out;
+        for (uint32_t id = 0; id < ast.size(); id++) {
+            const FlatNode& node = ast.node(id);
+            out += std::to_string(static_cast<int>(node.kind)) + "/" + std::to_string(static_cast<int>(node.token))
+                   + "/" + std::to_string(node.childCount) + " ";
+
+            switch (node.kind) {
+                case NodeType::VARIABLE: {
+                    const FlatVariable& variable = ast.variable(id);
+                    out += std::string(variable.name) + "=" + std::string(variable.value) + " #"
+                           + std::string(symbols.name(variable.symbol)) + (variable.isConstant ? " const" : "");
+                    break;
+                }
+                case NodeType::OPERAND: {
+                    const Token& token = ast.operand(id);
+                    out += std::string(token.value) + "@" + std::to_string(token.line) + ":"
+                           + std::to_string(token.column);
+                    break;
+                }
+                case NodeType::OPERATION:
+                    for (const Token& token : ast.tokens(id)) {
+                        out += std::string(token.value) + "@" + std::to_string(token.line) + ":"
+                               + std::to_string(token.column) + " ";
+                    }
+                    break;
+                case NodeType::STRING:
+                    for (const StringSegment& segment : ast.segments(id)) {
+                        out += std::string(segment.content) + " ";
+                    }
+                    break;
+                case NodeType::FUNCTION:
+                    out += std::string(ast.function(id).name) + " ";
+                    for (const Token& token : ast.body(id)) {
+                        out += std::string(token.value) + "@" + std::to_string(token.line) + ":"
+                               + std::to_string(token.column) + " ";
+                    }
+                    break;
+                default:
+                    if (node.token == TokenType::LOAD) {
+                        out += std::string(ast.path(id));
+                    }
+                    break;
+            }
+            out += "\n";
+        }
+        return out;
+    }
+
+    // Parses the source from scratch, returning an empty string on error
+    static bool parseFresh(const std::string& source, std::string& rendered) {
+        try {
+            Lexer  lexer(source);
+            Parser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+            rendered = render(parser.getNodes(), lexer.getSymbols());
+            return true;
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+    }
+
+    // Applies random edits, checking each one against a fresh parse of the edited source
+    static void expectRandomEditsMatchFresh(const std::string&              initial,
+                                            const std::vector<std::string>& snippets,
+                                            uint32_t                        seed,
+                                            int                             steps) {
+        std::mt19937      random(seed);
+        IncrementalParser parser(initial);
+
+        for (int step = 0; step < steps; step++) {
+            std::string source  = parser.getSource();
+            size_t      offset  = random() % (source.size() + 1);
+            size_t      length  = std::min<size_t>(random() % 4, source.size() - offset);
+            std::string snippet = snippets[random() % snippets.size()];
+            std::string context = "step " + std::to_string(step) + ": replace " + std::to_string(length)
+                                  + " bytes at " + std::to_string(offset) + " with '" + snippet + "'";
+
+            std::string edited = source;
+            edited.replace(offset, length, snippet);
+            std::string expected;
+            if (!parseFresh(edited, expected)) {
+                EXPECT_THROW(parser.edit(offset, length, snippet), std::runtime_error) << context;
+                ASSERT_EQ(parser.getSource(), source) << context;
+                continue;
+            }
+
+            parser.edit(offset, length, snippet);
+            ASSERT_EQ(parser.getSource(), edited) << context;
+            ASSERT_EQ(render(parser.getNodes(), parser.getSymbols()), expected) << context;
+        }
+    }
+
+    static FunctionNode* firstFunction(const std::vector<NodeBase*>& nodes) {
+        for (NodeBase* node : nodes) {
+            if (node->getNodeType() == NodeType::FUNCTION) {
+                return static_cast<FunctionNode*>(node);
+            }
+        }
+        return nullptr;
+    }
+
+    static void expectSameAsFresh(IncrementalParser& parser, const std::string& context) {
+        std::string expected;
+        ASSERT_TRUE(parseFresh(parser.getSource(), expected)) << context;
+        EXPECT_EQ(render(parser.getNodes(), parser.getSymbols()), expected) << context;
+    }
+};
+
+TEST_F(IncrementalParserTest, InitialParseMatchesFresh) {
+    IncrementalParser parser(generateSource(50));
+
+    EXPECT_EQ(parser.getSource(), generateSource(50));
+    EXPECT_EQ(parser.size(), generateSource(50).size());
+    expectSameAsFresh(parser, "initial");
+}
+
+TEST_F(IncrementalParserTest, RandomEditsMatchFresh) {
+    const std::vector<std::string> snippets = {"x",  "7",  " ",  "\n", "+", "-", "(", ")",          "\"",
+                                               "{}", "${", "$",  "//", ",", ".", "const ", "y = 2\n", ""};
+    expectRandomEditsMatchFresh(generateSource(40), snippets, 20240917, 600);
+}
+
+TEST_F(IncrementalParserTest, RandomEditsAcrossBlocksMatchFresh) {
+    const std::vector<std::string> snippets = {"}", "{", "fn g() {", "/*", "*/", " && ", "\n= 3 && x < 4 || y\n",
+                                               "=", "\n", "ccc", "(", ")", "1", ""};
+    std::string                    source;
+    for (int i = 0; i < 30; i++) {
+        std::string index = std::to_string(i);
+        source += "fn f_" + index + "(a) {\n  v_" + index + " = a + " + index + "\n}\n";
+        source += "w_" + index + " = v_" + index + "\n&& x_" + index + " < 4 || y // */\n";
+    }
+    expectRandomEditsMatchFresh(source, snippets, 20251017, 600);
+}
+
+TEST_F(IncrementalParserTest, StatementRunningPastTheLookaheadMatchesFresh) {
+    IncrementalParser parser("a = 1\nb = 2\nccc = ccc\n= 3 && ccc < 4 || x >= 2\nz = 1\n");
+
+    parser.edit(12, 3, "");
+    expectSameAsFresh(parser, "statement past the lookahead");
+}
+
+TEST_F(IncrementalParserTest, BodyClosedPastTheWindowMatchesFresh) {
+    IncrementalParser parser("fn f() {\n  a = 1\n}\nb = 2\nc = 3\nd = 4\ne = 5 // */\n"
+                             "g = 6\nh = 7\ni = 8\nj = 9\n}\nk = 1\n");
+
+    // The comment swallows the closing brace, so the body runs on to the brace before k
+    parser.edit(17, 0, "/*");
+    expectSameAsFresh(parser, "body closed past the window");
+    EXPECT_EQ(parser.getNodes().size(), 2u);
+}
+
+TEST_F(IncrementalParserTest, LocalEditRelexesOnlyNearbyStatements) {
+    std::string       source = generateSource(1000);
+    IncrementalParser parser(source);
+    size_t            offset = source.find("value_500 = (500");
+
+    IncrementalParser::EditStats stats = parser.edit(offset + 13, 3, "42");
+
+    EXPECT_LT(stats.relexedTokens, 100u);
+    EXPECT_LT(stats.reparsedNodes, 10u);
+    EXPECT_NE(parser.getSource().find("value_500 = (42 * 3.14)"), std::string::npos);
+    expectSameAsFresh(parser, "local edit");
+}
+
+TEST_F(IncrementalParserTest, LineBreaksShiftLaterStatements) {
+    IncrementalParser parser(generateSource(20));
+
+    parser.edit(0, 0, "\n\n");
+    expectSameAsFresh(parser, "insert");
+    parser.edit(0, 2, "");
+    expectSameAsFresh(parser, "remove");
+}
+
+TEST_F(IncrementalParserTest, ParsedFunctionBodiesMoveWithTheirSegment) {
+    std::string       functions = "fn outer(x) {\n    y = x + 1\n    fn inner() {\n        z = y * 2\n    }\n}\n";
+    IncrementalParser parser(generateSource(5) + functions + "after = 1\n");
+    FunctionNode*     outer = firstFunction(parser.getNodes());
+    ASSERT_NE(outer, nullptr);
+    parser.parseFunctionBody(*outer);
+
+    // The function is reused, so its body, the statements parsed from it and the nested body all move down
+    parser.edit(0, 0, "\n\n");
+    ASSERT_EQ(firstFunction(parser.getNodes()), outer);
+    ASSERT_EQ(outer->getStatements().size(), 2u);
+    FunctionNode* inner = firstFunction({outer->getStatements().begin(), outer->getStatements().end()});
+    ASSERT_NE(inner, nullptr);
+    parser.parseFunctionBody(*inner);
+
+    Lexer  lexer(parser.getSource());
+    Parser fresh(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+    fresh.parseFunctionBodies();
+    EXPECT_EQ(render(parser.getNodes(), parser.getSymbols()), render(fresh.getNodes(), lexer.getSymbols()));
+}
+
+TEST_F(IncrementalParserTest, RepeatedEditsReuseLiteralsAndSymbols) {
+    IncrementalParser parser(generateSource(20));
+    size_t            literals = parser.getLiterals().size();
+    size_t            symbols  = parser.getSymbols().size();
+
+    for (int i = 0; i < 50; i++) {
+        size_t offset = parser.getSource().find("value_10 = (10");
+        parser.edit(offset + 12, 2, "10");
+        parser.edit(offset, 0, "\n");
+        parser.edit(offset, 1, "");
+    }
+
+    EXPECT_EQ(parser.getLiterals().size(), literals);
+    EXPECT_EQ(parser.getSymbols().size(), symbols);
+    expectSameAsFresh(parser, "after repeated edits");
+}
+
+TEST_F(IncrementalParserTest, FailedEditKeepsTheSource) {
+    IncrementalParser parser("a = 1\nb = (a + 2)\nc = b\n");
+
+    EXPECT_THROW(parser.edit(11, 1, "("), std::runtime_error);
+    EXPECT_EQ(parser.getSource(), "a = 1\nb = (a + 2)\nc = b\n");
+    expectSameAsFresh(parser, "after failed edit");
+
+    parser.edit(6, 1, "renamed");
+    EXPECT_EQ(parser.getSource(), "a = 1\nrenamed = (a + 2)\nc = b\n");
+    expectSameAsFresh(parser, "after edit");
+}
+
+TEST_F(IncrementalParserTest, LexErrorIsReportedAtItsSourcePosition) {
+    std::string       source = generateSource(20);
+    IncrementalParser parser(source);
+    size_t            offset = source.find("value_12 =");
+
+    std::string expected;
+    try {
+        source.replace(offset, 0, "x = 1 @ 2\n");
+        Lexer(source).scanTokens();
+    } catch (const std::runtime_error& e) {
+        expected = e.what();
+    }
+    ASSERT_FALSE(expected.empty());
+
+    try {
+        parser.edit(offset, 0, "x = 1 @ 2\n");
+        FAIL() << "edit did not throw";
+    } catch (const std::runtime_error& e) {
+        EXPECT_EQ(std::string(e.what()), expected);
+    }
+}
+
+TEST_F(IncrementalParserTest, EditOutsideTheSourceThrows) {
+    IncrementalParser parser("a = 1\n");
+
+    EXPECT_THROW(parser.edit(7, 0, "b"), std::runtime_error);
+    EXPECT_THROW(parser.edit(4, 3, ""), std::runtime_error);
+}
+
+TEST_F(IncrementalParserTest, EditsEmptySource) {
+    IncrementalParser parser("");
+
+    EXPECT_EQ(parser.getSegmentCount(), 1u);
+    parser.edit(0, 0, "a = 1\nb = a\n");
+    expectSameAsFresh(parser, "insert into empty");
+    parser.edit(0, parser.size(), "");
+    EXPECT_TRUE(parser.getNodes().empty());
+}
+
+}  // namespace opal::Test
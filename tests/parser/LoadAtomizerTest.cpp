@@ -46,8 +46,8 @@ TEST_F(LoadAtomizerTest, BasicLoad) {
     LoadAtomizer atomizer(current, tokens);
     EXPECT_TRUE(atomizer.canHandle(tokens[current].type));
 
-    std::unique_ptr<NodeBase> node     = atomizer.atomize();
-    opal::LoadNode*           loadNode = dynamic_cast<LoadNode*>(node.get());
+    NodeBase*       node     = atomizer.atomize();
+    opal::LoadNode* loadNode = dynamic_cast<LoadNode*>(node);
     ASSERT_NE(loadNode, nullptr);
     EXPECT_EQ(loadNode->getPath(), "script.opal");
 }
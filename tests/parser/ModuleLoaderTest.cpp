@@ -0,0 +1,165 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/ModuleLoader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class ModuleLoaderTest : public ::testing::Test {
+protected:
+    const std::filesystem::path directory = std::filesystem::absolute("module_loader_test");
+
+    void SetUp() override {
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory / "lib");
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    std::string write(const std::string& name, const std::string& content) const {
+        std::filesystem::path path = directory / name;
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << content;
+        return std::filesystem::canonical(path).string();
+    }
+
+    static size_t positionOf(const ModuleLoader& loader, const std::string& path) {
+        const auto& order = loader.getLoadOrder();
+        auto        found =
+            std::find_if(order.begin(), order.end(), [&path](const auto& module) { return module->path == path; });
+        return static_cast<size_t>(found - order.begin());
+    }
+
+    static size_t parsedCount(const ModuleLoader& loader) {
+        const auto& report = loader.getReport();
+        return static_cast<size_t>(
+            std::count_if(report.begin(), report.end(), [](const auto& module) { return !module.cached; }));
+    }
+};
+
+TEST_F(ModuleLoaderTest, ParsesSharedModulesOnce) {
+    std::string shared = write("lib/shared.op", "base = 1\n");
+    std::string left   = write("left.op", "load \"lib/shared.op\"\nleft = base + 1\n");
+    std::string right  = write("right.op", "load \"./lib/../lib/shared.op\"\nright = base * 2\n");
+    std::string main   = write("main.op", "load \"left.op\"\nload \"right.op\"\nload \"left.op\"\nresult = left\n");
+
+    ModuleLoader loader(4);
+    auto         entry = loader.load((directory / "main.op").string());
+
+    EXPECT_EQ(entry->path, main);
+    EXPECT_EQ(entry->dependencies, (std::vector<std::string>{left, right}));
+    ASSERT_EQ(loader.getLoadOrder().size(), 4u);
+    ASSERT_EQ(loader.getReport().size(), 4u);
+    EXPECT_EQ(parsedCount(loader), 4u);
+    EXPECT_LT(positionOf(loader, shared), positionOf(loader, left));
+    EXPECT_LT(positionOf(loader, shared), positionOf(loader, right));
+    EXPECT_EQ(positionOf(loader, main), 3u);
+    EXPECT_EQ(loader.getLoadOrder().back()->getNodes().size(), 4u);
+}
+
+TEST_F(ModuleLoaderTest, ReusesUnchangedModules) {
+    write("lib/shared.op", "base = 1\n");
+    std::string main = write("main.op", "load \"lib/shared.op\"\nresult = base\n");
+
+    ModuleLoader loader(2);
+    auto         first = loader.load(main);
+    auto         again = loader.load(main);
+    EXPECT_EQ(first, again);
+    EXPECT_EQ(parsedCount(loader), 0u);
+
+    // A new modification time with the same content is caught by the hash
+    std::filesystem::last_write_time(main, std::filesystem::last_write_time(main) + std::chrono::seconds(5));
+    EXPECT_EQ(loader.load(main), first);
+    EXPECT_EQ(parsedCount(loader), 0u);
+
+    // Only the changed module is parsed again, the old one stays usable
+    write("lib/shared.op", "base = 2\nother = 3\n");
+    loader.load(main);
+    EXPECT_EQ(parsedCount(loader), 1u);
+    EXPECT_EQ(loader.getLoadOrder().front()->getNodes().size(), 2u);
+    EXPECT_EQ(first->getNodes().size(), 2u);
+    EXPECT_EQ(loader.getCacheSize(), 2u);
+}
+
+TEST_F(ModuleLoaderTest, DetectsCycles) {
+    write("a.op", "load \"b.op\"\n");
+    write("b.op", "load \"c.op\"\n");
+    write("c.op", "load \"a.op\"\n");
+
+    ModuleLoader loader(2);
+    try {
+        loader.load((directory / "a.op").string());
+        FAIL() << "Expected a load cycle";
+    } catch (const std::runtime_error& e) {
+        std::string message = e.what();
+        EXPECT_NE(message.find("Load cycle"), std::string::npos) << message;
+        EXPECT_NE(message.find("b.op -> "), std::string::npos) << message;
+    }
+}
+
+TEST_F(ModuleLoaderTest, ReportsMissingAndBrokenModules) {
+    std::string missing = write("missing.op", "load \"nowhere.op\"\n");
+    write("lib/broken.op", "x = (1 + \n");
+    std::string broken = write("broken.op", "load \"lib/broken.op\"\n");
+
+    ModuleLoader loader(2);
+    EXPECT_THROW(loader.load((directory / "absent.op").string()), std::runtime_error);
+    EXPECT_THROW(loader.load(missing), std::runtime_error);
+    try {
+        loader.load(broken);
+        FAIL() << "Expected a parsing error";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("lib/broken.op"), std::string::npos) << e.what();
+    }
+
+    // Fixing the broken module only parses that one again
+    write("lib/broken.op", "x = (1 + 2)\n");
+    loader.load(broken);
+    EXPECT_EQ(parsedCount(loader), 1u);
+}
+
+TEST_F(ModuleLoaderTest, LoadsDeepChains) {
+    const int depth = 200;
+    for (int i = 0; i < depth; i++) {
+        std::string index = std::to_string(i);
+        std::string body  = "v" + index + " = " + index + "\n";
+        if (i + 1 < depth) {
+            body = "load \"m" + std::to_string(i + 1) + ".op\"\n" + body;
+        }
+        write("m" + index + ".op", body);
+    }
+
+    ModuleLoader loader(4);
+    auto         entry = loader.load((directory / "m0.op").string());
+
+    EXPECT_EQ(loader.getLoadOrder().size(), static_cast<size_t>(depth));
+    EXPECT_EQ(loader.getLoadOrder().back(), entry);
+}
+
+}  // namespace opal::Test
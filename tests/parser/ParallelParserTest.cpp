@@ -0,0 +1,202 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/ParallelParser.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/Parser.hpp"
+#include "opal/parser/flat/FlatAst.hpp"
+#include "opal/parser/flat/FlatAstConverter.hpp"
+#include "opal/parser/node/nodes/FunctionNode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class ParallelParserTest : public ::testing::Test {
+protected:
+    static std::string generateSource(int statements) {
+        std::string source;
+        for (int i = 0; i < statements; i++) {
+            std::string index = std::to_string(i);
+            source += "value_" + index + " = (" + index + " * 3.14) + other_" + index + "\n";
+            source += "if value_" + index + " > 2 {\n    inner_" + index + " = -value_" + index + "\n}\n";
+            if (i % 7 == 0) {
+                // Statements that swallow the start of the next line, so chunks may begin inside them
+                source += "call_" + index + " = f_" + index + "\n(" + index + ")\n";
+                source += "text_" + index + " = \"${fresh_" + index + "} and ${value_" + index + "}\"\n";
+                source += "load \"skipped.op\"\n";
+            }
+            if (i % 5 == 0) {
+                source += "fn helper_" + index + "(a, b) {\n    local_" + index + " = a + b\n";
+                source += "    fn nested_" + index + "() {\n";
+                source += "        deep_" + index + " = local_" + index + " * 2\n    }\n}\n";
+            }
+            source += "\"${name_" + index + "} says ${fresh_" + index + "}\"\n";
+        }
+        return source;
+    }
+
+    // Parses every function body, nested ones included, in source order
+    template <typename ParserType>
+    static void parseBodies(ParserType& parser) {
+        std::vector<NodeBase*> pending(parser.getNodes().rbegin(), parser.getNodes().rend());
+        while (!pending.empty()) {
+            NodeBase* node = pending.back();
+            pending.pop_back();
+            if (node->getNodeType() == NodeType::FUNCTION) {
+                std::span<NodeBase* const> statements = parser.parseFunctionBody(*static_cast<FunctionNode*>(node));
+                pending.insert(pending.end(), statements.rbegin(), statements.rend());
+            }
+        }
+    }
+
+    // Renders the nodes in pre-order through a FlatAst, symbol ids included
+    static std::string render(const std::vector<NodeBase*>& nodes, const SymbolTable& symbols) {
+        FlatAst     ast = FlatAstConverter::convert(nodes);
+        std::string out;
+        for (uint32_t id = 0; id < ast.size(); id++) {
+            const FlatNode& node = ast.node(id);
+            out += std::to_string(static_cast<int>(node.kind)) + "/" + std::to_string(static_cast<int>(node.token))
+                   + "/" + std::to_string(node.childCount) + " ";
+
+            switch (node.kind) {
+                case NodeType::VARIABLE: {
+                    const FlatVariable& variable = ast.variable(id);
+                    out += std::string(variable.name) + "=" + std::string(variable.value) + " #"
+                           + std::string(symbols.name(variable.symbol)) + "@" + std::to_string(variable.symbol);
+                    break;
+                }
+                case NodeType::FUNCTION: {
+                    const FlatFunction& function = ast.function(id);
+                    out += std::string(function.name) + " #" + std::string(symbols.name(function.symbol)) + "@"
+                           + std::to_string(function.symbol) + (function.isParsed ? " parsed" : "");
+                    break;
+                }
+                case NodeType::OPERAND:
+                    out += std::string(ast.operand(id).value);
+                    break;
+                case NodeType::OPERATION:
+                    out += std::to_string(ast.tokens(id).size());
+                    break;
+                case NodeType::STRING:
+                    for (const StringSegment& segment : ast.segments(id)) {
+                        out += std::string(segment.content) + "@" + std::to_string(segment.symbol) + " ";
+                    }
+                    break;
+                default:
+                    if (node.token == TokenType::LOAD) {
+                        out += std::string(ast.path(id));
+                    }
+                    break;
+            }
+            out += "\n";
+        }
+        return out;
+    }
+
+    static void expectSameAsSequential(const std::string& source, size_t threadCount) {
+        Lexer  sequentialLexer(source);
+        Parser sequential(sequentialLexer.scanTokens(), &sequentialLexer.getLiterals(), &sequentialLexer.getSymbols());
+
+        Lexer          parallelLexer(source);
+        ParallelParser parallel(
+            parallelLexer.scanTokens(), &parallelLexer.getLiterals(), &parallelLexer.getSymbols(), threadCount);
+
+        parseBodies(sequential);
+        parseBodies(parallel);
+
+        ASSERT_EQ(parallel.getNodes().size(), sequential.getNodes().size()) << threadCount << " threads";
+        EXPECT_EQ(render(parallel.getNodes(), parallelLexer.getSymbols()),
+                  render(sequential.getNodes(), sequentialLexer.getSymbols()))
+            << threadCount << " threads";
+        EXPECT_EQ(parallelLexer.getSymbols().size(), sequentialLexer.getSymbols().size()) << threadCount << " threads";
+    }
+
+    static std::string errorOf(const std::function<void()>& parse) {
+        try {
+            parse();
+        } catch (const std::runtime_error& e) {
+            return e.what();
+        }
+        return "";
+    }
+};
+
+TEST_F(ParallelParserTest, SmallSourceMatchesSequential) {
+    expectSameAsSequential(generateSource(20), 4);
+}
+
+TEST_F(ParallelParserTest, LargeSourceMatchesSequential) {
+    std::string source = generateSource(3000);
+    for (size_t threads : {1, 2, 4, 8}) {
+        expectSameAsSequential(source, threads);
+    }
+}
+
+TEST_F(ParallelParserTest, RestitchesChunksStartingInsideAStatement) {
+    // A string assignment skips the token after it, so no line after the first starts a statement
+    std::string source;
+    for (int i = 0; i < 6000; i++) {
+        source += "text_" + std::to_string(i) + " = \"${part_" + std::to_string(i) + "}\"\n";
+    }
+
+    for (size_t threads : {2, 4}) {
+        expectSameAsSequential(source, threads);
+    }
+}
+
+TEST_F(ParallelParserTest, SplitsLargeSourcesIntoChunks) {
+    Lexer          lexer(generateSource(3000));
+    ParallelParser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols(), 4);
+
+    EXPECT_GT(parser.getChunkCount(), 1u);
+}
+
+TEST_F(ParallelParserTest, ParsesEmptyTokens) {
+    Lexer          lexer("");
+    ParallelParser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols(), 2);
+
+    EXPECT_TRUE(parser.getNodes().empty());
+}
+
+TEST_F(ParallelParserTest, ReportsTheFirstErrorInSourceOrder) {
+    std::string source = generateSource(1000) + "broken = (1 + 2\n" + generateSource(1000) + "load 42\n";
+
+    Lexer       sequentialLexer(source);
+    std::string expected = errorOf([&] { Parser parser(sequentialLexer.scanTokens()); });
+    ASSERT_FALSE(expected.empty());
+
+    for (size_t threads : {1, 4}) {
+        Lexer parallelLexer(source);
+        EXPECT_EQ(errorOf([&] { ParallelParser parser(parallelLexer.scanTokens(), nullptr, nullptr, threads); }),
+                  expected)
+            << threads << " threads";
+    }
+}
+
+}  // namespace opal::Test
@@ -0,0 +1,191 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/parser/Parser.hpp"
+
+#include "opal/lexer/Lexer.hpp"
+#include "opal/parser/node/nodes/LoadNode.hpp"
+#include "opal/parser/node/nodes/OperationNode.hpp"
+#include "opal/parser/node/nodes/StringNode.hpp"
+#include "opal/parser/node/nodes/VariableNode.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opal::Test {
+
+class ParserTest : public ::testing::Test {
+protected:
+    static std::string describe(const NodeBase* node) {
+        std::string description = std::to_string(static_cast<int>(node->getNodeType())) + ":";
+
+        if (const auto* variable = dynamic_cast<const VariableNode*>(node)) {
+            description += std::string(variable->getName()) + "=" + std::string(variable->getValue());
+            description += variable->getIsConstant() ? ":const" : ":var";
+            description += ":" + std::to_string(static_cast<int>(variable->getType()));
+            if (variable->getOperation()) {
+                description += ":" + describe(variable->getOperation());
+            }
+            if (variable->getStringNode()) {
+                description += ":" + describe(variable->getStringNode());
+            }
+        } else if (const auto* operation = dynamic_cast<const OperationNode*>(node)) {
+            for (const Token& token : operation->getTokens()) {
+                description += std::string(token.value) + " ";
+            }
+        } else if (const auto* string = dynamic_cast<const StringNode*>(node)) {
+            for (const StringSegment& segment : string->getSegments()) {
+                description += std::to_string(static_cast<int>(segment.type)) + std::string(segment.content) + "|";
+            }
+        } else if (const auto* load = dynamic_cast<const LoadNode*>(node)) {
+            description += std::string(load->getPath());
+        }
+        return description;
+    }
+
+    static std::vector<std::string> describeAll(const Parser& parser) {
+        std::vector<std::string> descriptions;
+        for (const NodeBase* node : parser.getNodes()) {
+            descriptions.push_back(describe(node));
+        }
+        return descriptions;
+    }
+
+    static void expectStreamingMatchesMaterialized(const std::string& source) {
+        Lexer  materializedLexer(source);
+        Parser materialized(materializedLexer.scanTokens());
+
+        Lexer  streamingLexer(source);
+        Parser streaming(streamingLexer);
+
+        EXPECT_EQ(describeAll(streaming), describeAll(materialized));
+    }
+};
+
+TEST_F(ParserTest, StreamingParsesSimpleProgram) {
+    expectStreamingMatchesMaterialized("const x = 42\n"
+                                       "y = (x + 1) * 2\n"
+                                       "z = \"value {x} and {y}\"\n"
+                                       "flag = true\n"
+                                       "nothing = nil\n"
+                                       "load \"module.op\"\n");
+}
+
+TEST_F(ParserTest, StreamingParsesAcrossWindowCompaction) {
+    std::string source;
+    for (int i = 0; i < 500; i++) {
+        std::string index = std::to_string(i);
+        source += "const c" + index + " = " + index + "\n";
+        source += "v" + index + " = (c" + index + " + 3) * v" + index + " - 1\n";
+        source += "s" + index + " = \"item {v" + index + "}\"\n";
+    }
+
+    Lexer  streamingLexer(source);
+    Parser streaming(streamingLexer);
+    EXPECT_EQ(streaming.getNodes().size(), 1500u);
+
+    expectStreamingMatchesMaterialized(source);
+}
+
+TEST_F(ParserTest, ParsesTokenBuffer) {
+    const std::string source = "const x = 42\n"
+                               "y = (x + 1) * 2\n"
+                               "z = \"value {x}\"\n";
+
+    Lexer  materializedLexer(source);
+    Parser materialized(materializedLexer.scanTokens());
+
+    Lexer       bufferLexer(source);
+    TokenBuffer buffer = bufferLexer.scanTokenBuffer();
+    Parser      buffered(buffer);
+
+    EXPECT_EQ(describeAll(buffered), describeAll(materialized));
+}
+
+TEST_F(ParserTest, StreamingParsesEmptySource) {
+    Lexer  lexer("");
+    Parser parser(lexer);
+    EXPECT_TRUE(parser.getNodes().empty());
+}
+
+TEST_F(ParserTest, SkipsTokensWithoutAtomizer) {
+    Lexer  lexer("if 1 {\n}\nprint(1)\nload \"module.op\"\ny = 2\n");
+    Parser parser(lexer.scanTokens());
+
+    std::vector<std::string> descriptions = describeAll(parser);
+    ASSERT_EQ(descriptions.size(), 2u);
+    EXPECT_EQ(dynamic_cast<const LoadNode*>(parser.getNodes()[0])->getPath(), "module.op");
+    EXPECT_EQ(dynamic_cast<const VariableNode*>(parser.getNodes()[1])->getName(), "y");
+}
+
+TEST_F(ParserTest, ReadsDecodedLiteralsFromTheLexer) {
+    Lexer  lexer("big = 9007199254740993\nratio = 0.5\n");
+    Parser parser(lexer.scanTokens(), &lexer.getLiterals());
+
+    ASSERT_EQ(parser.getNodes().size(), 2u);
+    const auto* big = dynamic_cast<const VariableNode*>(parser.getNodes()[0]);
+    ASSERT_NE(big, nullptr);
+    EXPECT_EQ(big->getType(), VariableType::INT);
+    EXPECT_EQ(big->getNumber().integer, 9007199254740993);
+
+    const auto* ratio = dynamic_cast<const VariableNode*>(parser.getNodes()[1]);
+    ASSERT_NE(ratio, nullptr);
+    EXPECT_EQ(ratio->getType(), VariableType::FLOAT);
+    EXPECT_DOUBLE_EQ(ratio->getNumber().floating, 0.5);
+}
+
+TEST_F(ParserTest, TagsNamesWithSymbolIds) {
+    Lexer  lexer("x = 1\nx = 2\ny = \"${x} and ${z}\"\n");
+    Parser parser(lexer.scanTokens(), &lexer.getLiterals(), &lexer.getSymbols());
+
+    ASSERT_EQ(parser.getNodes().size(), 3u);
+    const auto* first      = dynamic_cast<const VariableNode*>(parser.getNodes()[0]);
+    const auto* reassigned = dynamic_cast<const VariableNode*>(parser.getNodes()[1]);
+    const auto* string     = dynamic_cast<const VariableNode*>(parser.getNodes()[2]);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(reassigned, nullptr);
+    ASSERT_NE(string, nullptr);
+
+    EXPECT_EQ(first->getSymbol(), reassigned->getSymbol());
+    EXPECT_NE(first->getSymbol(), string->getSymbol());
+
+    ASSERT_NE(string->getStringNode(), nullptr);
+    std::span<const StringSegment> segments = string->getStringNode()->getSegments();
+    ASSERT_EQ(segments.size(), 3u);
+    EXPECT_EQ(segments[0].symbol, first->getSymbol());
+    EXPECT_EQ(segments[2].symbol, lexer.getSymbols().find("z"));
+    EXPECT_NE(segments[2].symbol, SymbolTable::NO_SYMBOL);
+}
+
+TEST_F(ParserTest, ReportsOutOfRangeLiterals) {
+    Lexer lexer("x = 1\ny = 99999999999999999999\n");
+    EXPECT_THROW(Parser(lexer.scanTokens(), &lexer.getLiterals()), std::runtime_error);
+}
+
+TEST_F(ParserTest, StreamingReportsErrors) {
+    Lexer lexer("x = (1 + 2");
+    EXPECT_THROW(Parser parser(lexer), std::runtime_error);
+}
+
+}  // namespace opal::Test
@@ -37,10 +37,10 @@ TEST_F(StringAtomizerTest, SimpleString) {
     tokens = {{TokenType::STRING, "Hello World", 1, 1}};
     StringAtomizer atomizer(current, tokens);
 
-    std::unique_ptr<StringNode> node = std::unique_ptr<StringNode>(dynamic_cast<StringNode*>(atomizer.atomize().release()));
+    StringNode* node = dynamic_cast<StringNode*>(atomizer.atomize());
 
     ASSERT_NE(node, nullptr);
-    const std::vector<StringSegment>& segments = node->getSegments();
+    std::span<const StringSegment> segments = node->getSegments();
     ASSERT_EQ(segments.size(), 1);
     ASSERT_EQ(segments[0].type, StringSegmentType::TEXT);
     ASSERT_EQ(segments[0].content, "Hello World");
@@ -50,10 +50,10 @@ TEST_F(StringAtomizerTest, StringWithInterpolation) {
     tokens = {{TokenType::STRING, "Hello ${name}!", 1, 1}};
     StringAtomizer atomizer(current, tokens);
 
-    std::unique_ptr<StringNode> node = std::unique_ptr<StringNode>(dynamic_cast<StringNode*>(atomizer.atomize().release()));
+    StringNode* node = dynamic_cast<StringNode*>(atomizer.atomize());
 
     ASSERT_NE(node, nullptr);
-    const std::vector<StringSegment>& segments = node->getSegments();
+    std::span<const StringSegment> segments = node->getSegments();
     ASSERT_EQ(segments.size(), 3);
     ASSERT_EQ(segments[0].type, StringSegmentType::TEXT);
     ASSERT_EQ(segments[0].content, "Hello ");
@@ -67,10 +67,10 @@ TEST_F(StringAtomizerTest, MultipleInterpolations) {
     tokens = {{TokenType::STRING, "${greeting} ${name}! How are ${state}?", 1, 1}};
     StringAtomizer atomizer(current, tokens);
 
-    std::unique_ptr<StringNode> node = std::unique_ptr<StringNode>(dynamic_cast<StringNode*>(atomizer.atomize().release()));
+    StringNode* node = dynamic_cast<StringNode*>(atomizer.atomize());
 
     ASSERT_NE(node, nullptr);
-    const std::vector<StringSegment>& segments = node->getSegments();
+    std::span<const StringSegment> segments = node->getSegments();
     ASSERT_EQ(segments.size(), 6);
     ASSERT_EQ(segments[0].type, StringSegmentType::VARIABLE);
     ASSERT_EQ(segments[0].content, "greeting");
@@ -97,13 +97,41 @@ TEST_F(StringAtomizerTest, EmptyInterpolation) {
     tokens = {{TokenType::STRING, "Hello ${}", 1, 1}};
     StringAtomizer atomizer(current, tokens);
 
-    std::unique_ptr<StringNode> node = std::unique_ptr<StringNode>(dynamic_cast<StringNode*>(atomizer.atomize().release()));
+    StringNode* node = dynamic_cast<StringNode*>(atomizer.atomize());
 
     ASSERT_NE(node, nullptr);
-    const std::vector<StringSegment>& segments = node->getSegments();
+    std::span<const StringSegment> segments = node->getSegments();
     ASSERT_EQ(segments.size(), 2);
     ASSERT_EQ(segments[0].type, StringSegmentType::TEXT);
     ASSERT_EQ(segments[0].content, "Hello ");
     ASSERT_EQ(segments[1].type, StringSegmentType::VARIABLE);
     ASSERT_EQ(segments[1].content, "");
-}
\ No newline at end of file
+}
+
+TEST_F(StringAtomizerTest, DollarWithoutBraceIsText) {
+    tokens = {{TokenType::STRING, "$5 or $$${price}$", 1, 1}};
+    StringAtomizer atomizer(current, tokens);
+
+    StringNode* node = dynamic_cast<StringNode*>(atomizer.atomize());
+
+    ASSERT_NE(node, nullptr);
+    std::span<const StringSegment> segments = node->getSegments();
+    ASSERT_EQ(segments.size(), 3);
+    ASSERT_EQ(segments[0].type, StringSegmentType::TEXT);
+    ASSERT_EQ(segments[0].content, "$5 or $$");
+    ASSERT_EQ(segments[1].type, StringSegmentType::VARIABLE);
+    ASSERT_EQ(segments[1].content, "price");
+    ASSERT_EQ(segments[2].type, StringSegmentType::TEXT);
+    ASSERT_EQ(segments[2].content, "$");
+}
+
+TEST_F(StringAtomizerTest, StaticLengthCountsOnlyText) {
+    tokens = {{TokenType::STRING, "Hello ${name}, you are ${age}!", 1, 1}};
+    StringAtomizer atomizer(current, tokens);
+
+    StringNode* node = dynamic_cast<StringNode*>(atomizer.atomize());
+
+    ASSERT_NE(node, nullptr);
+    ASSERT_EQ(node->getSegments().size(), 5);
+    ASSERT_EQ(node->getStaticLength(), std::string_view("Hello , you are !").size());
+}
@@ -19,8 +19,10 @@
  * needed for experienced developers.
  */
 
+#include "opal/lexer/Lexer.hpp"
 #include "opal/util/ErrorUtil.hpp"
 #include "opal/util/FileUtil.hpp"
+#include "opal/util/MappedFile.hpp"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -28,6 +30,8 @@
 #include <fstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace opal;
 using namespace testing;
@@ -62,6 +66,44 @@ TEST_F(FileUtilTest, ReadFile) {
     EXPECT_EQ(readContent, testContent);
 }
 
+TEST_F(FileUtilTest, MapFile) {
+    std::string testFilePath = testDir + "/test_map.op";
+    std::string testContent  = "x = 42\ny = \"text\"";
+    FileUtil::writeFile(testFilePath, testContent);
+
+    MappedFile mapped = FileUtil::mapFile(testFilePath);
+    EXPECT_EQ(mapped.view(), testContent);
+
+    Lexer              lexer(mapped.view());
+    std::vector<Token> tokens = lexer.scanTokens();
+    ASSERT_EQ(tokens.size(), 7u);
+    EXPECT_EQ(tokens[5].value, "text");
+    EXPECT_EQ(tokens[5].value.data(), mapped.view().data() + 12);
+}
+
+TEST_F(FileUtilTest, MapEmptyFile) {
+    std::string testFilePath = testDir + "/test_map_empty.op";
+    FileUtil::writeFile(testFilePath, "");
+
+    MappedFile mapped = FileUtil::mapFile(testFilePath);
+    EXPECT_EQ(mapped.size(), 0u);
+    EXPECT_TRUE(mapped.view().empty());
+}
+
+TEST_F(FileUtilTest, MapNonExistentFile) {
+    EXPECT_THROW(FileUtil::mapFile(testDir + "/non_existent.op"), std::runtime_error);
+}
+
+TEST_F(FileUtilTest, MappedFileMoves) {
+    std::string testFilePath = testDir + "/test_map_move.op";
+    FileUtil::writeFile(testFilePath, "content");
+
+    MappedFile first  = FileUtil::mapFile(testFilePath);
+    MappedFile second = std::move(first);
+    EXPECT_EQ(first.size(), 0u);
+    EXPECT_EQ(second.view(), "content");
+}
+
 TEST_F(FileUtilTest, ReadNonExistentFile) {
     std::string nonExistentFile = testDir + "/non_existent.txt";
 
@@ -0,0 +1,60 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/util/HashUtil.hpp"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+
+namespace opal::Test {
+
+class HashUtilTest : public ::testing::Test {};
+
+TEST_F(HashUtilTest, IsDeterministic) {
+    std::string text = "x = 42\ny = x * 2\n";
+    EXPECT_EQ(HashUtil::hash64(text), HashUtil::hash64(std::string(text)));
+    EXPECT_NE(HashUtil::hash64(text), HashUtil::hash64(text, 1));
+}
+
+TEST_F(HashUtilTest, DistinguishesEveryTailLength) {
+    std::string        text = "abcdefghijklmnopq";
+    std::set<uint64_t> hashes;
+
+    for (size_t length = 0; length <= text.size(); length++) {
+        hashes.insert(HashUtil::hash64(std::string_view(text).substr(0, length)));
+    }
+    EXPECT_EQ(hashes.size(), text.size() + 1);
+}
+
+TEST_F(HashUtilTest, SingleByteChangesTheHash) {
+    std::string text(1000, 'a');
+    uint64_t    original = HashUtil::hash64(text);
+
+    for (size_t i = 0; i < text.size(); i += 97) {
+        std::string changed = text;
+        changed[i]          = 'b';
+        EXPECT_NE(HashUtil::hash64(changed), original) << i;
+    }
+}
+
+}  // namespace opal::Test
@@ -0,0 +1,68 @@
+/* OpalLang
+ * Copyright (C) 2025 OpalLang
+ *
+ * This software is free software; you can redistribute it and/or modify it under
+ * the terms of the CeCILL-C license as published by CEA, CNRS, and Inria,
+ * either version 1.0 of the License or (at your option) any later version.
+ *
+ * This software is distributed "as is," without any warranty of any kind,
+ * either express or implied, including but not limited to the warranties of
+ * merchantability or fitness for a particular purpose. See the CeCILL-C license
+ * for more details.
+ *
+ * You should have received a copy of the CeCILL-C license along with this
+ * program. If not, see https://cecill.info.
+ *
+ * Opal is a programming language designed with a focus on readability and
+ * performance. It combines modern programming concepts with a clean syntax,
+ * making it accessible to newcomers while providing the power and flexibility
+ * needed for experienced developers.
+ */
+
+#include "opal/util/ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+namespace opal::Test {
+
+class ThreadPoolTest : public ::testing::Test {};
+
+TEST_F(ThreadPoolTest, RunsEveryTask) {
+    ThreadPool       pool(3);
+    std::atomic<int> sum{0};
+
+    std::vector<std::future<int>> results;
+    for (int i = 1; i <= 100; i++) {
+        results.push_back(pool.submit([i, &sum]() {
+            sum += i;
+            return i * 2;
+        }));
+    }
+
+    int doubled = 0;
+    for (std::future<int>& result : results) {
+        doubled += result.get();
+    }
+    EXPECT_EQ(doubled, 10100);
+    EXPECT_EQ(sum.load(), 5050);
+    EXPECT_EQ(pool.size(), 3u);
+}
+
+TEST_F(ThreadPoolTest, PropagatesExceptions) {
+    ThreadPool        pool(1);
+    std::future<void> result = pool.submit([]() { throw std::runtime_error("task failed"); });
+
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST_F(ThreadPoolTest, DefaultsToHardwareThreads) {
+    ThreadPool pool;
+    EXPECT_GE(pool.size(), 1u);
+}
+
+}  // namespace opal::Test